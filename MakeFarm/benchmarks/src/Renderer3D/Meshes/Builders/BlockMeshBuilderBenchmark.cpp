@@ -0,0 +1,44 @@
+#include "Renderer3D/Meshes/Builders/BlockMeshBuilder.h"
+#include "World/Chunks/ChunkInterface.h"
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+/**
+ * @brief Texture coordinates of the first texture in a spritesheet of sixteen textures per row.
+ */
+const std::vector<GLfloat> TEXTURE_QUAD = {0.0625f, 0.0625f, 0.f, 0.0625f, 0.f, 0.f, 0.0625f, 0.f};
+
+/**
+ * @brief Builds a mesh of the given number of quads, going through every face of the blocks of a
+ * chunk one after another, as it is done while rebuilding a chunk.
+ */
+void BM_BlockMeshBuilderAddQuad(benchmark::State& state)
+{
+    const auto numberOfQuads = static_cast<int>(state.range(0));
+    constexpr auto NUMBER_OF_FACES = static_cast<int>(Block::Face::Counter);
+
+    BlockMeshBuilder meshBuilder(Block::Coordinate(0, 0, 0));
+    for (auto _: state)
+    {
+        meshBuilder.resetMesh();
+        for (auto quad = 0; quad < numberOfQuads; ++quad)
+        {
+            const auto block = quad / NUMBER_OF_FACES;
+            const auto blockPosition =
+                Block::Coordinate(block % ChunkInterface::BLOCKS_PER_X_DIMENSION,
+                                  block / ChunkInterface::BLOCKS_PER_X_DIMENSION %
+                                      ChunkInterface::BLOCKS_PER_Y_DIMENSION,
+                                  block / ChunkInterface::BLOCKS_PER_X_DIMENSION /
+                                      ChunkInterface::BLOCKS_PER_Y_DIMENSION);
+            meshBuilder.addQuad(static_cast<Block::Face>(quad % NUMBER_OF_FACES), TEXTURE_QUAD,
+                                blockPosition);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * numberOfQuads);
+}
+BENCHMARK(BM_BlockMeshBuilderAddQuad)->RangeMultiplier(4)->Range(256, 16384);
+
+}// namespace
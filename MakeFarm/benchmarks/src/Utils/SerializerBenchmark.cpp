@@ -0,0 +1,107 @@
+#include "BenchmarkUtils/BenchmarkChunk.h"
+#include "BenchmarkUtils/BenchmarkWorld.h"
+#include "Utils/Serializer.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace
+{
+
+/**
+ * @brief Every block of a chunk, the way older versions of the game saved chunks.
+ */
+using ChunkArray1D = std::array<BlockId, ChunkInterface::BLOCKS_IN_CHUNK>;
+
+/**
+ * @brief Blocks of the chunk at the origin of the generated world.
+ */
+const ChunkArray1D& generatedChunk()
+{
+    static const auto chunk = []
+    {
+        TerrainGenerator terrainGenerator(BenchmarkWorld::WORLD_SEED);
+        const auto blockIds = BenchmarkChunk({0, 0, 0}, terrainGenerator).blockIds();
+
+        auto chunk = std::make_unique<ChunkArray1D>();
+        std::copy(blockIds.cbegin(), blockIds.cend(), chunk->begin());
+        return chunk;
+    }();
+    return *chunk;
+}
+
+/**
+ * @brief Path to the file to which the serialized data is saved.
+ */
+const std::string& savePath()
+{
+    static const auto path =
+        (std::filesystem::temp_directory_path() / "MakeFarmSerializerBenchmark" / "chunk.bin")
+            .string();
+    return path;
+}
+
+void BM_SerializerSerializeChunk(benchmark::State& state)
+{
+    Serializer serializer;
+    for (auto _: state)
+    {
+        serializer.serialize(generatedChunk());
+        benchmark::DoNotOptimize(serializer.serializedData().data());
+    }
+    state.SetBytesProcessed(state.iterations() * sizeof(ChunkArray1D));
+}
+BENCHMARK(BM_SerializerSerializeChunk)->Unit(benchmark::kMicrosecond);
+
+void BM_SerializerReadSerializedChunk(benchmark::State& state)
+{
+    Serializer serializer;
+    serializer.serialize(generatedChunk());
+    const auto serializedData = serializer.serializedData();
+
+    auto chunk = std::make_unique<ChunkArray1D>();
+    for (auto _: state)
+    {
+        serializer.readSerialized(serializedData.data(), serializedData.size(), *chunk);
+        benchmark::DoNotOptimize(chunk->data());
+    }
+    state.SetBytesProcessed(state.iterations() * sizeof(ChunkArray1D));
+}
+BENCHMARK(BM_SerializerReadSerializedChunk)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief Serializes the chunk and saves it to a file, as the game saves the player and inventory.
+ */
+void BM_SerializerSaveChunkToFile(benchmark::State& state)
+{
+    Serializer serializer;
+    for (auto _: state)
+    {
+        serializer.serialize(generatedChunk());
+        serializer.saveToFile(savePath());
+    }
+    state.SetBytesProcessed(state.iterations() * sizeof(ChunkArray1D));
+}
+BENCHMARK(BM_SerializerSaveChunkToFile)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief Opens the saved file and reads the chunk from it, as the game loads the player and
+ * inventory.
+ */
+void BM_SerializerLoadChunkFromFile(benchmark::State& state)
+{
+    Serializer serializer;
+    serializer.serialize(generatedChunk());
+    serializer.saveToFile(savePath());
+
+    auto chunk = std::make_unique<ChunkArray1D>();
+    for (auto _: state)
+    {
+        std::ifstream file(savePath(), std::ios::binary);
+        serializer.readSerialized(file, *chunk);
+        benchmark::DoNotOptimize(chunk->data());
+    }
+    state.SetBytesProcessed(state.iterations() * sizeof(ChunkArray1D));
+}
+BENCHMARK(BM_SerializerLoadChunkFromFile)->Unit(benchmark::kMicrosecond);
+
+}// namespace
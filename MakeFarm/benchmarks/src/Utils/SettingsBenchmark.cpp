@@ -0,0 +1,63 @@
+#include "Utils/Settings.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace
+{
+
+/**
+ * @brief Paths of all block and item configuration files the game reads at startup.
+ */
+const std::vector<std::string>& configurationFiles()
+{
+    static const auto files = []
+    {
+        std::vector<std::string> files;
+        for (const auto* directory: {"resources/Blocks", "resources/Items"})
+        {
+            for (const auto& file: std::filesystem::directory_iterator(directory))
+            {
+                if (file.path().extension() == ".cfg")
+                {
+                    files.push_back(file.path().string());
+                }
+            }
+        }
+        return files;
+    }();
+    return files;
+}
+
+void BM_SettingsOpenAllConfigurationFiles(benchmark::State& state)
+{
+    Settings settings;
+    for (auto _: state)
+    {
+        for (const auto& file: configurationFiles())
+        {
+            settings.openFile(file);
+            benchmark::DoNotOptimize(settings.isPresent("Id"));
+            settings.closeFile();
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                      configurationFiles().size()));
+}
+BENCHMARK(BM_SettingsOpenAllConfigurationFiles)->Unit(benchmark::kMicrosecond);
+
+void BM_SettingsReadBlockValues(benchmark::State& state)
+{
+    Settings settings("resources/Blocks/Grass.cfg");
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(settings.get<int>("Id"));
+        benchmark::DoNotOptimize(settings.get<std::string>("Name"));
+        benchmark::DoNotOptimize(settings.isPresent("Transparent"));
+        benchmark::DoNotOptimize(settings.isPresent("Collidable"));
+        benchmark::DoNotOptimize(settings.get<unsigned>("TextureTop"));
+        benchmark::DoNotOptimize(settings.get<unsigned>("TextureSide"));
+    }
+}
+BENCHMARK(BM_SettingsReadBlockValues);
+
+}// namespace
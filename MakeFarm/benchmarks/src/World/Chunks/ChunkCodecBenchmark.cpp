@@ -0,0 +1,192 @@
+#include "BenchmarkUtils/BenchmarkChunk.h"
+#include "World/Chunks/ChunkCodec.h"
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+/**
+ * @brief Size of a chunk saved as the raw one-dimensional array of block ids.
+ */
+constexpr auto RAW_CHUNK_SIZE = ChunkInterface::BLOCKS_IN_CHUNK * sizeof(BlockId);
+
+/**
+ * @brief Size of the format the encoded chunks are compared against.
+ */
+using UnencodedSize = std::size_t (*)(const ChunkCodec::BlockEdits& blockEdits);
+
+std::size_t rawChunkSize(const ChunkCodec::BlockEdits&)
+{
+    return RAW_CHUNK_SIZE;
+}
+
+/**
+ * @brief Size of the edits serialized as a list of (index, BlockId) pairs, as chunks were saved
+ * before the codec was introduced.
+ */
+std::size_t editListSize(const ChunkCodec::BlockEdits& blockEdits)
+{
+    return sizeof(std::uint32_t) + blockEdits.size() * (sizeof(int) + sizeof(BlockId));
+}
+
+std::size_t unencodedSizeOfAll(const std::vector<ChunkCodec::BlockEdits>& chunks,
+                               UnencodedSize unencodedSize)
+{
+    std::size_t size = 0;
+    for (const auto& chunk: chunks)
+    {
+        size += unencodedSize(chunk);
+    }
+    return size;
+}
+
+int indexOf(int x, int y, int z)
+{
+    return x + ChunkInterface::BLOCKS_PER_X_DIMENSION *
+                   (y + ChunkInterface::BLOCKS_PER_Y_DIMENSION * z);
+}
+
+/**
+ * @brief Chunks of a generated world, spread far apart so they cover different biomes. Every
+ * block is treated as changed, which is the worst case for the codec. They are compared against
+ * the raw chunk.
+ */
+const std::vector<ChunkCodec::BlockEdits>& generatedChunks()
+{
+    static const auto chunks = []
+    {
+        constexpr auto DISTANCE_BETWEEN_CHUNKS = 25;
+        TerrainGenerator terrainGenerator(1337);
+        std::vector<ChunkCodec::BlockEdits> chunks;
+        for (auto x = 0; x < 4; ++x)
+        {
+            for (auto z = 0; z < 4; ++z)
+            {
+                BenchmarkChunk chunk({x * DISTANCE_BETWEEN_CHUNKS, 0, z * DISTANCE_BETWEEN_CHUNKS},
+                                     terrainGenerator);
+                const auto blockIds = chunk.blockIds();
+
+                ChunkCodec::BlockEdits blockEdits;
+                for (auto index = 0; index < ChunkInterface::BLOCKS_IN_CHUNK; ++index)
+                {
+                    blockEdits[index] = blockIds[index];
+                }
+                chunks.push_back(std::move(blockEdits));
+            }
+        }
+        return chunks;
+    }();
+    return chunks;
+}
+
+/**
+ * @brief Changes a player typically makes to a chunk: a tunnel, a mine shaft and a wooden floor.
+ * They are compared against the list of edits the chunks were saved as before the codec.
+ */
+const std::vector<ChunkCodec::BlockEdits>& editedChunks()
+{
+    static const auto chunks = []
+    {
+        ChunkCodec::BlockEdits blockEdits;
+        for (auto x = 0; x < ChunkInterface::BLOCKS_PER_X_DIMENSION; ++x)
+        {
+            blockEdits[indexOf(x, 40, 7)] = BlockId::Air;
+            blockEdits[indexOf(x, 41, 7)] = BlockId::Air;
+        }
+        for (auto y = 10; y < 60; ++y)
+        {
+            blockEdits[indexOf(3, y, 3)] = BlockId::Air;
+        }
+        for (auto x = 8; x < 13; ++x)
+        {
+            for (auto z = 8; z < 13; ++z)
+            {
+                blockEdits[indexOf(x, 70, z)] = BlockId::Planks;
+            }
+        }
+        return std::vector<ChunkCodec::BlockEdits>(16, blockEdits);
+    }();
+    return chunks;
+}
+
+void reportCompressionRatio(benchmark::State& state, std::size_t unencodedSize,
+                            const std::vector<std::vector<unsigned char>>& encodedChunks)
+{
+    std::size_t encodedSize = 0;
+    for (const auto& encodedChunk: encodedChunks)
+    {
+        encodedSize += encodedChunk.size();
+    }
+    state.counters["CompressionRatio"] = static_cast<double>(unencodedSize) / encodedSize;
+    state.counters["EncodedBytesPerChunk"] =
+        static_cast<double>(encodedSize) / encodedChunks.size();
+}
+
+std::vector<std::vector<unsigned char>> encodeAll(const std::vector<ChunkCodec::BlockEdits>& chunks)
+{
+    std::vector<std::vector<unsigned char>> encodedChunks;
+    for (const auto& chunk: chunks)
+    {
+        encodedChunks.push_back(ChunkCodec::encode(chunk));
+    }
+    return encodedChunks;
+}
+
+void benchmarkEncoding(benchmark::State& state, const std::vector<ChunkCodec::BlockEdits>& chunks,
+                       UnencodedSize unencodedSize)
+{
+    const auto unencodedSizeOfChunks = unencodedSizeOfAll(chunks, unencodedSize);
+    for (auto _: state)
+    {
+        for (const auto& chunk: chunks)
+        {
+            auto encodedChunk = ChunkCodec::encode(chunk);
+            benchmark::DoNotOptimize(encodedChunk.data());
+        }
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * unencodedSizeOfChunks));
+    reportCompressionRatio(state, unencodedSizeOfChunks, encodeAll(chunks));
+}
+
+void benchmarkDecoding(benchmark::State& state, const std::vector<ChunkCodec::BlockEdits>& chunks,
+                       UnencodedSize unencodedSize)
+{
+    const auto unencodedSizeOfChunks = unencodedSizeOfAll(chunks, unencodedSize);
+    const auto encodedChunks = encodeAll(chunks);
+    for (auto _: state)
+    {
+        for (const auto& encodedChunk: encodedChunks)
+        {
+            auto blockEdits = ChunkCodec::decode(encodedChunk.data(), encodedChunk.size());
+            benchmark::DoNotOptimize(blockEdits.size());
+        }
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * unencodedSizeOfChunks));
+    reportCompressionRatio(state, unencodedSizeOfChunks, encodedChunks);
+}
+
+void BM_ChunkCodecEncodeGeneratedChunks(benchmark::State& state)
+{
+    benchmarkEncoding(state, generatedChunks(), rawChunkSize);
+}
+BENCHMARK(BM_ChunkCodecEncodeGeneratedChunks)->Unit(benchmark::kMicrosecond);
+
+void BM_ChunkCodecDecodeGeneratedChunks(benchmark::State& state)
+{
+    benchmarkDecoding(state, generatedChunks(), rawChunkSize);
+}
+BENCHMARK(BM_ChunkCodecDecodeGeneratedChunks)->Unit(benchmark::kMicrosecond);
+
+void BM_ChunkCodecEncodeEditedChunks(benchmark::State& state)
+{
+    benchmarkEncoding(state, editedChunks(), editListSize);
+}
+BENCHMARK(BM_ChunkCodecEncodeEditedChunks)->Unit(benchmark::kMicrosecond);
+
+void BM_ChunkCodecDecodeEditedChunks(benchmark::State& state)
+{
+    benchmarkDecoding(state, editedChunks(), editListSize);
+}
+BENCHMARK(BM_ChunkCodecDecodeEditedChunks)->Unit(benchmark::kMicrosecond);
+
+}// namespace
@@ -0,0 +1,113 @@
+#include "BenchmarkUtils/BenchmarkChunk.h"
+#include "BenchmarkUtils/BenchmarkWorld.h"
+#include "Physics/AABB.h"
+#include "World/Chunks/ChunkContainer.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace
+{
+
+/**
+ * @brief Number of chunks along the X and Z axis of the loaded part of the world.
+ */
+constexpr auto LOADED_WORLD_DIMENSION = 5;
+
+/**
+ * @brief Number of positions looked up before they start to repeat.
+ */
+constexpr auto NUMBER_OF_POSITIONS = 4096;
+
+/**
+ * @brief Container with the chunks of the generated world around its origin.
+ */
+ChunkContainer& loadedWorld()
+{
+    static auto chunkContainer = []
+    {
+        auto chunkContainer = std::make_unique<ChunkContainer>();
+        TerrainGenerator terrainGenerator(BenchmarkWorld::WORLD_SEED);
+        for (auto x = 0; x < LOADED_WORLD_DIMENSION; ++x)
+        {
+            for (auto z = 0; z < LOADED_WORLD_DIMENSION; ++z)
+            {
+                chunkContainer->emplace(
+                    ChunkContainer::Coordinate(x, 0, z),
+                    std::make_shared<BenchmarkChunk>(sf::Vector3i(x, 0, z), terrainGenerator));
+            }
+        }
+        return chunkContainer;
+    }();
+    return *chunkContainer;
+}
+
+/**
+ * @brief Random positions of blocks inside the loaded part of the world. The generator is seeded,
+ * so every run looks up the same blocks.
+ */
+std::vector<Block::Coordinate> blockPositions()
+{
+    std::mt19937 generator(1337);
+    std::uniform_int_distribution<int> horizontalDistribution(
+        0, LOADED_WORLD_DIMENSION * ChunkInterface::BLOCKS_PER_X_DIMENSION - 1);
+    std::uniform_int_distribution<int> verticalDistribution(
+        0, ChunkInterface::BLOCKS_PER_Y_DIMENSION - 1);
+
+    std::vector<Block::Coordinate> positions;
+    for (auto i = 0; i < NUMBER_OF_POSITIONS; ++i)
+    {
+        positions.emplace_back(horizontalDistribution(generator), verticalDistribution(generator),
+                               horizontalDistribution(generator));
+    }
+    return positions;
+}
+
+void BM_ChunkContainerWorldBlock(benchmark::State& state)
+{
+    const auto& chunkContainer = loadedWorld();
+    const auto positions = blockPositions();
+
+    auto position = positions.cbegin();
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(chunkContainer.worldBlock(*position));
+        if (++position == positions.cend())
+        {
+            position = positions.cbegin();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ChunkContainerWorldBlock);
+
+/**
+ * @brief Collision boxes of the size of the player spread over the loaded part of the world, both
+ * under the surface, where they collide, and above it, where they do not.
+ */
+void BM_ChunkContainerDoesItCollide(benchmark::State& state)
+{
+    const auto& chunkContainer = loadedWorld();
+
+    std::vector<AABB> collisionBoxes;
+    for (const auto& position: blockPositions())
+    {
+        AABB aabb({Block::BLOCK_SIZE * 0.5f, Block::BLOCK_SIZE * 1.8f, Block::BLOCK_SIZE * 0.5f});
+        aabb.updatePosition(sf::Vector3f(position.nonBlockMetric()) +
+                            sf::Vector3f(0.25f, 0.1f, 0.25f));
+        collisionBoxes.push_back(aabb);
+    }
+
+    auto collisionBox = collisionBoxes.cbegin();
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(chunkContainer.doesItCollide(*collisionBox));
+        if (++collisionBox == collisionBoxes.cend())
+        {
+            collisionBox = collisionBoxes.cbegin();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ChunkContainerDoesItCollide);
+
+}// namespace
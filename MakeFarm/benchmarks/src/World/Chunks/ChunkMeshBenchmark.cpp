@@ -0,0 +1,50 @@
+#include "BenchmarkUtils/BenchmarkChunk.h"
+#include "BenchmarkUtils/BenchmarkWorld.h"
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+/**
+ * @brief Rebuilds the mesh of the chunk at the given position over and over again. Only the
+ * building of the mesh is measured, without sending it to the graphics card.
+ */
+void rebuildMesh(benchmark::State& state, const std::optional<sf::Vector3i>& chunkPosition)
+{
+    if (!chunkPosition)
+    {
+        state.SkipWithError("No such chunk was found in the searched part of the world");
+        return;
+    }
+
+    TerrainGenerator terrainGenerator(BenchmarkWorld::WORLD_SEED);
+    BenchmarkChunk chunk(*chunkPosition, terrainGenerator);
+    for (auto _: state)
+    {
+        chunk.rebuildMesh();
+        benchmark::ClobberMemory();
+    }
+    state.counters["faces"] = static_cast<double>(chunk.numberOfMeshFaces());
+    state.SetItemsProcessed(state.iterations() * chunk.numberOfMeshFaces());
+}
+
+void BM_ChunkRebuildMeshOneBiome(benchmark::State& state, BiomeId biomeId)
+{
+    rebuildMesh(state, BenchmarkWorld::chunkWithOnlyBiome(biomeId));
+}
+BENCHMARK_CAPTURE(BM_ChunkRebuildMeshOneBiome, Forest, BiomeId::Forest)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ChunkRebuildMeshOneBiome, VeryDryForest, BiomeId::VeryDryForest)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ChunkRebuildMeshOneBiome, Desert, BiomeId::Desert)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ChunkRebuildMeshOneBiome, Snowy, BiomeId::Snowy)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_ChunkRebuildMeshManyBiomes(benchmark::State& state)
+{
+    rebuildMesh(state, BenchmarkWorld::chunkWithManyBiomes());
+}
+BENCHMARK(BM_ChunkRebuildMeshManyBiomes)->Unit(benchmark::kMicrosecond);
+
+}// namespace
@@ -0,0 +1,192 @@
+#include "World/Chunks/ChunkCodec.h"
+#include "World/Chunks/ChunkInterface.h"
+#include "World/Chunks/ChunkStorage.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+#if REGION_FILE_USES_PREAD
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace
+{
+
+/**
+ * @brief Number of saved chunks along the X and Z axis, which is a whole region file.
+ */
+constexpr auto SAVED_WORLD_DIMENSION = RegionFile::CHUNKS_PER_REGION_DIMENSION;
+
+/**
+ * @brief Creates a world in which every chunk was changed by the player, and returns its path.
+ */
+const std::string& savedWorldPath()
+{
+    static const auto path = []
+    {
+        const auto path =
+            (std::filesystem::temp_directory_path() / "MakeFarmChunkStorageBenchmark").string();
+        std::filesystem::remove_all(path);
+
+        ChunkCodec::BlockEdits blockEdits;
+        for (auto index = 0; index < ChunkInterface::BLOCKS_IN_CHUNK; index += 97)
+        {
+            blockEdits[index] = (index % 3 == 0) ? BlockId::Air : BlockId::Planks;
+        }
+        auto data = ChunkCodec::encode(blockEdits);
+        data.insert(data.begin(), static_cast<unsigned char>(SavedChunkFormat::EncodedBlockEdits));
+
+        ChunkStorage chunkStorage(path);
+        for (auto x = 0; x < SAVED_WORLD_DIMENSION; ++x)
+        {
+            for (auto z = 0; z < SAVED_WORLD_DIMENSION; ++z)
+            {
+                chunkStorage.writeChunk({x, 0, z}, data);
+            }
+        }
+        return path;
+    }();
+    return path;
+}
+
+/**
+ * @brief Loads every chunk of the saved world, reading all of them into the same buffer.
+ */
+void loadWorld(ChunkStorage& chunkStorage)
+{
+    std::vector<unsigned char> savedData;
+    for (auto x = 0; x < SAVED_WORLD_DIMENSION; ++x)
+    {
+        for (auto z = 0; z < SAVED_WORLD_DIMENSION; ++z)
+        {
+            chunkStorage.readChunk({x, 0, z}, savedData);
+            auto blockEdits = ChunkCodec::decode(savedData.data() + 1, savedData.size() - 1);
+            benchmark::DoNotOptimize(blockEdits.size());
+        }
+    }
+}
+
+void reportLoadedChunks(benchmark::State& state)
+{
+    state.SetItemsProcessed(state.iterations() * SAVED_WORLD_DIMENSION * SAVED_WORLD_DIMENSION);
+}
+
+/**
+ * @brief The world is opened again in every iteration, so the region files are opened and their
+ * headers are read as when the game starts. The system may still keep the files in its cache.
+ */
+void BM_ChunkStorageLoadWorldReopened(benchmark::State& state)
+{
+    const auto& path = savedWorldPath();
+    for (auto _: state)
+    {
+        ChunkStorage chunkStorage(path);
+        loadWorld(chunkStorage);
+    }
+    reportLoadedChunks(state);
+}
+BENCHMARK(BM_ChunkStorageLoadWorldReopened)->Unit(benchmark::kMillisecond);
+
+#if REGION_FILE_USES_PREAD && defined(POSIX_FADV_DONTNEED)
+/**
+ * @brief Asks the system to drop the region files of the world from its cache, so that they are
+ * read from the disk again.
+ */
+void dropWorldFromSystemCache(const std::string& path)
+{
+    for (const auto& entry: std::filesystem::directory_iterator(path))
+    {
+        const auto fileDescriptor = ::open(entry.path().c_str(), O_RDONLY);
+        if (fileDescriptor < 0)
+        {
+            continue;
+        }
+        // Only pages already written to the disk can be dropped
+        ::fdatasync(fileDescriptor);
+        ::posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fileDescriptor);
+    }
+}
+
+/**
+ * @brief As BM_ChunkStorageLoadWorldReopened, but the region files are dropped from the system
+ * cache before every iteration, as when the game starts after the computer was restarted.
+ */
+void BM_ChunkStorageLoadWorldCold(benchmark::State& state)
+{
+    const auto& path = savedWorldPath();
+    for (auto _: state)
+    {
+        state.PauseTiming();
+        dropWorldFromSystemCache(path);
+        state.ResumeTiming();
+
+        ChunkStorage chunkStorage(path);
+        loadWorld(chunkStorage);
+    }
+    reportLoadedChunks(state);
+}
+BENCHMARK(BM_ChunkStorageLoadWorldCold)->Unit(benchmark::kMillisecond);
+#endif
+
+/**
+ * @brief The world stays open, as when the player comes back to the chunks seen before.
+ */
+void BM_ChunkStorageLoadWorldWarm(benchmark::State& state)
+{
+    ChunkStorage chunkStorage(savedWorldPath());
+    for (auto _: state)
+    {
+        loadWorld(chunkStorage);
+    }
+    reportLoadedChunks(state);
+}
+BENCHMARK(BM_ChunkStorageLoadWorldWarm)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Only reads the saved data of the world, without decoding it, to show the cost of the disk
+ * access alone.
+ */
+void BM_ChunkStorageReadWorldWarm(benchmark::State& state)
+{
+    ChunkStorage chunkStorage(savedWorldPath());
+    std::vector<unsigned char> savedData;
+    for (auto _: state)
+    {
+        for (auto x = 0; x < SAVED_WORLD_DIMENSION; ++x)
+        {
+            for (auto z = 0; z < SAVED_WORLD_DIMENSION; ++z)
+            {
+                chunkStorage.readChunk({x, 0, z}, savedData);
+                benchmark::DoNotOptimize(savedData.data());
+            }
+        }
+    }
+    reportLoadedChunks(state);
+}
+BENCHMARK(BM_ChunkStorageReadWorldWarm)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Loads the world allocating new memory for every read chunk, for comparison with reading
+ * into the same buffer.
+ */
+void BM_ChunkStorageLoadWorldWarmAllocatingReads(benchmark::State& state)
+{
+    ChunkStorage chunkStorage(savedWorldPath());
+    for (auto _: state)
+    {
+        for (auto x = 0; x < SAVED_WORLD_DIMENSION; ++x)
+        {
+            for (auto z = 0; z < SAVED_WORLD_DIMENSION; ++z)
+            {
+                const auto savedData = chunkStorage.readChunk({x, 0, z});
+                auto blockEdits = ChunkCodec::decode(savedData->data() + 1, savedData->size() - 1);
+                benchmark::DoNotOptimize(blockEdits.size());
+            }
+        }
+    }
+    reportLoadedChunks(state);
+}
+BENCHMARK(BM_ChunkStorageLoadWorldWarmAllocatingReads)->Unit(benchmark::kMillisecond);
+
+}// namespace
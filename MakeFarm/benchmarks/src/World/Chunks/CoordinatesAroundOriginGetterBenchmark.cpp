@@ -0,0 +1,33 @@
+#include "World/Chunks/ChunkManager.h"
+#include "World/Chunks/CoordinatesAroundOriginGetter.h"
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+/**
+ * @brief Walks through the square of chunks around the player, as the chunk manager does every
+ * time it looks for chunks to generate. The argument is the distance of generation in chunks.
+ */
+void BM_CoordinatesAroundOriginGetter(benchmark::State& state)
+{
+    const auto distance = static_cast<int>(state.range(0));
+    const auto numberOfCoordinates = 2 * distance * 2 * distance;
+
+    CoordinatesAroundOriginGetter coordinatesGetter({0, 0, 0});
+    for (auto _: state)
+    {
+        coordinatesGetter.resetToStart();
+        for (auto i = 0; i < numberOfCoordinates; ++i)
+        {
+            benchmark::DoNotOptimize(coordinatesGetter.nextValue());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * numberOfCoordinates);
+}
+BENCHMARK(BM_CoordinatesAroundOriginGetter)
+    ->Arg(4)
+    ->Arg(ChunkManager::WORLD_GENERATION_CHUNK_DISTANCE)
+    ->Arg(32);
+
+}// namespace
@@ -0,0 +1,55 @@
+#include "BenchmarkUtils/BenchmarkChunk.h"
+#include "BenchmarkUtils/BenchmarkWorld.h"
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+/**
+ * @brief Generates the terrain of the chunk at the given position over and over again, reusing the
+ * memory of the chunk.
+ */
+void generateTerrain(benchmark::State& state, const std::optional<sf::Vector3i>& chunkPosition)
+{
+    if (!chunkPosition)
+    {
+        state.SkipWithError("No such chunk was found in the searched part of the world");
+        return;
+    }
+
+    TerrainGenerator terrainGenerator(BenchmarkWorld::WORLD_SEED);
+    BenchmarkChunk chunk(*chunkPosition, terrainGenerator);
+    for (auto _: state)
+    {
+        chunk.generateTerrain(terrainGenerator);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * ChunkInterface::BLOCKS_IN_CHUNK);
+}
+
+/**
+ * @brief A chunk in the middle of a biome, generated by the biome alone.
+ */
+void BM_TerrainGeneratorOneBiome(benchmark::State& state, BiomeId biomeId)
+{
+    generateTerrain(state, BenchmarkWorld::chunkWithOnlyBiome(biomeId));
+}
+BENCHMARK_CAPTURE(BM_TerrainGeneratorOneBiome, Forest, BiomeId::Forest)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_TerrainGeneratorOneBiome, VeryDryForest, BiomeId::VeryDryForest)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_TerrainGeneratorOneBiome, Desert, BiomeId::Desert)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_TerrainGeneratorOneBiome, Snowy, BiomeId::Snowy)
+    ->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief A chunk on the border of biomes, whose surface is blended between them.
+ */
+void BM_TerrainGeneratorManyBiomes(benchmark::State& state)
+{
+    generateTerrain(state, BenchmarkWorld::chunkWithManyBiomes());
+}
+BENCHMARK(BM_TerrainGeneratorManyBiomes)->Unit(benchmark::kMicrosecond);
+
+}// namespace
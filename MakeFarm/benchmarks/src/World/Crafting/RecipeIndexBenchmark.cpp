@@ -0,0 +1,104 @@
+#include "World/Crafting/RecipeIndex.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace
+{
+
+/**
+ * @brief Random shaped recipes with up to nine ingredients out of sixty item types. The generator
+ * is seeded, so every run measures the same recipes.
+ */
+std::vector<Recipe> syntheticRecipes(int numberOfRecipes, unsigned seed = 1337)
+{
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> itemDistribution(0, 100);
+    std::vector<Recipe> recipes;
+    recipes.reserve(numberOfRecipes);
+    for (auto i = 0; i < numberOfRecipes; ++i)
+    {
+        Recipe recipe;
+        for (auto& column: recipe.layout)
+        {
+            for (auto& item: column)
+            {
+                const auto itemId = itemDistribution(generator);
+                item = itemId < 40 ? ItemId::None : static_cast<ItemId>(itemId);
+            }
+        }
+        recipe.finalItem = ItemId::Stick;
+        recipes.push_back(recipe);
+    }
+    return recipes;
+}
+
+/**
+ * @brief Layouts to look up: every other one is a recipe, the rest most likely match nothing.
+ */
+std::vector<RecipeIndex::Layout> layoutsToFind(const std::vector<Recipe>& recipes)
+{
+    const auto otherRecipes = syntheticRecipes(static_cast<int>(recipes.size()), 7331);
+    std::vector<RecipeIndex::Layout> layouts;
+    for (auto i = std::size_t{0}; i < recipes.size(); ++i)
+    {
+        layouts.push_back(i % 2 == 0 ? recipes[i].layout : otherRecipes[i].layout);
+    }
+    return layouts;
+}
+
+void BM_RecipeIndexFind(benchmark::State& state)
+{
+    const auto recipes = syntheticRecipes(static_cast<int>(state.range(0)));
+    const auto layouts = layoutsToFind(recipes);
+    const RecipeIndex recipeIndex(recipes);
+
+    auto layout = layouts.cbegin();
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(recipeIndex.find(*layout));
+        if (++layout == layouts.cend())
+        {
+            layout = layouts.cbegin();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RecipeIndexFind)->RangeMultiplier(8)->Range(8, 4096);
+
+/**
+ * @brief The comparison of the grid with every recipe, which the index replaces.
+ */
+void BM_RecipeLinearScan(benchmark::State& state)
+{
+    const auto recipes = syntheticRecipes(static_cast<int>(state.range(0)));
+    const auto layouts = layoutsToFind(recipes);
+
+    auto layout = layouts.cbegin();
+    for (auto _: state)
+    {
+        const auto foundRecipe =
+            std::find_if(recipes.cbegin(), recipes.cend(),
+                         [&layout](const Recipe& recipe) { return recipe.layout == *layout; });
+        benchmark::DoNotOptimize(foundRecipe);
+        if (++layout == layouts.cend())
+        {
+            layout = layouts.cbegin();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RecipeLinearScan)->RangeMultiplier(8)->Range(8, 4096);
+
+void BM_RecipeIndexBuild(benchmark::State& state)
+{
+    const auto recipes = syntheticRecipes(static_cast<int>(state.range(0)));
+    for (auto _: state)
+    {
+        RecipeIndex recipeIndex(recipes);
+        benchmark::DoNotOptimize(recipeIndex.recipes().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RecipeIndexBuild)->Arg(4096)->Unit(benchmark::kMicrosecond);
+
+}// namespace
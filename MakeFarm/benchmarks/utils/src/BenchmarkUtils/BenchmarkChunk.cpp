@@ -0,0 +1,281 @@
+#include "BenchmarkChunk.h"
+
+#include "World/Chunks/ChunkOccupancy.h"
+
+#include <algorithm>
+
+namespace
+{
+
+/**
+ * @brief Size in pixels of the spritesheet of blocks in the default texture pack.
+ */
+constexpr auto SPRITESHEET_SIZE = 256;
+
+/**
+ * @brief Size in pixels of a single texture in the default texture pack.
+ */
+constexpr auto TEXTURE_SIZE = 16;
+
+/**
+ * @brief Calculates the normalized texture coordinates the same way as the texture pack does.
+ * @param textureId Identifier of the texture.
+ * @return Texture coordinates of the face.
+ */
+std::vector<GLfloat> normalizedCoordinates(Block::TextureId textureId)
+{
+    const auto texturesPerRow = SPRITESHEET_SIZE / TEXTURE_SIZE;
+    const auto sizeOfPixel = 1.0f / static_cast<float>(SPRITESHEET_SIZE);
+
+    const auto left = (textureId % texturesPerRow) * TEXTURE_SIZE * sizeOfPixel;
+    const auto right = ((textureId % texturesPerRow) * TEXTURE_SIZE + TEXTURE_SIZE) * sizeOfPixel;
+    const auto bottom = (textureId / texturesPerRow) * TEXTURE_SIZE * sizeOfPixel;
+    const auto top = ((textureId / texturesPerRow) * TEXTURE_SIZE + TEXTURE_SIZE) * sizeOfPixel;
+
+    // clang-format off
+    return
+    {
+        right, top,
+        left, top,
+        left, bottom,
+        right, bottom
+    };
+    // clang-format on
+}
+
+}// namespace
+
+BenchmarkChunk::BenchmarkChunk(const sf::Vector3i& chunkPosition,
+                               TerrainGenerator& terrainGenerator)
+    : mChunkPosition(chunkPosition.x * BLOCKS_PER_X_DIMENSION,
+                     chunkPosition.y * BLOCKS_PER_Y_DIMENSION,
+                     chunkPosition.z * BLOCKS_PER_Z_DIMENSION)
+    , mChunkOfBlocks(std::make_unique<ChunkBlocks>())
+    , mMeshBuilder(mChunkPosition, normalizedCoordinates)
+{
+    generateTerrain(terrainGenerator);
+}
+
+void BenchmarkChunk::generateTerrain(TerrainGenerator& terrainGenerator)
+{
+    terrainGenerator.generateTerrain(*this, *mChunkOfBlocks);
+    mOccupancy.rebuild(*mChunkOfBlocks);
+}
+
+std::size_t BenchmarkChunk::numberOfMeshFaces() const
+{
+    return mMeshBuilder.numberOfFaces();
+}
+
+std::vector<BlockId> BenchmarkChunk::blockIds() const
+{
+    std::vector<BlockId> blockIds(BLOCKS_IN_CHUNK);
+    for (auto x = 0; x < BLOCKS_PER_X_DIMENSION; ++x)
+    {
+        for (auto y = 0; y < BLOCKS_PER_Y_DIMENSION; ++y)
+        {
+            for (auto z = 0; z < BLOCKS_PER_Z_DIMENSION; ++z)
+            {
+                blockIds[x + BLOCKS_PER_X_DIMENSION * (y + BLOCKS_PER_Y_DIMENSION * z)] =
+                    (*mChunkOfBlocks)[x][y][z]->id();
+            }
+        }
+    }
+    return blockIds;
+}
+
+void BenchmarkChunk::prepareMesh()
+{
+    mMeshBuilder.addBlocks(*this, mOccupancy,
+                           [this](Block::Face blockFace, const Block::Coordinate& localCoordinates)
+                           { return neighbourProperties(blockFace, localCoordinates); });
+}
+
+std::optional<ChunkOccupancy::Properties> BenchmarkChunk::neighbourProperties(
+    Block::Face blockFace, const Block::Coordinate& localCoordinates) const
+{
+    const auto neighbourPosition =
+        localNearbyBlockPosition(localCoordinates, Block::directionOfFace(blockFace));
+    if (!areLocalCoordinatesInsideChunk(neighbourPosition))
+    {
+        return std::nullopt;
+    }
+    return mOccupancy.properties(neighbourPosition);
+}
+
+void BenchmarkChunk::updateMesh()
+{
+}
+
+void BenchmarkChunk::fixedUpdate(const float& deltaTime)
+{
+}
+
+void BenchmarkChunk::drawTerrain(const Renderer3D& renderer3d, const sf::Shader& shader) const
+{
+}
+
+void BenchmarkChunk::drawLiquids(const Renderer3D& renderer3d, const sf::Shader& shader) const
+{
+}
+
+void BenchmarkChunk::drawFlorals(const Renderer3D& renderer3d, const sf::Shader& shader) const
+{
+}
+
+Block& BenchmarkChunk::localBlock(const Block::Coordinate& localCoordinates)
+{
+    return *(*mChunkOfBlocks)[localCoordinates.x][localCoordinates.y][localCoordinates.z];
+}
+
+void BenchmarkChunk::removeLocalBlock(const Block::Coordinate& localCoordinates)
+{
+    auto& block = localBlock(localCoordinates);
+    block.setBlockType(BlockId::Air);
+    mOccupancy.update(localCoordinates, block.type());
+}
+
+void BenchmarkChunk::tryToPlaceBlock(const BlockId& blockId,
+                                     const Block::Coordinate& localCoordinates,
+                                     std::vector<BlockId> blocksThatMightBeOverplaced,
+                                     const RebuildOperation& rebuildOperation,
+                                     const PlacementOrigin& placementOrigin)
+{
+    // Blocks which belong to the neighbouring chunks are lost, as there are no neighbours
+    if (!areLocalCoordinatesInsideChunk(localCoordinates))
+    {
+        return;
+    }
+
+    auto& block = localBlock(localCoordinates);
+    const auto canBeOverplaced =
+        std::any_of(blocksThatMightBeOverplaced.begin(), blocksThatMightBeOverplaced.end(),
+                    [&block](const auto& blockThatMightBeOverplaced)
+                    {
+                        return blockThatMightBeOverplaced == block.id() ||
+                               blockThatMightBeOverplaced == BlockId::AllBlocks;
+                    });
+    if (canBeOverplaced)
+    {
+        block.setBlockType(blockId);
+        mOccupancy.update(localCoordinates, block.type());
+    }
+}
+
+const Block& BenchmarkChunk::localBlock(const Block::Coordinate& localCoordinates) const
+{
+    return *(*mChunkOfBlocks)[localCoordinates.x][localCoordinates.y][localCoordinates.z];
+}
+
+Block::Coordinate BenchmarkChunk::globalToLocalCoordinates(
+    const Block::Coordinate& worldCoordinates) const
+{
+    return static_cast<Block::Coordinate>(worldCoordinates - mChunkPosition);
+}
+
+Block::Coordinate BenchmarkChunk::localToGlobalCoordinates(
+    const Block::Coordinate& localCoordinates) const
+{
+    return static_cast<Block::Coordinate>(mChunkPosition + localCoordinates);
+}
+
+bool BenchmarkChunk::isLocalCoordinateOnChunkEdge(const Block::Coordinate& localCoordinates)
+{
+    return localCoordinates.x == BLOCKS_PER_X_DIMENSION - 1 || localCoordinates.x == 0 ||
+           localCoordinates.y == BLOCKS_PER_Y_DIMENSION - 1 || localCoordinates.y == 0 ||
+           localCoordinates.z == BLOCKS_PER_Z_DIMENSION - 1 || localCoordinates.z == 0;
+}
+
+void BenchmarkChunk::rebuildMesh()
+{
+    mMeshBuilder.resetMeshes();
+    prepareMesh();
+}
+
+void BenchmarkChunk::rebuildSlow()
+{
+}
+
+void BenchmarkChunk::rebuildFast()
+{
+}
+
+std::vector<Direction> BenchmarkChunk::directionOfBlockFacesInContactWithOtherChunk(
+    const Block::Coordinate& localCoordinates)
+{
+    return {};
+}
+
+Block::Coordinate BenchmarkChunk::localNearbyBlockPosition(const Block::Coordinate& position,
+                                                           const Direction& direction) const
+{
+    return position.coordinateInGivenDirection(direction);
+}
+
+Block& BenchmarkChunk::localNearbyBlock(const Block::Coordinate& position,
+                                        const Direction& direction)
+{
+    return localBlock(localNearbyBlockPosition(position, direction));
+}
+
+const Block& BenchmarkChunk::localNearbyBlock(const Block::Coordinate& localCoordinates,
+                                              const Direction& direction) const
+{
+    return localBlock(localNearbyBlockPosition(localCoordinates, direction));
+}
+
+const Block::Coordinate& BenchmarkChunk::positionInBlocks() const
+{
+    return mChunkPosition;
+}
+
+void BenchmarkChunk::copyBlocksTo(BlockRegion& region) const
+{
+    mOccupancy.copyTo(region, mChunkPosition);
+}
+
+bool BenchmarkChunk::isAnyBlockWithProperty(const Block::Coordinate& min,
+                                            const Block::Coordinate& max,
+                                            BlockProperty property) const
+{
+    const auto [localMin, localMax] = ChunkOccupancy::localPartOfBox(min, max, mChunkPosition);
+    if (localMin.x > localMax.x || localMin.y > localMax.y || localMin.z > localMax.z)
+    {
+        return false;
+    }
+    return mOccupancy.isAnyBlockWithProperty(localMin, localMax, property);
+}
+
+std::optional<Block> BenchmarkChunk::neighbourBlockInGivenDirection(
+    const Block::Coordinate& blockPos, const Direction& direction)
+{
+    const auto blockNeighborPosition = localNearbyBlockPosition(blockPos, direction);
+    if (areLocalCoordinatesInsideChunk(blockNeighborPosition))
+    {
+        return std::optional<Block>(localBlock(blockNeighborPosition).id());
+    }
+    return std::nullopt;
+}
+
+Block::Coordinate BenchmarkChunk::highestSetBlock(const Block::Coordinate& blockPos)
+{
+    for (auto y = BLOCKS_PER_Y_DIMENSION - 1; y > 0; --y)
+    {
+        if (localBlock({blockPos.x, y, blockPos.z}).id() != BlockId::Air)
+        {
+            return {blockPos.x, y, blockPos.z};
+        }
+    }
+    return {blockPos.x, 0, blockPos.z};
+}
+
+void BenchmarkChunk::saveChunkData(SaveBatch batch)
+{
+}
+
+bool BenchmarkChunk::areLocalCoordinatesInsideChunk(const Block::Coordinate& localCoordinates)
+{
+    return localCoordinates.x < BLOCKS_PER_X_DIMENSION && localCoordinates.x >= 0 &&
+           localCoordinates.y < BLOCKS_PER_Y_DIMENSION && localCoordinates.y >= 0 &&
+           localCoordinates.z < BLOCKS_PER_Z_DIMENSION && localCoordinates.z >= 0;
+}
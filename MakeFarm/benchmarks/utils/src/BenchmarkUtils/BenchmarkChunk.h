@@ -0,0 +1,99 @@
+#pragma once
+#include "Renderer3D/Meshes/Builders/ChunkMeshBuilder.h"
+#include "World/Chunks/ChunkInterface.h"
+#include "World/Chunks/ChunkOccupancy.h"
+#include "World/Chunks/TerrainGenerator.h"
+
+/**
+ * @brief Chunk that only holds its blocks. It does not draw anything and does not know about its
+ * neighbours, so terrain can be generated without a window, textures or a chunk manager.
+ *
+ * Its mesh is built by the same builder as the mesh of the game chunk, except that the texture
+ * coordinates are calculated for a spritesheet of the default size instead of being read from the
+ * texture pack, which needs the OpenGL context. Faces on the edges of the chunk are not built, as
+ * in the game when the neighbouring chunk is not loaded yet.
+ */
+class BenchmarkChunk : public ChunkInterface
+{
+public:
+    /**
+     * @brief Creates a chunk filled with the generated terrain.
+     * @param chunkPosition Position of the chunk in the chunk grid.
+     * @param terrainGenerator Generator of the terrain of the world.
+     */
+    BenchmarkChunk(const sf::Vector3i& chunkPosition, TerrainGenerator& terrainGenerator);
+
+    /**
+     * @brief Returns the block ids of the chunk, indexed the same as the one-dimensional
+     * representation of the chunk.
+     * @return Block ids of the chunk.
+     */
+    [[nodiscard]] std::vector<BlockId> blockIds() const;
+
+    /**
+     * @brief Fills the chunk with the terrain generated anew, reusing the memory of the chunk.
+     * @param terrainGenerator Generator of the terrain of the world.
+     */
+    void generateTerrain(TerrainGenerator& terrainGenerator);
+
+    /**
+     * @brief Returns the number of faces in the most recently built meshes of the chunk.
+     * @return Number of faces in the terrain, fluid and floral meshes together.
+     */
+    [[nodiscard]] std::size_t numberOfMeshFaces() const;
+
+    void prepareMesh() override;
+    void updateMesh() override;
+    void fixedUpdate(const float& deltaTime) override;
+    void drawTerrain(const Renderer3D& renderer3d, const sf::Shader& shader) const override;
+    void drawLiquids(const Renderer3D& renderer3d, const sf::Shader& shader) const override;
+    void drawFlorals(const Renderer3D& renderer3d, const sf::Shader& shader) const override;
+    Block& localBlock(const Block::Coordinate& localCoordinates) override;
+    void removeLocalBlock(const Block::Coordinate& localCoordinates) override;
+    void tryToPlaceBlock(const BlockId& blockId, const Block::Coordinate& localCoordinates,
+                         std::vector<BlockId> blocksThatMightBeOverplaced,
+                         const RebuildOperation& rebuildOperation,
+                         const PlacementOrigin& placementOrigin) override;
+    const Block& localBlock(const Block::Coordinate& localCoordinates) const override;
+    Block::Coordinate globalToLocalCoordinates(
+        const Block::Coordinate& worldCoordinates) const override;
+    Block::Coordinate localToGlobalCoordinates(
+        const Block::Coordinate& localCoordinates) const override;
+    bool isLocalCoordinateOnChunkEdge(const Block::Coordinate& localCoordinates) override;
+    void rebuildMesh() override;
+    void rebuildSlow() override;
+    void rebuildFast() override;
+    std::vector<Direction> directionOfBlockFacesInContactWithOtherChunk(
+        const Block::Coordinate& localCoordinates) override;
+    Block::Coordinate localNearbyBlockPosition(const Block::Coordinate& position,
+                                               const Direction& direction) const override;
+    Block& localNearbyBlock(const Block::Coordinate& position, const Direction& direction) override;
+    const Block& localNearbyBlock(const Block::Coordinate& localCoordinates,
+                                  const Direction& direction) const override;
+    const Block::Coordinate& positionInBlocks() const override;
+    void copyBlocksTo(BlockRegion& region) const override;
+    bool isAnyBlockWithProperty(const Block::Coordinate& min, const Block::Coordinate& max,
+                                BlockProperty property) const override;
+    std::optional<Block> neighbourBlockInGivenDirection(const Block::Coordinate& blockPos,
+                                                        const Direction& direction) override;
+    Block::Coordinate highestSetBlock(const Block::Coordinate& blockPos) override;
+    void saveChunkData(SaveBatch batch) override;
+
+private:
+    static bool areLocalCoordinatesInsideChunk(const Block::Coordinate& localCoordinates);
+
+    /**
+     * @brief Returns the properties of the block next to the given face.
+     * @param blockFace The face of the block.
+     * @param localCoordinates Local coordinates of the block.
+     * @return Properties of the neighbouring block, or nothing if it is outside the chunk.
+     */
+    [[nodiscard]] std::optional<ChunkOccupancy::Properties> neighbourProperties(
+        Block::Face blockFace, const Block::Coordinate& localCoordinates) const;
+
+private:
+    Block::Coordinate mChunkPosition;
+    std::unique_ptr<ChunkBlocks> mChunkOfBlocks;
+    ChunkOccupancy mOccupancy;
+    ChunkMeshBuilder mMeshBuilder;
+};
@@ -0,0 +1,80 @@
+#include "BenchmarkWorld.h"
+
+#include "World/Chunks/CoordinatesAroundOriginGetter.h"
+
+const std::optional<sf::Vector3i>& BenchmarkWorld::chunkWithOnlyBiome(BiomeId biomeId)
+{
+    static std::map<BiomeId, std::optional<sf::Vector3i>> chunks;
+
+    auto foundChunk = chunks.find(biomeId);
+    if (foundChunk == chunks.end())
+    {
+        const auto chunk = findChunk([biomeId](const sf::Vector3i& chunkPosition)
+                                     { return isChunkOnlyOfBiome(chunkPosition, biomeId); });
+        foundChunk = chunks.emplace(biomeId, chunk).first;
+    }
+    return foundChunk->second;
+}
+
+const std::optional<sf::Vector3i>& BenchmarkWorld::chunkWithManyBiomes()
+{
+    static const auto chunk = findChunk(
+        [](const sf::Vector3i& chunkPosition)
+        {
+            auto& cornerBiome = terrainGenerator().deduceBiome(
+                chunkPosition.x * ChunkInterface::BLOCKS_PER_X_DIMENSION,
+                chunkPosition.z * ChunkInterface::BLOCKS_PER_Z_DIMENSION);
+            return !isChunkOnlyOfBiome(chunkPosition, cornerBiome.biomeId());
+        });
+    return chunk;
+}
+
+TerrainGenerator& BenchmarkWorld::terrainGenerator()
+{
+    static TerrainGenerator terrainGenerator(WORLD_SEED);
+    return terrainGenerator;
+}
+
+bool BenchmarkWorld::isChunkOnlyOfBiome(const sf::Vector3i& chunkPosition, BiomeId biomeId)
+{
+    const auto chunkX = chunkPosition.x * ChunkInterface::BLOCKS_PER_X_DIMENSION;
+    const auto chunkZ = chunkPosition.z * ChunkInterface::BLOCKS_PER_Z_DIMENSION;
+
+    // Most chunks are rejected already by the biome in their middle
+    if (terrainGenerator()
+            .deduceBiome(chunkX + ChunkInterface::BLOCKS_PER_X_DIMENSION / 2,
+                         chunkZ + ChunkInterface::BLOCKS_PER_Z_DIMENSION / 2)
+            .biomeId() != biomeId)
+    {
+        return false;
+    }
+
+    for (auto x = -1; x <= ChunkInterface::BLOCKS_PER_X_DIMENSION; ++x)
+    {
+        for (auto z = -1; z <= ChunkInterface::BLOCKS_PER_Z_DIMENSION; ++z)
+        {
+            if (terrainGenerator().deduceBiome(chunkX + x, chunkZ + z).biomeId() != biomeId)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::optional<sf::Vector3i> BenchmarkWorld::findChunk(
+    const std::function<bool(const sf::Vector3i&)>& isSearchedChunk)
+{
+    constexpr auto SEARCH_SIDE = 2 * SEARCH_DISTANCE + 1;
+
+    CoordinatesAroundOriginGetter chunkPositionGetter({0, 0, 0});
+    for (auto i = 0; i < SEARCH_SIDE * SEARCH_SIDE; ++i)
+    {
+        const auto chunkPosition = chunkPositionGetter.nextValue();
+        if (isSearchedChunk(chunkPosition))
+        {
+            return chunkPosition;
+        }
+    }
+    return std::nullopt;
+}
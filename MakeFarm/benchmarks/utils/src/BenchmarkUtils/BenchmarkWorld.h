@@ -0,0 +1,68 @@
+#pragma once
+#include <functional>
+#include <map>
+#include <optional>
+
+#include "World/Biomes/BiomeId.h"
+#include "World/Chunks/TerrainGenerator.h"
+
+/**
+ * @brief Finds the chunks of the generated world on which the benchmarks are run. The world
+ * always has the same seed and the chunks are searched in the same order, so every run measures
+ * the same terrain. Every chunk is searched only once, as benchmarks are run many times.
+ */
+class BenchmarkWorld
+{
+public:
+    /**
+     * @brief Seed of the world in which the chunks are searched.
+     */
+    static constexpr int WORLD_SEED = 1337;
+
+    /**
+     * @brief Distance in chunks from the origin of the world up to which the chunks are searched.
+     */
+    static constexpr int SEARCH_DISTANCE = 256;
+
+    /**
+     * @brief Finds the chunk closest to the origin of the world which contains only the given
+     * biome, also on the blocks around it.
+     * @param biomeId The biome the chunk should contain.
+     * @return Position of the chunk in the chunk grid, or nothing if there is no such chunk within
+     * the search distance.
+     */
+    static const std::optional<sf::Vector3i>& chunkWithOnlyBiome(BiomeId biomeId);
+
+    /**
+     * @brief Finds the chunk closest to the origin of the world which contains more than one
+     * biome, so its terrain is blended between them.
+     * @return Position of the chunk in the chunk grid, or nothing if there is no such chunk within
+     * the search distance.
+     */
+    static const std::optional<sf::Vector3i>& chunkWithManyBiomes();
+
+private:
+    /**
+     * @brief Returns the generator deducing the biomes of the world.
+     * @return Generator of the terrain of the world.
+     */
+    static TerrainGenerator& terrainGenerator();
+
+    /**
+     * @brief Checks whether the chunk and the blocks around it contain only the given biome.
+     * @param chunkPosition Position of the chunk in the chunk grid.
+     * @param biomeId The biome the chunk should contain.
+     * @return True if every block of the chunk and around it belongs to the biome, false otherwise.
+     */
+    static bool isChunkOnlyOfBiome(const sf::Vector3i& chunkPosition, BiomeId biomeId);
+
+    /**
+     * @brief Returns the first chunk around the origin of the world which is the searched one.
+     * @param isSearchedChunk Function checking whether the chunk at the given position is the
+     * searched one.
+     * @return Position of the chunk in the chunk grid, or nothing if there is no such chunk within
+     * the search distance.
+     */
+    static std::optional<sf::Vector3i> findChunk(
+        const std::function<bool(const sf::Vector3i&)>& isSearchedChunk);
+};
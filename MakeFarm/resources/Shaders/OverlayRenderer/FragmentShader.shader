@@ -0,0 +1,10 @@
+#version 330 core
+
+layout(location = 0) out vec4 FragColor;
+
+in vec4 g_Color;
+
+void main()
+{
+	FragColor = g_Color;
+};
\ No newline at end of file
@@ -0,0 +1,55 @@
+#version 330 core
+
+layout(lines) in;
+layout(triangle_strip, max_vertices = 4) out;
+
+uniform vec2 u_ViewportSize;
+uniform float u_LineWidth;
+
+in vec4 v_Color[];
+
+out vec4 g_Color;
+
+// Lines are cut just in front of the camera, as points behind it can not be projected on the screen
+const float MIN_DEPTH = 0.0001;
+
+void main()
+{
+	vec4 from = gl_in[0].gl_Position;
+	vec4 to = gl_in[1].gl_Position;
+	if (from.w < MIN_DEPTH && to.w < MIN_DEPTH)
+	{
+		return;
+	}
+	if (from.w < MIN_DEPTH)
+	{
+		from = mix(from, to, (MIN_DEPTH - from.w) / (to.w - from.w));
+	}
+	else if (to.w < MIN_DEPTH)
+	{
+		to = mix(to, from, (MIN_DEPTH - to.w) / (from.w - to.w));
+	}
+
+	// The line is widened perpendicularly to its direction on the screen
+	vec2 halfViewportSize = u_ViewportSize * 0.5;
+	vec2 direction = to.xy / to.w * halfViewportSize - from.xy / from.w * halfViewportSize;
+	if (dot(direction, direction) < 0.000001)
+	{
+		direction = vec2(1.0, 0.0);
+	}
+	vec2 offset = normalize(vec2(-direction.y, direction.x)) * u_LineWidth * 0.5 / halfViewportSize;
+
+	gl_Position = vec4(from.xy + offset * from.w, from.zw);
+	g_Color = v_Color[0];
+	EmitVertex();
+	gl_Position = vec4(from.xy - offset * from.w, from.zw);
+	g_Color = v_Color[0];
+	EmitVertex();
+	gl_Position = vec4(to.xy + offset * to.w, to.zw);
+	g_Color = v_Color[1];
+	EmitVertex();
+	gl_Position = vec4(to.xy - offset * to.w, to.zw);
+	g_Color = v_Color[1];
+	EmitVertex();
+	EndPrimitive();
+}
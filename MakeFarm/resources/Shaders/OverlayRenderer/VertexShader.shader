@@ -1,10 +1,14 @@
 #version 330 core
 
 layout(location = 0) in vec3 position;
+layout(location = 1) in vec4 color;
 
 uniform mat4 u_ViewProjection;
 
+out vec4 v_Color;
+
 void main()
 {
 	gl_Position = u_ViewProjection * vec4(position, 1.0);
+	v_Color = color;
 };
\ No newline at end of file
@@ -1,15 +0,0 @@
-#version 330
-
-layout (triangles) in;
-layout (line_strip, max_vertices=3) out;
-
-void main(void)
-{
-    int i;
-    for (i = 0; i < gl_in.length(); i++)
-    {
-        gl_Position = gl_in[i].gl_Position; //Pass through
-        EmitVertex();
-    }
-    EndPrimitive();
-}
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "pch.h"
 #include <States/Application_States/MainMenuState.h>
 
+#include "Resources/ResourceBundle.h"
 #include "States/Application_States/DeathState.h"
 #include "States/Application_States/ExitGameState.h"
 #include "States/Application_States/GameState.h"
@@ -9,6 +10,9 @@
 #include "States/Application_States/PauseState.h"
 #include "States/States.h"
 #include "Utils/Mouse.h"
+#include "World/Block/BlockMap.h"
+#include "World/Crafting/RecipeContainer.h"
+#include "World/Item/ItemMap.h"
 
 
 constexpr int FRAMES_PER_SECOND = 120;
@@ -170,48 +174,63 @@ void Game::loadResources()
     auto& fonts = mGameResources.fontManager;
     auto& texturePack = mGameResources.texturePack;
 
-    fonts.storeResource(FontId::ArialNarrow, "resources/fonts/arial_narrow.ttf");
+    ResourceLoader loader;
+    loader.loadFont(fonts, FontId::ArialNarrow, "resources/fonts/arial_narrow.ttf");
 
     std::string guiTexturesFolder = "resources/textures/gui/";
-    loadInventoryTextures(guiTexturesFolder);
-    loadHealthbarTextures(guiTexturesFolder);
-    loadOxygenbarTextures(guiTexturesFolder);
-
-    texturePack.loadTexturePack("defaultTextures");
+    loadInventoryTextures(loader, guiTexturesFolder);
+    loadHealthbarTextures(loader, guiTexturesFolder);
+    loadOxygenbarTextures(loader, guiTexturesFolder);
+
+    loader.loadTexturePack(texturePack, "defaultTextures");
+
+    // Blocks, items and recipes are read now rather than by the first chunk generated in the
+    // background or the first crafting, and baked into the bundle for the next start
+    loader.run("block, item and recipe tables",
+               []
+               {
+                   BlockMap::blockMap();
+                   ItemMap::itemMap();
+                   RecipeContainer::recipeContainer();
+                   ResourceBundle::bakeIfOutdated();
+               });
+
+    loader.finish();
+    loader.report(std::cout);
 }
 
-void Game::loadOxygenbarTextures(const std::string& guiTexturesFolder)
+void Game::loadOxygenbarTextures(ResourceLoader& loader, const std::string& guiTexturesFolder)
 {
     auto& textures = mGameResources.textureManager;
     auto oxygenFolder = guiTexturesFolder + "oxygenbar/";
-    textures.storeResource(TextureManagerId::GUI_Oxygenbar_EmptyOxygen,
-                           oxygenFolder + "empty_oxygen.png");
-    textures.storeResource(TextureManagerId::GUI_Oxygenbar_FullOxygen,
-                           oxygenFolder + "full_oxygen.png");
-    textures.storeResource(TextureManagerId::GUI_Oxygenbar_HalfOxygen,
-                           oxygenFolder + "half_oxygen.png");
+    loader.loadTexture(textures, TextureManagerId::GUI_Oxygenbar_EmptyOxygen,
+                       oxygenFolder + "empty_oxygen.png");
+    loader.loadTexture(textures, TextureManagerId::GUI_Oxygenbar_FullOxygen,
+                       oxygenFolder + "full_oxygen.png");
+    loader.loadTexture(textures, TextureManagerId::GUI_Oxygenbar_HalfOxygen,
+                       oxygenFolder + "half_oxygen.png");
 }
 
-void Game::loadHealthbarTextures(const std::string& guiTexturesFolder)
+void Game::loadHealthbarTextures(ResourceLoader& loader, const std::string& guiTexturesFolder)
 {
     auto& textures = mGameResources.textureManager;
-    textures.storeResource(TextureManagerId::GUI_Healthbar_EmptyHeart,
-                           guiTexturesFolder + "healthbar/empty_heart.png");
-    textures.storeResource(TextureManagerId::GUI_Healthbar_FullHeart,
-                           guiTexturesFolder + "healthbar/full_heart.png");
-    textures.storeResource(TextureManagerId::GUI_Healthbar_HalfHeart,
-                           guiTexturesFolder + "healthbar/half_heart.png");
+    loader.loadTexture(textures, TextureManagerId::GUI_Healthbar_EmptyHeart,
+                       guiTexturesFolder + "healthbar/empty_heart.png");
+    loader.loadTexture(textures, TextureManagerId::GUI_Healthbar_FullHeart,
+                       guiTexturesFolder + "healthbar/full_heart.png");
+    loader.loadTexture(textures, TextureManagerId::GUI_Healthbar_HalfHeart,
+                       guiTexturesFolder + "healthbar/half_heart.png");
 }
 
-void Game::loadInventoryTextures(const std::string& guiTexturesFolder)
+void Game::loadInventoryTextures(ResourceLoader& loader, const std::string& guiTexturesFolder)
 {
     auto& textures = mGameResources.textureManager;
-    textures.storeResource(TextureManagerId::GUI_Inventory_Background,
-                           guiTexturesFolder + "inventory_background.png");
-    textures.storeResource(TextureManagerId::GUI_Inventory_Slot,
-                           guiTexturesFolder + "inventory_slot.png");
-    textures.storeResource(TextureManagerId::GUI_Inventory_Selected_Block,
-                           guiTexturesFolder + "hotbar/selected_block.png");
-    textures.storeResource(TextureManagerId::GUI_Inventory_Unselected_Block,
-                           guiTexturesFolder + "hotbar/unselected_block.png");
+    loader.loadTexture(textures, TextureManagerId::GUI_Inventory_Background,
+                       guiTexturesFolder + "inventory_background.png");
+    loader.loadTexture(textures, TextureManagerId::GUI_Inventory_Slot,
+                       guiTexturesFolder + "inventory_slot.png");
+    loader.loadTexture(textures, TextureManagerId::GUI_Inventory_Selected_Block,
+                       guiTexturesFolder + "hotbar/selected_block.png");
+    loader.loadTexture(textures, TextureManagerId::GUI_Inventory_Unselected_Block,
+                       guiTexturesFolder + "hotbar/unselected_block.png");
 }
@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include "Resources/ResourceLoader.h"
 #include "Resources/Resources.h"
 #include "States/StateStack.h"
 
@@ -87,21 +88,24 @@ private:
 
     /**
      * @brief Loads the textures needed for the inventory displaying.
+     * @param loader Loader decoding the textures in parallel
      * @param guiTexturesFolder Folder that stores textures for the GUI
      */
-    void loadInventoryTextures(const std::string& guiTexturesFolder);
+    void loadInventoryTextures(ResourceLoader& loader, const std::string& guiTexturesFolder);
 
     /**
      * @brief Loads the textures needed for the healthbar displaying.
+     * @param loader Loader decoding the textures in parallel
      * @param guiTexturesFolder Folder that stores textures for the GUI
      */
-    void loadHealthbarTextures(const std::string& guiTexturesFolder);
+    void loadHealthbarTextures(ResourceLoader& loader, const std::string& guiTexturesFolder);
 
     /**
      * @brief Loads the textures needed for the oxygenbar displaying.
+     * @param loader Loader decoding the textures in parallel
      * @param guiTexturesFolder Folder that stores textures for the GUI
      */
-    void loadOxygenbarTextures(const std::string& guiTexturesFolder);
+    void loadOxygenbarTextures(ResourceLoader& loader, const std::string& guiTexturesFolder);
 
     /**
      * @brief The time it takes for one game frame to be generated.
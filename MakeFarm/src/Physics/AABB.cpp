@@ -3,29 +3,24 @@
 
 AABB::AABB(sf::Vector3f boxSize)
     : mBoxSize(boxSize)
-    , mWireframe(sf::Vector3f{0, 0, 0}, boxSize)
-    , mMin(mWireframe.min)
-    , mMax(mWireframe.max)
+    , mBox{{0, 0, 0}, {boxSize.x, boxSize.y, boxSize.z}}
 {
 }
 
-AABB::AABB(const AABB& rhs)
-    : mBoxSize(rhs.mBoxSize)
-    , mWireframe(rhs.mWireframe)
-    , mMin(mWireframe.min)
-    , mMax(mWireframe.max)
+bool AABB::intersect(const AABB& rhs) const
 {
+    return mBox.intersects(rhs.mBox);
 }
 
-bool AABB::intersect(const AABB& rhs) const
+WireframeBlock AABB::collisionBox() const
 {
-    return (mMin.x <= rhs.mMax.x && mMax.x >= rhs.mMin.x && mMin.y <= rhs.mMax.y &&
-            mMax.y >= rhs.mMin.y && mMin.z <= rhs.mMax.z && mMax.z >= rhs.mMin.z);
+    return WireframeBlock(sf::Vector3f{mBox.min[0], mBox.min[1], mBox.min[2]},
+                          sf::Vector3f{mBox.max[0], mBox.max[1], mBox.max[2]});
 }
 
-WireframeBlock AABB::collisionBox() const
+const Box3f& AABB::box() const
 {
-    return mWireframe;
+    return mBox;
 }
 
 sf::Vector3f AABB::collisionBoxSize() const
@@ -35,5 +30,5 @@ sf::Vector3f AABB::collisionBoxSize() const
 
 bool AABB::operator==(const AABB& rhs) const
 {
-    return mMin == rhs.mMin && mMax == rhs.mMax;
+    return mBox == rhs.mBox;
 }
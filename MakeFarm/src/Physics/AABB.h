@@ -1,10 +1,14 @@
 #pragma once
+#include "Physics/Box3f.h"
 #include "World/Block/WireframeBlock.h"
 #include <SFML/System/Vector3.hpp>
 
 /**
  * @brief Axis-aligned bounding boxes allows to determine whether two classes of type AABB
  * collide with each other. They represent cubes in 3D space.
+ *
+ * It is a thin wrapper around Box3f that remembers the size of the box, so it can be placed at
+ * different positions. Many boxes should be tested against each other with Box3f directly.
  */
 class AABB
 {
@@ -27,10 +31,6 @@ public:
      */
     AABB(sf::Vector3f boxSize);
 
-    /**
-     * @brief Creates a cube with empty values not yet filled in.
-     */
-    AABB(const AABB&);
 
     /**
      * @brief It compares whether the two AABBs are the same, that is, whether the sizes of the
@@ -64,6 +64,12 @@ public:
      */
     [[nodiscard]] WireframeBlock collisionBox() const;
 
+    /**
+     * @brief Returns the plain box occupied by the cube, to be stored in arrays of boxes.
+     * @return The box with the coordinates given on a non-metric scale.
+     */
+    [[nodiscard]] const Box3f& box() const;
+
     /**
      * @brief Returns the size of the cube (in x, y, z).
      * @return Size of the cube (in x, y, z).
@@ -72,10 +78,7 @@ public:
 
 private:
     sf::Vector3f mBoxSize;
-    WireframeBlock mWireframe;
-
-    sf::Vector3f& mMin;
-    sf::Vector3f& mMax;
+    Box3f mBox;
 };
 
 template<typename Vector3>
@@ -84,36 +87,36 @@ void AABB::updatePosition(const Vector3& position, const AABB::RelativeTo& relat
     switch (relativeTo)
     {
         case RelativeTo::LeftBottomBack:
-            mMin.x = position.x;
-            mMax.x = position.x + mBoxSize.x;
-            mMin.y = position.y;
-            mMax.y = position.y + mBoxSize.y;
-            mMin.z = position.z;
-            mMax.z = position.z + mBoxSize.z;
+            mBox.min[0] = position.x;
+            mBox.max[0] = position.x + mBoxSize.x;
+            mBox.min[1] = position.y;
+            mBox.max[1] = position.y + mBoxSize.y;
+            mBox.min[2] = position.z;
+            mBox.max[2] = position.z + mBoxSize.z;
             break;
         case RelativeTo::Center:
-            mMin.x = position.x - (mBoxSize.x / 2.f);
-            mMax.x = position.x + (mBoxSize.x / 2.f);
-            mMin.y = position.y - (mBoxSize.y / 2.f);
-            mMax.y = position.y + (mBoxSize.y / 2.f);
-            mMin.z = position.z - (mBoxSize.z / 2.f);
-            mMax.z = position.z + (mBoxSize.z / 2.f);
+            mBox.min[0] = position.x - (mBoxSize.x / 2.f);
+            mBox.max[0] = position.x + (mBoxSize.x / 2.f);
+            mBox.min[1] = position.y - (mBoxSize.y / 2.f);
+            mBox.max[1] = position.y + (mBoxSize.y / 2.f);
+            mBox.min[2] = position.z - (mBoxSize.z / 2.f);
+            mBox.max[2] = position.z + (mBoxSize.z / 2.f);
             break;
         case RelativeTo::UpperCenter:
-            mMin.x = position.x - (mBoxSize.x / 2.f);
-            mMax.x = position.x + (mBoxSize.x / 2.f);
-            mMin.y = position.y - (mBoxSize.y);
-            mMax.y = position.y;
-            mMin.z = position.z - (mBoxSize.z / 2.f);
-            mMax.z = position.z + (mBoxSize.z / 2.f);
+            mBox.min[0] = position.x - (mBoxSize.x / 2.f);
+            mBox.max[0] = position.x + (mBoxSize.x / 2.f);
+            mBox.min[1] = position.y - (mBoxSize.y);
+            mBox.max[1] = position.y;
+            mBox.min[2] = position.z - (mBoxSize.z / 2.f);
+            mBox.max[2] = position.z + (mBoxSize.z / 2.f);
             break;
         case RelativeTo::BottomCenter:
-            mMin.x = position.x - (mBoxSize.x / 2.f);
-            mMax.x = position.x + (mBoxSize.x / 2.f);
-            mMin.y = position.y;
-            mMax.y = position.y + (mBoxSize.y);
-            mMin.z = position.z - (mBoxSize.z / 2.f);
-            mMax.z = position.z + (mBoxSize.z / 2.f);
+            mBox.min[0] = position.x - (mBoxSize.x / 2.f);
+            mBox.max[0] = position.x + (mBoxSize.x / 2.f);
+            mBox.min[1] = position.y;
+            mBox.max[1] = position.y + (mBoxSize.y);
+            mBox.min[2] = position.z - (mBoxSize.z / 2.f);
+            mBox.max[2] = position.z + (mBoxSize.z / 2.f);
             break;
     }
 }
\ No newline at end of file
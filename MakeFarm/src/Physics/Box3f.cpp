@@ -0,0 +1,114 @@
+#include "Box3f.h"
+#include "pch.h"
+
+#include <algorithm>
+#include <cstddef>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #define BOX3F_USE_SSE
+    #include <immintrin.h>
+#endif
+
+namespace
+{
+
+#ifdef BOX3F_USE_SSE
+/**
+ * Mask of the comparison results of the x, y and z lanes
+ */
+constexpr int XYZ_LANES = 0b111;
+
+/**
+ * @brief Loads the corner of the box with the lowest coordinates. The last lane holds the x
+ * coordinate of the other corner and must be ignored.
+ */
+__m128 loadMin(const Box3f& box)
+{
+    return _mm_loadu_ps(reinterpret_cast<const float*>(&box));
+}
+
+/**
+ * @brief Loads the corner of the box with the highest coordinates. The last lane repeats the z
+ * coordinate and must be ignored.
+ */
+__m128 loadMax(const Box3f& box)
+{
+    // Loading four floats starting at the max corner would read past the end of the box
+    const auto lastFourFloats = _mm_loadu_ps(reinterpret_cast<const float*>(&box) + 2);
+    return _mm_shuffle_ps(lastFourFloats, lastFourFloats, _MM_SHUFFLE(3, 3, 2, 1));
+}
+#endif
+
+}// namespace
+
+bool Box3f::intersects(const Box3f& rhs) const
+{
+    return min[0] <= rhs.max[0] && max[0] >= rhs.min[0] && min[1] <= rhs.max[1] &&
+           max[1] >= rhs.min[1] && min[2] <= rhs.max[2] && max[2] >= rhs.min[2];
+}
+
+std::size_t Box3f::intersectEach(const Box3f& box, std::span<const Box3f> boxes,
+                                 std::span<std::uint8_t> intersections)
+{
+    std::size_t numberOfIntersections = 0;
+    std::size_t index = 0;
+
+#ifdef BOX3F_USE_SSE
+    const auto boxMin = loadMin(box);
+    const auto boxMax = loadMax(box);
+    #ifdef __AVX__
+    // Two boxes of the array are compared in a single register
+    const auto boxMinTwice = _mm256_insertf128_ps(_mm256_castps128_ps256(boxMin), boxMin, 1);
+    const auto boxMaxTwice = _mm256_insertf128_ps(_mm256_castps128_ps256(boxMax), boxMax, 1);
+    for (; index + 1 < boxes.size(); index += 2)
+    {
+        const auto otherMin = _mm256_insertf128_ps(
+            _mm256_castps128_ps256(loadMin(boxes[index])), loadMin(boxes[index + 1]), 1);
+        const auto otherMax = _mm256_insertf128_ps(
+            _mm256_castps128_ps256(loadMax(boxes[index])), loadMax(boxes[index + 1]), 1);
+        const auto overlaps = _mm256_and_ps(_mm256_cmp_ps(boxMinTwice, otherMax, _CMP_LE_OQ),
+                                            _mm256_cmp_ps(boxMaxTwice, otherMin, _CMP_GE_OQ));
+        const auto mask = _mm256_movemask_ps(overlaps);
+        intersections[index] = (mask & XYZ_LANES) == XYZ_LANES;
+        intersections[index + 1] = ((mask >> 4) & XYZ_LANES) == XYZ_LANES;
+        numberOfIntersections += intersections[index] + intersections[index + 1];
+    }
+    #endif
+    for (; index < boxes.size(); ++index)
+    {
+        const auto overlaps = _mm_and_ps(_mm_cmple_ps(boxMin, loadMax(boxes[index])),
+                                         _mm_cmpge_ps(boxMax, loadMin(boxes[index])));
+        intersections[index] = (_mm_movemask_ps(overlaps) & XYZ_LANES) == XYZ_LANES;
+        numberOfIntersections += intersections[index];
+    }
+#else
+    for (; index < boxes.size(); ++index)
+    {
+        intersections[index] = box.intersects(boxes[index]);
+        numberOfIntersections += intersections[index];
+    }
+#endif
+
+    return numberOfIntersections;
+}
+
+bool Box3f::intersectsAny(const Box3f& box, std::span<const Box3f> boxes)
+{
+#ifdef BOX3F_USE_SSE
+    const auto boxMin = loadMin(box);
+    const auto boxMax = loadMax(box);
+    for (const auto& other: boxes)
+    {
+        const auto overlaps = _mm_and_ps(_mm_cmple_ps(boxMin, loadMax(other)),
+                                         _mm_cmpge_ps(boxMax, loadMin(other)));
+        if ((_mm_movemask_ps(overlaps) & XYZ_LANES) == XYZ_LANES)
+        {
+            return true;
+        }
+    }
+    return false;
+#else
+    return std::any_of(boxes.begin(), boxes.end(),
+                       [&box](const Box3f& other) { return box.intersects(other); });
+#endif
+}
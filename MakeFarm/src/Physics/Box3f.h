@@ -0,0 +1,52 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+/**
+ * @brief Plain axis-aligned box made of six packed floats: three of the corner with the lowest
+ * coordinates followed by three of the corner with the highest coordinates.
+ *
+ * It is trivially copyable and has no padding, so arrays of boxes can be stored and tested against
+ * a single box at once with the vector instructions of the processor. The boxes touching with
+ * their faces, edges or corners are considered to intersect.
+ */
+struct Box3f
+{
+    std::array<float, 3> min;
+    std::array<float, 3> max;
+
+    /**
+     * @brief Checks whether the boxes intersect.
+     * @param rhs The box with which the intersection is checked
+     * @return True if the boxes intersect, false otherwise
+     */
+    [[nodiscard]] bool intersects(const Box3f& rhs) const;
+
+    /**
+     * @brief Tests the box against every box of the array, several boxes at a time where the
+     * processor allows it.
+     * @param box The box tested against the array
+     * @param boxes Array of boxes
+     * @param intersections For each box of the array, set to 1 if it intersects the box and to 0
+     * otherwise. It must be as long as the array of boxes.
+     * @return Number of boxes of the array that intersect the box.
+     */
+    static std::size_t intersectEach(const Box3f& box, std::span<const Box3f> boxes,
+                                     std::span<std::uint8_t> intersections);
+
+    /**
+     * @brief Checks whether the box intersects any box of the array.
+     * @param box The box tested against the array
+     * @param boxes Array of boxes
+     * @return True if any box of the array intersects the box, false otherwise.
+     */
+    [[nodiscard]] static bool intersectsAny(const Box3f& box, std::span<const Box3f> boxes);
+
+    bool operator==(const Box3f& rhs) const = default;
+};
+
+static_assert(std::is_trivial_v<Box3f> && std::is_standard_layout_v<Box3f>,
+              "Box3f must stay a plain type to be stored in arrays and loaded as a whole");
+static_assert(sizeof(Box3f) == 6 * sizeof(float), "Box3f must consist of six packed floats");
@@ -0,0 +1,92 @@
+#include "SweptAABB.h"
+#include "pch.h"
+
+#include <limits>
+
+SweptAABB::SweptAABB(const sf::Vector3f& min, const sf::Vector3f& max)
+    : mMin{min.x, min.y, min.z}
+    , mMax{max.x, max.y, max.z}
+{
+}
+
+std::optional<SweptAABB::Impact> SweptAABB::impactWithBlock(
+    const std::array<float, 3>& displacement, const Block::Coordinate& block) const
+{
+    constexpr auto INFINITE_TIME = std::numeric_limits<float>::infinity();
+    const auto blockPosition = std::array<int, 3>{block.x, block.y, block.z};
+
+    std::array<float, 3> entry;
+    std::array<float, 3> stopTime;
+    std::array<float, 3> stopPosition;
+    auto earliestExit = INFINITE_TIME;
+    for (auto axis = 0; axis < 3; ++axis)
+    {
+        const auto blockMin = static_cast<float>(blockPosition[axis] * Block::BLOCK_SIZE);
+        const auto blockMax = blockMin + Block::BLOCK_SIZE;
+
+        // The box overlaps the block on this axis between its entry and exit. If it is already
+        // past the surface of the block, it overlaps the block on this axis from the start
+        entry[axis] = -INFINITE_TIME;
+        stopTime[axis] = -INFINITE_TIME;
+        stopPosition[axis] = 0.f;
+        auto exit = INFINITE_TIME;
+        if (displacement[axis] > 0)
+        {
+            stopPosition[axis] = blockMin - CONTACT_EPSILON;
+            if (mMax[axis] <= blockMin)
+            {
+                entry[axis] = (blockMin - mMax[axis]) / displacement[axis];
+                stopTime[axis] = (stopPosition[axis] - mMax[axis]) / displacement[axis];
+            }
+            exit = (blockMax - mMin[axis]) / displacement[axis];
+        }
+        else if (displacement[axis] < 0)
+        {
+            stopPosition[axis] = blockMax + CONTACT_EPSILON;
+            if (mMin[axis] >= blockMax)
+            {
+                entry[axis] = (blockMax - mMin[axis]) / displacement[axis];
+                stopTime[axis] = (stopPosition[axis] - mMin[axis]) / displacement[axis];
+            }
+            exit = (blockMin - mMax[axis]) / displacement[axis];
+        }
+        else if (mMax[axis] <= blockMin || mMin[axis] >= blockMax)
+        {
+            return std::nullopt;
+        }
+        earliestExit = std::min(earliestExit, exit);
+    }
+
+    // The block is hit on the axis along which the box would touch it last
+    const auto axis = static_cast<int>(std::max_element(entry.cbegin(), entry.cend()) -
+                                       entry.cbegin());
+    if (entry[axis] == -INFINITE_TIME)
+    {
+        return std::nullopt;
+    }
+
+    // The box stops CONTACT_EPSILON before the surface, but only once it overlaps the block on the
+    // other axes. It may also be closer to the surface already, then it stops at once
+    auto time = std::max(stopTime[axis], 0.f);
+    for (auto otherAxis = 0; otherAxis < 3; ++otherAxis)
+    {
+        if (otherAxis != axis)
+        {
+            time = std::max(time, entry[otherAxis]);
+        }
+    }
+    if (time > 1 || time >= earliestExit)
+    {
+        return std::nullopt;
+    }
+    return Impact{time, axis, stopPosition[axis]};
+}
+
+void SweptAABB::translate(const std::array<float, 3>& displacement)
+{
+    for (auto axis = 0; axis < 3; ++axis)
+    {
+        mMin[axis] += displacement[axis];
+        mMax[axis] += displacement[axis];
+    }
+}
@@ -0,0 +1,193 @@
+#pragma once
+#include <SFML/System/Vector3.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <optional>
+
+#include "World/Block/Block.h"
+
+/**
+ * @brief Moves an axis-aligned box through the grid of blocks, stopping it at the first block in
+ * its way and letting it slide along the surface of that block with the rest of its movement.
+ *
+ * Instead of moving the box and checking whether it ended up inside a block, it computes the time
+ * of impact against every collidable block in the region covered by the whole movement, so the box
+ * can not pass through blocks however fast it moves. The box is always kept CONTACT_EPSILON away
+ * from the surfaces it touches. It knows nothing about the world, so the caller decides which
+ * blocks stop the box.
+ */
+class SweptAABB
+{
+public:
+    /**
+     * @brief Distance at which the box is kept from the surfaces of the blocks it touches.
+     */
+    static constexpr float CONTACT_EPSILON = 0.001f * Block::BLOCK_SIZE;
+
+    /**
+     * @brief Describes the movement of the box.
+     */
+    struct Result
+    {
+        /** Non-metric movement the box has made, shortened by the blocks in its way */
+        sf::Vector3f displacement;
+
+        /**
+         * Normal of the surface which stopped the box on the given axis, or zero if nothing
+         * stopped the box on that axis. For example, a box standing on the ground has a normal of
+         * {0, 1, 0}.
+         */
+        sf::Vector3i contactNormal;
+    };
+
+    /**
+     * @brief Prepares the box to be moved.
+     * @param min Non-metric position of the corner of the box with the lowest coordinates.
+     * @param max Non-metric position of the corner of the box with the highest coordinates.
+     */
+    SweptAABB(const sf::Vector3f& min, const sf::Vector3f& max);
+
+    /**
+     * @brief Moves the box as far as the blocks in its way allow. After hitting a block, the box
+     * slides along its surface with the rest of the movement.
+     * @tparam IsBlockCollidable Function taking const Block::Coordinate& and returning bool.
+     * @param displacement Non-metric movement the box should make.
+     * @param isBlockCollidable Tells whether the block with the given coordinates stops the box.
+     * @return The movement the box has made and the normals of the surfaces that stopped it.
+     */
+    template<typename IsBlockCollidable>
+    Result move(const sf::Vector3f& displacement, IsBlockCollidable&& isBlockCollidable);
+
+private:
+    /**
+     * @brief Describes the moment at which the moving box hits a block.
+     */
+    struct Impact
+    {
+        /** Fraction of the movement after which the box stops in front of the block */
+        float time;
+
+        /** Index of the axis along which the box hits the block: 0 for x, 1 for y and 2 for z */
+        int axis;
+
+        /** Non-metric coordinate on the axis at which the face of the box hitting it stops */
+        float stopPosition;
+    };
+
+    /**
+     * @brief Finds the first of the collidable blocks that the box hits during its movement.
+     * @param displacement Non-metric movement the box should make.
+     * @param isBlockCollidable Tells whether the block with the given coordinates stops the box.
+     * @return The earliest impact, or std::nullopt if the box can make the whole movement.
+     */
+    template<typename IsBlockCollidable>
+    [[nodiscard]] std::optional<Impact> firstImpact(const std::array<float, 3>& displacement,
+                                                    IsBlockCollidable& isBlockCollidable) const;
+
+    /**
+     * @brief Computes when the moving box hits the block. Blocks which the box already overlaps are
+     * ignored, so that the box can always leave a block it got stuck in.
+     * @param displacement Non-metric movement the box should make.
+     * @param block Coordinates of the block.
+     * @return The impact with the block, or std::nullopt if the box does not hit it.
+     */
+    [[nodiscard]] std::optional<Impact> impactWithBlock(const std::array<float, 3>& displacement,
+                                                        const Block::Coordinate& block) const;
+
+    /**
+     * @brief Moves the box by the given movement.
+     * @param displacement Non-metric movement of the box.
+     */
+    void translate(const std::array<float, 3>& displacement);
+
+private:
+    std::array<float, 3> mMin;
+    std::array<float, 3> mMax;
+};
+
+template<typename IsBlockCollidable>
+SweptAABB::Result SweptAABB::move(const sf::Vector3f& displacement,
+                                  IsBlockCollidable&& isBlockCollidable)
+{
+    const auto start = mMin;
+    auto remaining = std::array<float, 3>{displacement.x, displacement.y, displacement.z};
+    auto contactNormal = std::array<int, 3>{0, 0, 0};
+
+    // Every impact stops the movement along one more axis, so there can be at most three of them
+    for (auto slide = 0; slide < 3; ++slide)
+    {
+        const auto impact = firstImpact(remaining, isBlockCollidable);
+        if (!impact)
+        {
+            translate(remaining);
+            break;
+        }
+
+        const auto axis = impact->axis;
+        const auto direction = remaining[axis] > 0 ? 1 : -1;
+        auto movedPart = remaining;
+        for (auto& movement: movedPart)
+        {
+            movement *= impact->time;
+        }
+        // Placing the face exactly keeps the distance from the surface free of rounding errors
+        movedPart[axis] = impact->stopPosition - (direction > 0 ? mMax[axis] : mMin[axis]);
+        translate(movedPart);
+
+        for (auto& movement: remaining)
+        {
+            movement *= 1.f - impact->time;
+        }
+        remaining[axis] = 0;
+        contactNormal[axis] = -direction;
+    }
+
+    return Result{{mMin[0] - start[0], mMin[1] - start[1], mMin[2] - start[2]},
+                  {contactNormal[0], contactNormal[1], contactNormal[2]}};
+}
+
+template<typename IsBlockCollidable>
+std::optional<SweptAABB::Impact> SweptAABB::firstImpact(const std::array<float, 3>& displacement,
+                                                        IsBlockCollidable& isBlockCollidable) const
+{
+    if (displacement[0] == 0 && displacement[1] == 0 && displacement[2] == 0)
+    {
+        return std::nullopt;
+    }
+
+    // Only the blocks in the region covered by the whole movement, including the distance kept
+    // from the surfaces, can be hit
+    std::array<int, 3> regionMin;
+    std::array<int, 3> regionMax;
+    for (auto axis = 0; axis < 3; ++axis)
+    {
+        const auto from = std::min(mMin[axis], mMin[axis] + displacement[axis]) - CONTACT_EPSILON;
+        const auto to = std::max(mMax[axis], mMax[axis] + displacement[axis]) + CONTACT_EPSILON;
+        regionMin[axis] = static_cast<int>(std::floor(from / Block::BLOCK_SIZE));
+        regionMax[axis] = static_cast<int>(std::floor(to / Block::BLOCK_SIZE));
+    }
+
+    std::optional<Impact> earliestImpact;
+    for (auto x = regionMin[0]; x <= regionMax[0]; ++x)
+    {
+        for (auto y = regionMin[1]; y <= regionMax[1]; ++y)
+        {
+            for (auto z = regionMin[2]; z <= regionMax[2]; ++z)
+            {
+                const auto block = Block::Coordinate(x, y, z);
+                if (!isBlockCollidable(block))
+                {
+                    continue;
+                }
+
+                const auto impact = impactWithBlock(displacement, block);
+                if (impact && (!earliestImpact || impact->time < earliestImpact->time))
+                {
+                    earliestImpact = impact;
+                }
+            }
+        }
+    }
+    return earliestImpact;
+}
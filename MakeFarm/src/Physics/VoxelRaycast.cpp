@@ -0,0 +1,102 @@
+#include "VoxelRaycast.h"
+#include "pch.h"
+
+#include <cmath>
+#include <limits>
+
+VoxelRaycast::VoxelRaycast(const sf::Vector3f& origin, const sf::Vector3f& direction,
+                           float maxDistance)
+    : mOrigin{origin.x, origin.y, origin.z}
+    , mDirection{direction.x, direction.y, direction.z}
+    , mMaxDistance(maxDistance)
+{
+    const auto length = std::sqrt(direction.x * direction.x + direction.y * direction.y +
+                                  direction.z * direction.z);
+    const auto originBlock = Block::Coordinate::nonBlockToBlockMetric(origin);
+    mBlock = {originBlock.x, originBlock.y, originBlock.z};
+
+    constexpr auto INFINITE_DISTANCE = std::numeric_limits<float>::infinity();
+    for (auto axis = 0; axis < 3; ++axis)
+    {
+        // A ray without a direction stays in the block in which it starts
+        mDirection[axis] = length > 0 ? mDirection[axis] / length : 0;
+        if (mDirection[axis] > 0)
+        {
+            mStep[axis] = 1;
+            const auto boundary = static_cast<float>((mBlock[axis] + 1) * Block::BLOCK_SIZE);
+            mNextBoundaryDistance[axis] = (boundary - mOrigin[axis]) / mDirection[axis];
+            mBoundaryDistanceStep[axis] = Block::BLOCK_SIZE / mDirection[axis];
+        }
+        else if (mDirection[axis] < 0)
+        {
+            mStep[axis] = -1;
+            const auto boundary = static_cast<float>(mBlock[axis] * Block::BLOCK_SIZE);
+            mNextBoundaryDistance[axis] = (boundary - mOrigin[axis]) / mDirection[axis];
+            mBoundaryDistanceStep[axis] = -Block::BLOCK_SIZE / mDirection[axis];
+        }
+        else
+        {
+            mStep[axis] = 0;
+            mNextBoundaryDistance[axis] = INFINITE_DISTANCE;
+            mBoundaryDistanceStep[axis] = INFINITE_DISTANCE;
+        }
+    }
+}
+
+std::optional<VoxelRaycast::Hit> VoxelRaycast::next()
+{
+    if (!mHasVisitedFirstBlock)
+    {
+        mHasVisitedFirstBlock = true;
+
+        // The ray would have entered its first block through the face crossed along the axis it
+        // moves the most on
+        auto mainAxis = 0;
+        for (auto axis = 1; axis < 3; ++axis)
+        {
+            if (std::abs(mDirection[axis]) > std::abs(mDirection[mainAxis]))
+            {
+                mainAxis = axis;
+            }
+        }
+        return Hit{{mBlock[0], mBlock[1], mBlock[2]},
+                   entryFace(mainAxis, mStep[mainAxis] != 0 ? mStep[mainAxis] : 1),
+                   {mOrigin[0], mOrigin[1], mOrigin[2]},
+                   0.f};
+    }
+
+    auto axis = 0;
+    if (mNextBoundaryDistance[1] < mNextBoundaryDistance[axis])
+    {
+        axis = 1;
+    }
+    if (mNextBoundaryDistance[2] < mNextBoundaryDistance[axis])
+    {
+        axis = 2;
+    }
+
+    const auto distance = mNextBoundaryDistance[axis];
+    if (distance > mMaxDistance)
+    {
+        return std::nullopt;
+    }
+    mBlock[axis] += mStep[axis];
+    mNextBoundaryDistance[axis] += mBoundaryDistanceStep[axis];
+
+    return Hit{{mBlock[0], mBlock[1], mBlock[2]},
+               entryFace(axis, mStep[axis]),
+               {mOrigin[0] + mDirection[0] * distance, mOrigin[1] + mDirection[1] * distance,
+                mOrigin[2] + mDirection[2] * distance},
+               distance};
+}
+
+Block::Face VoxelRaycast::entryFace(int axis, int step)
+{
+    switch (axis)
+    {
+        case 0: return step > 0 ? Block::Face::Left : Block::Face::Right;
+        case 1: return step > 0 ? Block::Face::Bottom : Block::Face::Top;
+        case 2: return step > 0 ? Block::Face::Back : Block::Face::Front;
+        default: throw std::runtime_error("Unsupported axis of the ray");
+    }
+}
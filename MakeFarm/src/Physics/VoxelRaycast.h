@@ -0,0 +1,97 @@
+#pragma once
+#include <SFML/System/Vector3.hpp>
+#include <array>
+#include <optional>
+
+#include "World/Block/Block.h"
+
+/**
+ * @brief Follows a ray through the grid of blocks and visits every block it passes through exactly
+ * once, in the order in which the ray enters them.
+ *
+ * It uses the grid traversal of Amanatides and Woo, so moving to the next block costs a single
+ * comparison of the distances to the next block boundary on each axis, regardless of the length of
+ * the ray. It knows nothing about the world, so it can be used for any line-of-sight query by
+ * deciding which blocks stop the ray.
+ */
+class VoxelRaycast
+{
+public:
+    /**
+     * @brief Describes the block which the ray has entered.
+     */
+    struct Hit
+    {
+        /** Coordinates of the block which the ray has entered */
+        Block::Coordinate blockCoordinate;
+
+        /** Face of the block through which the ray has entered it */
+        Block::Face face;
+
+        /** Point on the face of the block at which the ray has entered it */
+        sf::Vector3f point;
+
+        /** Distance from the origin of the ray to the point */
+        float distance;
+    };
+
+    /**
+     * @brief Prepares the ray to visit the blocks.
+     * @param origin Non-metric position from which the ray starts.
+     * @param direction Direction of the ray. It does not have to be normalized.
+     * @param maxDistance Non-metric length of the ray after which no more blocks are visited.
+     */
+    VoxelRaycast(const sf::Vector3f& origin, const sf::Vector3f& direction, float maxDistance);
+
+    /**
+     * @brief Moves the ray into the next block. The first call returns the block in which the ray
+     * starts, whose face is the one the ray would have entered through and whose point is the
+     * origin of the ray.
+     * @return The block entered by the ray, or std::nullopt if the ray has ended.
+     */
+    [[nodiscard]] std::optional<Hit> next();
+
+    /**
+     * @brief Visits the blocks until one of them stops the ray.
+     * @tparam IsBlockHit Function taking const Block::Coordinate& and returning bool.
+     * @param isBlockHit Tells whether the block with the given coordinates stops the ray.
+     * @return The first block that stops the ray, or std::nullopt if the ray has ended before.
+     */
+    template<typename IsBlockHit>
+    [[nodiscard]] std::optional<Hit> firstHit(IsBlockHit&& isBlockHit);
+
+private:
+    /**
+     * @brief Returns the face through which the ray enters a block when it moves along the axis.
+     * @param axis Index of the axis: 0 for x, 1 for y and 2 for z.
+     * @param step Direction of the movement along the axis, either 1 or -1.
+     * @return The face of the entered block.
+     */
+    [[nodiscard]] static Block::Face entryFace(int axis, int step);
+
+private:
+    std::array<float, 3> mOrigin;
+    std::array<float, 3> mDirection;
+    float mMaxDistance;
+
+    std::array<int, 3> mBlock;
+    std::array<int, 3> mStep;
+    /** Distance along the ray at which it crosses the next block boundary on the given axis */
+    std::array<float, 3> mNextBoundaryDistance;
+    /** Distance along the ray between two consecutive block boundaries on the given axis */
+    std::array<float, 3> mBoundaryDistanceStep;
+    bool mHasVisitedFirstBlock = false;
+};
+
+template<typename IsBlockHit>
+std::optional<VoxelRaycast::Hit> VoxelRaycast::firstHit(IsBlockHit&& isBlockHit)
+{
+    for (auto hit = next(); hit; hit = next())
+    {
+        if (isBlockHit(hit->blockCoordinate))
+        {
+            return hit;
+        }
+    }
+    return std::nullopt;
+}
@@ -3,6 +3,7 @@
 #include "Renderer3D/Renderer3D.h"
 #include "Utils/Mouse.h"
 #include "Utils/utils.h"
+#include "World/Chunks/ChunkManager.h"
 #include "World/Crafting/Crafting.h"
 #include "pch.h"
 #include <filesystem>
@@ -215,6 +216,13 @@ void Inventory::saveInventoryDataToFile()
     mSerializer.saveToFile(inventorySaveFilePath());
 }
 
+void Inventory::saveInventoryDataInBackground(ChunkManager& chunkManager, SaveBatch batch)
+{
+    mSerializer.serialize(serializableInventory());
+    chunkManager.saveFileInBackground(inventorySaveFilePath(), mSerializer.serializedData(),
+                                      batch);
+}
+
 void Inventory::loadSavedInventoryData()
 {
     std::ifstream file(inventorySaveFilePath(), std::ios::binary);
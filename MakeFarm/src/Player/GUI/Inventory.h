@@ -2,11 +2,13 @@
 #include "Player/GUI/ItemSlots.h"
 #include "Resources/Resources.h"
 #include "Utils/Serializer.h"
+#include "World/Chunks/SaveBatch.h"
 #include "World/Item/Item.h"
 #include <optional>
 
 class Hotbar;
 class Crafting;
+class ChunkManager;
 
 /**
  * @brief The equipment in which the player stores belongings
@@ -81,6 +83,13 @@ public:
      */
     void updateInventoryState();
 
+    /**
+     * @brief Hands over the state of the inventory to be saved in the background.
+     * @param chunkManager Chunk manager whose threads save the world in the background.
+     * @param batch Batch of saves to which the save of the inventory belongs.
+     */
+    void saveInventoryDataInBackground(ChunkManager& chunkManager, SaveBatch batch);
+
 private:
     /**
      * @brief Finds a slot with a given item that could hold the indicated number of items.
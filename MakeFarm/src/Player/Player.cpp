@@ -1,4 +1,5 @@
 #include "Player.h"
+#include "Physics/SweptAABB.h"
 #include "Player/GUI/Bars/Hotbar.h"
 #include "Utils/Mouse.h"
 #include "World/Chunks/ChunkContainer.h"
@@ -34,10 +35,6 @@ Player::Player(const sf::Vector3f& position, sf::RenderWindow& gameWindow, sf::S
     centerOrigin(mCrosshair);
     mCrosshair.setPosition(gameWindow.getSize().x / 2.f, gameWindow.getSize().y / 2.f);
 
-    mWireframeShader.loadFromFile("resources/shaders/WireframeRenderer/VertexShader.shader",
-                                  "resources/shaders/WireframeRenderer/GeometryShader.shader",
-                                  "resources/shaders/WireframeRenderer/FragmentShader.shader");
-
     auto waterColor = sf::Color(49, 103, 189, 150);
     mWaterInWaterEffect.setFillColor(waterColor);
 
@@ -47,7 +44,6 @@ Player::Player(const sf::Vector3f& position, sf::RenderWindow& gameWindow, sf::S
 void Player::update(const float& deltaTime)
 {
     mCamera.update(deltaTime);
-    mCamera.updateViewProjection(mWireframeShader);
     mSelectedBlock.update(deltaTime, mCamera, mChunkManager);
     mInventory.update(deltaTime);
     checkFallingDamage();
@@ -120,16 +116,37 @@ void Player::fixedUpdate(const float& deltaTime, const ChunkContainer& chunkCont
 
 void Player::updatePhysics(const ChunkContainer& chunkContainer)
 {
-    updatePositionCheckingPhysicalCollisions(chunkContainer);
-    updateInformationIfPlayerIsInWater(chunkContainer);
+    mAABB.updatePosition(mPosition, AABB::RelativeTo::BottomCenter);
+    const auto blockRegion = blockRegionAroundMovement(chunkContainer);
+    updatePositionCheckingPhysicalCollisions(blockRegion);
+    updateInformationIfPlayerIsInWater(blockRegion);
 }
 
-void Player::updateInformationIfPlayerIsInWater(const ChunkContainer& chunkContainer)
+BlockRegion Player::blockRegionAroundMovement(const ChunkContainer& chunkContainer) const
 {
-    if (doesPlayerTouchesWater(chunkContainer))
+    // The region covers the player before and after the movement, together with the distance the
+    // player is kept from the surfaces. The velocity is limited, so the region is always small
+    auto [minPoint, maxPoint] = mAABB.collisionBox();
+    const auto from = sf::Vector3f{std::min(minPoint.x, minPoint.x + mVelocity.x),
+                                   std::min(minPoint.y, minPoint.y + mVelocity.y),
+                                   std::min(minPoint.z, minPoint.z + mVelocity.z)} -
+                      sf::Vector3f{SweptAABB::CONTACT_EPSILON, SweptAABB::CONTACT_EPSILON,
+                                   SweptAABB::CONTACT_EPSILON};
+    const auto to = sf::Vector3f{std::max(maxPoint.x, maxPoint.x + mVelocity.x),
+                                 std::max(maxPoint.y, maxPoint.y + mVelocity.y),
+                                 std::max(maxPoint.z, maxPoint.z + mVelocity.z)} +
+                    sf::Vector3f{SweptAABB::CONTACT_EPSILON, SweptAABB::CONTACT_EPSILON,
+                                 SweptAABB::CONTACT_EPSILON};
+    return chunkContainer.blockRegion(Block::Coordinate::nonBlockToBlockMetric(from),
+                                      Block::Coordinate::nonBlockToBlockMetric(to));
+}
+
+void Player::updateInformationIfPlayerIsInWater(const BlockRegion& blockRegion)
+{
+    if (doesPlayerTouchesWater(blockRegion))
     {
         mIsPlayerInWater = true;
-        updateInformationIfPlayersEyesAreInWater(chunkContainer);
+        updateInformationIfPlayersEyesAreInWater(blockRegion);
     }
     else
     {
@@ -138,22 +155,17 @@ void Player::updateInformationIfPlayerIsInWater(const ChunkContainer& chunkConta
     }
 }
 
-void Player::updateInformationIfPlayersEyesAreInWater(const ChunkContainer& chunkContainer)
+void Player::updateInformationIfPlayersEyesAreInWater(const BlockRegion& blockRegion)
 {
     mArePlayerEyesInWater =
-        doesItCollideWithGivenNonAirBlock(aabbHeadAboveEyes(), chunkContainer, BlockId::Water);
+        doesItCollideWithBlockWithProperty(aabbHeadAboveEyes(), blockRegion, BlockProperty::Fluid);
 }
 
-bool Player::doesItCollideWithGivenNonAirBlock(const AABB& aabb,
-                                               const ChunkContainer& chunkContainer,
-                                               BlockId blockId) const
+bool Player::doesItCollideWithBlockWithProperty(const AABB& aabb, const BlockRegion& blockRegion,
+                                                BlockProperty property) const
 {
-    auto nonAirBlocksPlayerTouched = chunkContainer.nonAirBlocksItTouches(aabb);
-    return std::find_if(nonAirBlocksPlayerTouched.cbegin(), nonAirBlocksPlayerTouched.cend(),
-                        [&blockId](const auto& block)
-                        {
-                            return block.id() == blockId;
-                        }) != nonAirBlocksPlayerTouched.cend();
+    auto [minPoint, maxPoint] = aabb.collisionBox();
+    return blockRegion.isAnyBlockTouching(minPoint, maxPoint, property);
 }
 
 AABB Player::aabbHeadAboveEyes() const
@@ -169,42 +181,43 @@ AABB Player::aabbHeadAboveEyes() const
     return aabb;
 }
 
-bool Player::doesPlayerTouchesWater(const ChunkContainer& chunkContainer) const
+bool Player::doesPlayerTouchesWater(const BlockRegion& blockRegion) const
 {
-    return doesItCollideWithGivenNonAirBlock(collisionBox(), chunkContainer, BlockId::Water);
+    return doesItCollideWithBlockWithProperty(collisionBox(), blockRegion, BlockProperty::Fluid);
 }
 
-void Player::updatePositionCheckingPhysicalCollisions(const ChunkContainer& chunkContainer)
+void Player::updatePositionCheckingPhysicalCollisions(const BlockRegion& blockRegion)
 {
-    tryUpdatePositionByApplyingVelocityIfCollisionAllows(chunkContainer, mPosition.x, mVelocity.x);
+    auto [minPoint, maxPoint] = mAABB.collisionBox();
+    SweptAABB sweptAABB(minPoint, maxPoint);
+    const auto movement = sweptAABB.move({mVelocity.x, mVelocity.y, mVelocity.z},
+                                         [&blockRegion](const Block::Coordinate& blockCoordinate)
+                                         { return blockRegion.isCollidable(blockCoordinate); });
+
+    mPosition += glm::vec3(movement.displacement.x, movement.displacement.y,
+                           movement.displacement.z);
+    mAABB.updatePosition(mPosition, AABB::RelativeTo::BottomCenter);
 
-    float fallingVelocity = mVelocity.y;
-    if (tryUpdatePositionByApplyingVelocityIfCollisionAllows(chunkContainer, mPosition.y,
-                                                             mVelocity.y))
+    const auto fallingVelocity = mVelocity.y;
+    if (movement.contactNormal.x != 0)
     {
-        mIsPlayerOnGround = false;
+        mVelocity.x = 0;
     }
-    else
+    if (movement.contactNormal.y != 0)
     {
-        mIsPlayerOnGround = true;
-        mFallingVelocityBeforeHittingGround = fallingVelocity;
+        mVelocity.y = 0;
+    }
+    if (movement.contactNormal.z != 0)
+    {
+        mVelocity.z = 0;
     }
 
-    tryUpdatePositionByApplyingVelocityIfCollisionAllows(chunkContainer, mPosition.z, mVelocity.z);
-}
-
-bool Player::tryUpdatePositionByApplyingVelocityIfCollisionAllows(
-    const ChunkContainer& chunkContainer, float& position, float& velocity)
-{
-    position += velocity;
-    mAABB.updatePosition(mPosition, AABB::RelativeTo::BottomCenter);
-    if (chunkContainer.doesItCollide(collisionBox()))
+    // Only the surface below the player counts as the ground, hitting the ceiling does not
+    mIsPlayerOnGround = movement.contactNormal.y > 0;
+    if (mIsPlayerOnGround)
     {
-        position -= velocity;
-        velocity = 0;
-        return false;
+        mFallingVelocityBeforeHittingGround = fallingVelocity;
     }
-    return true;
 }
 
 void Player::handleMovementKeyboardInputs(const float& deltaTime)
@@ -354,7 +367,8 @@ void Player::tryPlaceBlock()
                 //       later to remove item from inventory
                 mChunkManager.chunks().tryToPlaceBlock(
                     static_cast<BlockId>(removedItem.value()), coordinatesOfBlockToBePlaced,
-                    {HighlightedBlock::BLOCKS_THAT_MIGHT_BE_OVERPLACED}, RebuildOperation::Fast);
+                    {HighlightedBlock::BLOCKS_THAT_MIGHT_BE_OVERPLACED}, RebuildOperation::Fast,
+                    PlacementOrigin::Edit);
             }
         }
     }
@@ -454,7 +468,6 @@ void Player::draw(const Renderer3D& renderer3D, sf::RenderTarget& target,
         SfmlDraw(mWaterInWaterEffect, target, states);
     }
 
-    mSelectedBlock.draw(renderer3D, mWireframeShader);
     SfmlDraw(mCrosshair, target, states);
     mInventory.draw(target, states);
     mHealthbar.draw(target, states);
@@ -464,6 +477,11 @@ void Player::draw(const Renderer3D& renderer3D, sf::RenderTarget& target,
     }
 }
 
+void Player::drawOverlay(OverlayRenderer& overlayRenderer) const
+{
+    mSelectedBlock.draw(overlayRenderer);
+}
+
 bool Player::isDead() const
 {
     return mPlayerHealth == 0;
@@ -474,15 +492,27 @@ std::string Player::playerSaveFilePath()
     return mSavedWorldPath + "/player.bin";
 }
 
-void Player::savePlayerDataToFile()
+void Player::serializePlayerData()
 {
     auto playerPosition = position();
     mSerializer.serialize(playerPosition.x, playerPosition.y, playerPosition.z,
                           static_cast<float>(mPlayerHealth), mSpawnPoint.x, mSpawnPoint.y,
                           mSpawnPoint.z);
+}
+
+void Player::savePlayerDataToFile()
+{
+    serializePlayerData();
     mSerializer.saveToFile(playerSaveFilePath());
 }
 
+void Player::saveInBackground(SaveBatch batch)
+{
+    serializePlayerData();
+    mChunkManager.saveFileInBackground(playerSaveFilePath(), mSerializer.serializedData(), batch);
+    mInventory.saveInventoryDataInBackground(mChunkManager, batch);
+}
+
 void Player::loadSavedPlayerData()
 {
     std::ifstream file(playerSaveFilePath(), std::ios::binary);
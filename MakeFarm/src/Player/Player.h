@@ -4,11 +4,14 @@
 #include "Player/GUI/Bars/Oxygenbar.h"
 #include "Player/GUI/Inventory.h"
 #include "Utils/Serializer.h"
+#include "World/Block/BlockProperty.h"
 #include "World/Block/HighlightedBlock.h"
 #include "World/Camera.h"
 #include <SFML/Graphics/RectangleShape.hpp>
 
+class BlockRegion;
 class ChunkContainer;
+class OverlayRenderer;
 
 class Player
 {
@@ -36,6 +39,12 @@ public:
     void draw(const Renderer3D& renderer3D, sf::RenderTarget& target,
               sf::RenderStates states) const;
 
+    /**
+     * \brief Adds the block selected by the player to the overlay drawn on top of the world
+     * \param overlayRenderer Renderer drawing the overlay in the current frame
+     */
+    void drawOverlay(OverlayRenderer& overlayRenderer) const;
+
     /**
      * Updates the Player logic dependent, or independent of time, every rendered frame.
      * \param deltaTime the time that has passed since the game was last updated.
@@ -100,6 +109,12 @@ public:
      */
     void toggleControls();
 
+    /**
+     * @brief Hands over the state of the player and their inventory to be saved in the background.
+     * @param batch Batch of saves to which the saves of the player belong.
+     */
+    void saveInBackground(SaveBatch batch);
+
 private:
     /**
      * @brief Updates the player's velocity.
@@ -115,36 +130,31 @@ private:
     void updatePhysics(const ChunkContainer& chunkContainer);
 
     /**
-     * @brief It tries to move the player's positions by the indicated velocity as long as the
-     * object does not collide.
+     * @brief Gathers the blocks around the player which the physics of the current tick may need.
      * @param chunkContainer Container storing chunks
+     * @return Region of blocks covering the player before and after applying the velocity.
      */
-    void updatePositionCheckingPhysicalCollisions(const ChunkContainer& chunkContainer);
+    BlockRegion blockRegionAroundMovement(const ChunkContainer& chunkContainer) const;
 
     /**
-     * @brief Updates information on player being in water.
-     * @param chunkContainer Container storing chunks
+     * @brief Moves the player by the velocity as far as the blocks in the way allow. The player
+     * slides along the blocks they hit, and the velocity towards these blocks is stopped.
+     * @param blockRegion Blocks around the movement of the player
      */
-    void updateInformationIfPlayerIsInWater(const ChunkContainer& chunkContainer);
+    void updatePositionCheckingPhysicalCollisions(const BlockRegion& blockRegion);
 
     /**
-     * @brief Checks if player's collision box collides with water.
-     * @param chunkContainer Container storing chunks
-     * @return True if player's collision box touches water.
+     * @brief Updates information on player being in water.
+     * @param blockRegion Blocks around the player
      */
-    bool doesPlayerTouchesWater(const ChunkContainer& chunkContainer) const;
+    void updateInformationIfPlayerIsInWater(const BlockRegion& blockRegion);
 
     /**
-     * @brief It tries to update the position with the given speed by checking beforehand if there
-     * is a collision. Only one dimension should be given.
-     * @param chunkContainer Container storing chunks.
-     * @param position Position as one dimension (x, y, z) on which the player is located
-     * @param velocity Velocity of the player given as one dimension (x, y, z)
-     * @return True if the position was successfully updated, false if there was a collision and the
-     * position was not updated.
+     * @brief Checks if player's collision box collides with water.
+     * @param blockRegion Blocks around the player
+     * @return True if player's collision box touches water.
      */
-    bool tryUpdatePositionByApplyingVelocityIfCollisionAllows(const ChunkContainer& chunkContainer,
-                                                              float& position, float& velocity);
+    bool doesPlayerTouchesWater(const BlockRegion& blockRegion) const;
 
     /**
      * @brief Limits the player's velocity by the specified maximum ranges.
@@ -172,20 +182,20 @@ private:
     AABB aabbHeadAboveEyes() const;
 
     /**
-     * @brief Checks if a given collision box collides with a block with the given id
+     * @brief Checks if a given collision box collides with a block with the given property
      * @param aabb The collision box, the collision of which should be checked
-     * @param chunkContainer Container storing chunks
-     * @param blockId Identifier of the block with which the collision should be checked
+     * @param blockRegion Blocks around the collision box
+     * @param property Property of the block with which the collision should be checked
      * @return True if the collision occurred, false otherwise
      */
-    bool doesItCollideWithGivenNonAirBlock(const AABB& aabb, const ChunkContainer& chunkContainer,
-                                           BlockId blockId) const;
+    bool doesItCollideWithBlockWithProperty(const AABB& aabb, const BlockRegion& blockRegion,
+                                            BlockProperty property) const;
 
     /**
      * @brief Updates whether the player's eyes are below the water level.
-     * @param chunkContainer Container storing chunks
+     * @param blockRegion Blocks around the player
      */
-    void updateInformationIfPlayersEyesAreInWater(const ChunkContainer& chunkContainer);
+    void updateInformationIfPlayersEyesAreInWater(const BlockRegion& blockRegion);
 
     /**
      * @brief He is trying to put a block through the player - where the player is looking.
@@ -252,6 +262,11 @@ private:
      */
     std::string playerSaveFilePath();
 
+    /**
+     * @brief Serializes the state of the player data so that it can be saved
+     */
+    void serializePlayerData();
+
     /**
      * @brief Saves the state of the player data to a file
      */
@@ -272,7 +287,6 @@ private:
     AABB mAABB;
     HighlightedBlock mSelectedBlock;
     ChunkManager& mChunkManager;
-    sf::Shader mWireframeShader;
     Inventory mInventory;
     Healthbar mHealthbar;
     Oxygenbar mOxygenbar;
@@ -0,0 +1,74 @@
+#include "ChunkMeshBuilder.h"
+#include "pch.h"
+
+ChunkMeshBuilder::ChunkMeshBuilder(const Block::Coordinate& origin,
+                                   TextureCoordinatesProvider textureCoordinates)
+    : mTextureCoordinates(std::move(textureCoordinates))
+    , mTerrainMeshBuilder(origin)
+    , mFluidMeshBuilder(origin)
+    , mFloralMeshBuilder(origin)
+{
+}
+
+void ChunkMeshBuilder::resetMeshes()
+{
+    mTerrainMeshBuilder.resetMesh();
+    mFluidMeshBuilder.resetMesh();
+    mFloralMeshBuilder.resetMesh();
+    mNumberOfFaces = 0;
+}
+
+std::unique_ptr<Mesh3D> ChunkMeshBuilder::terrainMesh()
+{
+    return mTerrainMeshBuilder.mesh3D();
+}
+
+std::unique_ptr<Mesh3D> ChunkMeshBuilder::fluidMesh()
+{
+    return mFluidMeshBuilder.mesh3D();
+}
+
+std::unique_ptr<Mesh3D> ChunkMeshBuilder::floralMesh()
+{
+    return mFloralMeshBuilder.mesh3D();
+}
+
+std::size_t ChunkMeshBuilder::numberOfFaces() const
+{
+    return mNumberOfFaces;
+}
+
+void ChunkMeshBuilder::addFace(const Block& block, Block::Face blockFace,
+                               const Block::Coordinate& localCoordinates,
+                               ChunkOccupancy::Properties neighbour)
+{
+    if (ChunkOccupancy::hasProperty(neighbour, BlockProperty::Opaque))
+    {
+        return;
+    }
+
+    if (block.id() == BlockId::Water)
+    {
+        // Faces between two fluid blocks are inside the water
+        if (!ChunkOccupancy::hasProperty(neighbour, BlockProperty::Fluid))
+        {
+            addQuad(mFluidMeshBuilder, block, blockFace, localCoordinates);
+        }
+    }
+    else if (block.isFloral())
+    {
+        addQuad(mFloralMeshBuilder, block, blockFace, localCoordinates);
+    }
+    else
+    {
+        addQuad(mTerrainMeshBuilder, block, blockFace, localCoordinates);
+    }
+}
+
+void ChunkMeshBuilder::addQuad(BlockMeshBuilder& meshBuilder, const Block& block,
+                               Block::Face blockFace, const Block::Coordinate& localCoordinates)
+{
+    meshBuilder.addQuad(blockFace, mTextureCoordinates(block.blockTextureId(blockFace)),
+                        localCoordinates);
+    ++mNumberOfFaces;
+}
@@ -0,0 +1,139 @@
+#pragma once
+#include <algorithm>
+#include <functional>
+
+#include "Renderer3D/Meshes/Builders/BlockMeshBuilder.h"
+#include "World/Chunks/ChunkInterface.h"
+#include "World/Chunks/ChunkOccupancy.h"
+
+/**
+ * @brief Builds the terrain, fluid and floral meshes of a chunk from its blocks.
+ *
+ * It does not touch OpenGL, so the meshes can be built without a window. Where the texture of a
+ * face lies is told by the given provider, as only the game has the texture pack to read it from.
+ */
+class ChunkMeshBuilder
+{
+public:
+    /**
+     * @brief Returns the normalized texture coordinates of the texture with the given id.
+     */
+    using TextureCoordinatesProvider = std::function<std::vector<GLfloat>(Block::TextureId)>;
+
+    /**
+     * @param origin Position of the chunk in blocks.
+     * @param textureCoordinates Provider of the texture coordinates of the faces.
+     */
+    ChunkMeshBuilder(const Block::Coordinate& origin,
+                     TextureCoordinatesProvider textureCoordinates);
+
+    /**
+     * @brief Adds the visible faces of every block of the chunk to the mesh it belongs to.
+     * @param chunk Chunk whose blocks are added.
+     * @param occupancy Properties of the blocks of the chunk.
+     * @param neighbourProperties Returns the properties of the block next to the given face of the
+     * given block, or nothing if that block is not loaded, in which case the face is not built.
+     */
+    template<typename NeighbourProperties>
+    void addBlocks(const ChunkInterface& chunk, const ChunkOccupancy& occupancy,
+                   const NeighbourProperties& neighbourProperties);
+
+    /**
+     * @brief Empties all meshes, so that the chunk can be built anew.
+     */
+    void resetMeshes();
+
+    /**
+     * @brief Returns the built mesh of the solid blocks.
+     * @return The created 3D mesh
+     */
+    [[nodiscard]] std::unique_ptr<Mesh3D> terrainMesh();
+
+    /**
+     * @brief Returns the built mesh of the fluids.
+     * @return The created 3D mesh
+     */
+    [[nodiscard]] std::unique_ptr<Mesh3D> fluidMesh();
+
+    /**
+     * @brief Returns the built mesh of the plants.
+     * @return The created 3D mesh
+     */
+    [[nodiscard]] std::unique_ptr<Mesh3D> floralMesh();
+
+    /**
+     * @brief Returns the number of faces added since the meshes were last reset.
+     * @return Number of faces in the terrain, fluid and floral meshes together.
+     */
+    [[nodiscard]] std::size_t numberOfFaces() const;
+
+private:
+    /**
+     * @brief Adds the face of the block to the mesh it belongs to, if it can be seen.
+     * @param block The block whose face is added.
+     * @param blockFace The face to add.
+     * @param localCoordinates Local coordinates of the block.
+     * @param neighbour Properties of the block next to the face.
+     */
+    void addFace(const Block& block, Block::Face blockFace,
+                 const Block::Coordinate& localCoordinates, ChunkOccupancy::Properties neighbour);
+
+    /**
+     * @brief Adds the quad of the face to the given mesh.
+     * @param meshBuilder Builder of the mesh to which the quad is added.
+     * @param block The block whose face is added.
+     * @param blockFace The face to add.
+     * @param localCoordinates Local coordinates of the block.
+     */
+    void addQuad(BlockMeshBuilder& meshBuilder, const Block& block, Block::Face blockFace,
+                 const Block::Coordinate& localCoordinates);
+
+private:
+    TextureCoordinatesProvider mTextureCoordinates;
+    BlockMeshBuilder mTerrainMeshBuilder;
+    BlockMeshBuilder mFluidMeshBuilder;
+    BlockMeshBuilder mFloralMeshBuilder;
+    std::size_t mNumberOfFaces = 0;
+};
+
+template<typename NeighbourProperties>
+void ChunkMeshBuilder::addBlocks(const ChunkInterface& chunk, const ChunkOccupancy& occupancy,
+                                 const NeighbourProperties& neighbourProperties)
+{
+    for (auto section = 0; section < ChunkOccupancy::NUMBER_OF_SECTIONS; ++section)
+    {
+        if (occupancy.isSectionOnlyAir(section))
+        {
+            continue;
+        }
+
+        const auto sectionBottom = section * ChunkOccupancy::BLOCKS_PER_SECTION_Y_DIMENSION;
+        const auto sectionTop =
+            std::min(sectionBottom + ChunkOccupancy::BLOCKS_PER_SECTION_Y_DIMENSION,
+                     ChunkInterface::BLOCKS_PER_Y_DIMENSION);
+        for (auto x = 0; x < ChunkInterface::BLOCKS_PER_X_DIMENSION; ++x)
+        {
+            for (auto y = sectionBottom; y < sectionTop; ++y)
+            {
+                for (auto z = 0; z < ChunkInterface::BLOCKS_PER_Z_DIMENSION; ++z)
+                {
+                    const auto localCoordinates = Block::Coordinate(x, y, z);
+                    if (!occupancy.hasProperty(localCoordinates, BlockProperty::NonAir))
+                    {
+                        continue;
+                    }
+
+                    const auto& block = chunk.localBlock(localCoordinates);
+                    for (auto i = 0; i < static_cast<int>(Block::Face::Counter); ++i)
+                    {
+                        const auto blockFace = static_cast<Block::Face>(i);
+                        if (const auto neighbour = neighbourProperties(blockFace, localCoordinates))
+                        {
+                            addFace(block, blockFace, localCoordinates, *neighbour);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
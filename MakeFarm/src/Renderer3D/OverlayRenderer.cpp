@@ -0,0 +1,132 @@
+#include "OverlayRenderer.h"
+#include "pch.h"
+
+#include "Renderer3D/BufferLayout.h"
+#include "Renderer3D/Renderer3D.h"
+#include "World/Block/WireframeBlock.h"
+
+OverlayRenderer::OverlayRenderer()
+    : mVertexBuffer(nullptr, NUMBER_OF_FRAMES_IN_FLIGHT * MAX_VERTICES_PER_FRAME * sizeof(Vertex),
+                    GL_STREAM_DRAW)
+{
+    mVertices.reserve(MAX_VERTICES_PER_FRAME);
+
+    BufferLayout bufferLayout;
+    bufferLayout.push<GLfloat>(3);
+    bufferLayout.push<GLubyte>(4);
+    mVertexArray.setBuffer(mVertexBuffer, bufferLayout);
+    mVertexArray.unbind();
+    mVertexBuffer.unbind();
+
+    mShader.loadFromFile("resources/shaders/OverlayRenderer/VertexShader.shader",
+                         "resources/shaders/OverlayRenderer/GeometryShader.shader",
+                         "resources/shaders/OverlayRenderer/FragmentShader.shader");
+    mShader.setUniform("u_LineWidth", LINE_WIDTH);
+}
+
+OverlayRenderer::~OverlayRenderer()
+{
+    for (auto fence: mFences)
+    {
+        if (fence)
+        {
+            glDeleteSync(fence);
+        }
+    }
+}
+
+void OverlayRenderer::addLine(const sf::Vector3f& from, const sf::Vector3f& to,
+                              const sf::Color& color)
+{
+    mVertices.push_back({from.x, from.y, from.z, color.r, color.g, color.b, color.a});
+    mVertices.push_back({to.x, to.y, to.z, color.r, color.g, color.b, color.a});
+}
+
+void OverlayRenderer::addBox(const sf::Vector3f& min, const sf::Vector3f& max,
+                             const sf::Color& color)
+{
+    // Bottom and top edges
+    addQuad({min.x, min.y, min.z}, {max.x, min.y, min.z}, {max.x, min.y, max.z},
+            {min.x, min.y, max.z}, color);
+    addQuad({min.x, max.y, min.z}, {max.x, max.y, min.z}, {max.x, max.y, max.z},
+            {min.x, max.y, max.z}, color);
+
+    // Vertical edges
+    addLine({min.x, min.y, min.z}, {min.x, max.y, min.z}, color);
+    addLine({max.x, min.y, min.z}, {max.x, max.y, min.z}, color);
+    addLine({max.x, min.y, max.z}, {max.x, max.y, max.z}, color);
+    addLine({min.x, min.y, max.z}, {min.x, max.y, max.z}, color);
+}
+
+void OverlayRenderer::addBox(const WireframeBlock& box, const sf::Color& color)
+{
+    addBox(box.min, box.max, color);
+}
+
+void OverlayRenderer::addQuad(const sf::Vector3f& first, const sf::Vector3f& second,
+                              const sf::Vector3f& third, const sf::Vector3f& fourth,
+                              const sf::Color& color)
+{
+    addLine(first, second, color);
+    addLine(second, third, color);
+    addLine(third, fourth, color);
+    addLine(fourth, first, color);
+}
+
+sf::Shader& OverlayRenderer::shader()
+{
+    return mShader;
+}
+
+void OverlayRenderer::finishFrame()
+{
+    // All the draw calls of the frame uploaded last time were issued since then, so the fence
+    // is signaled once the GPU finishes all of them
+    if (mUploadedFrame >= 0)
+    {
+        mFences[mUploadedFrame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    auto& fence = mFences[mFrame];
+    if (fence)
+    {
+        constexpr GLuint64 WAIT_TIMEOUT_IN_NANOSECONDS = 1'000'000;
+        while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, WAIT_TIMEOUT_IN_NANOSECONDS) ==
+               GL_TIMEOUT_EXPIRED)
+        {
+        }
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    // Lines can not be split in half
+    mNumberOfUploadedVertices =
+        std::min(static_cast<int>(mVertices.size()), MAX_VERTICES_PER_FRAME) / 2 * 2;
+    if (mNumberOfUploadedVertices > 0)
+    {
+        mVertexBuffer.writeUnsynchronized(mFrame * MAX_VERTICES_PER_FRAME * sizeof(Vertex),
+                                          mVertices.data(),
+                                          mNumberOfUploadedVertices * sizeof(Vertex));
+        mVertexBuffer.unbind();
+    }
+
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    mShader.setUniform("u_ViewportSize", sf::Glsl::Vec2(static_cast<float>(viewport[2]),
+                                                        static_cast<float>(viewport[3])));
+
+    mVertices.clear();
+    mUploadedFrame = mFrame;
+    mFrame = (mFrame + 1) % NUMBER_OF_FRAMES_IN_FLIGHT;
+}
+
+void OverlayRenderer::draw(const Renderer3D& renderer3D) const
+{
+    if (mNumberOfUploadedVertices > 0)
+    {
+        glDisable(GL_DEPTH_TEST);
+        renderer3D.draw(mVertexArray, mShader, mUploadedFrame * MAX_VERTICES_PER_FRAME,
+                        mNumberOfUploadedVertices, Renderer3D::DrawMode::Lines);
+        glEnable(GL_DEPTH_TEST);
+    }
+}
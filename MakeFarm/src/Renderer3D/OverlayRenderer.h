@@ -0,0 +1,119 @@
+#pragma once
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/System/Vector3.hpp>
+#include <array>
+#include <vector>
+
+#include "Renderer3D/VertexArray.h"
+#include "Renderer3D/VertexBuffer.h"
+
+class Renderer3D;
+struct WireframeBlock;
+
+/**
+ * @brief Draws the debug and gameplay overlays, such as the highlighted block, the occurred
+ * collisions or the borders of the chunks, on top of the 3D world.
+ *
+ * Everything added during a frame is gathered as coloured lines on the CPU and drawn at once with a
+ * single draw call, in which a geometry shader widens each line to LINE_WIDTH pixels. The lines are
+ * written to a buffer created once and divided into a part for each of the last few frames. Each
+ * part is guarded by a fence, so it is overwritten only after the GPU finished drawing it, which
+ * in practice happens long before and the writes do not wait.
+ */
+class OverlayRenderer
+{
+public:
+    /**
+     * @brief Number of frames that the GPU may still be drawing while the next one is prepared.
+     * Each of them has its own part of the buffer.
+     */
+    static constexpr int NUMBER_OF_FRAMES_IN_FLIGHT = 3;
+
+    /**
+     * @brief Maximum number of vertices drawn in a single frame. Vertices added above this limit
+     * are not drawn.
+     */
+    static constexpr int MAX_VERTICES_PER_FRAME = 1 << 15;
+
+    /**
+     * @brief Width of the drawn lines in pixels.
+     */
+    static constexpr float LINE_WIDTH = 2.f;
+
+    OverlayRenderer();
+    OverlayRenderer(const OverlayRenderer&) = delete;
+    OverlayRenderer& operator=(const OverlayRenderer&) = delete;
+    ~OverlayRenderer();
+
+    /**
+     * @brief Adds a line to be drawn in the current frame.
+     * @param from Non-metric position of the beginning of the line.
+     * @param to Non-metric position of the end of the line.
+     * @param color Colour of the line.
+     */
+    void addLine(const sf::Vector3f& from, const sf::Vector3f& to, const sf::Color& color);
+
+    /**
+     * @brief Adds the edges of the box to be drawn in the current frame.
+     * @param min Non-metric position of the corner with the lowest coordinates.
+     * @param max Non-metric position of the corner with the highest coordinates.
+     * @param color Colour of the edges.
+     */
+    void addBox(const sf::Vector3f& min, const sf::Vector3f& max, const sf::Color& color);
+
+    /**
+     * @brief Adds the edges of the box to be drawn in the current frame.
+     * @param box Box whose edges are drawn.
+     * @param color Colour of the edges.
+     */
+    void addBox(const WireframeBlock& box, const sf::Color& color);
+
+    /**
+     * @brief Adds the outline of the quad to be drawn in the current frame.
+     * @param color Colour of the outline.
+     * @warning Vertices of the quad should be given in the order in which they follow each other.
+     */
+    void addQuad(const sf::Vector3f& first, const sf::Vector3f& second, const sf::Vector3f& third,
+                 const sf::Vector3f& fourth, const sf::Color& color);
+
+    /**
+     * @brief Returns the shader drawing the overlay, so that the camera can update its view
+     * projection.
+     * @return Shader drawing the overlay.
+     */
+    [[nodiscard]] sf::Shader& shader();
+
+    /**
+     * @brief Uploads everything added in the current frame, so that it is drawn by the following
+     * calls to draw, and starts the next frame.
+     */
+    void finishFrame();
+
+    /**
+     * @brief Draws the lines of the last finished frame on top of the world.
+     * @param renderer3D Renderer drawing the 3D game world onto the 2D screen
+     */
+    void draw(const Renderer3D& renderer3D) const;
+
+private:
+    /**
+     * @brief Single vertex of the overlay as it is stored in the buffer.
+     */
+    struct Vertex
+    {
+        float x, y, z;
+        unsigned char r, g, b, a;
+    };
+    static_assert(sizeof(Vertex) == 16, "Vertex of the overlay is expected to be tightly packed");
+
+private:
+    std::vector<Vertex> mVertices;
+    VertexBuffer mVertexBuffer;
+    VertexArray mVertexArray;
+    sf::Shader mShader;
+    std::array<GLsync, NUMBER_OF_FRAMES_IN_FLIGHT> mFences{};
+    int mFrame = 0;
+    int mUploadedFrame = -1;
+    int mNumberOfUploadedVertices = 0;
+};
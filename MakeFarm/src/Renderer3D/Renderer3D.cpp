@@ -56,6 +56,17 @@ void Renderer3D::draw(const VertexArray& va, const sf::Shader& shader, int numbe
     va.unbind();
 }
 
+void Renderer3D::draw(const VertexArray& va, const sf::Shader& shader, int first, int number,
+                      const DrawMode& drawMode) const
+{
+    sf::Shader::bind(&shader);
+    va.bind();
+    GLCall(glDrawArrays(toOpenGL(drawMode), first, number));
+
+    sf::Shader::bind(nullptr);
+    va.unbind();
+}
+
 unsigned Renderer3D::toOpenGL(const Renderer3D::DrawMode& drawMode) const
 {
     switch (drawMode)
@@ -81,6 +81,17 @@ public:
     void draw(const VertexArray& va, const sf::Shader& shader, int number,
               const DrawMode& drawMode = DrawMode::Triangles) const;
 
+    /**
+     * Draws the part of the data given in VertexArray to the screen using the interpretation given
+     * in Shader.
+     * @param va Stores all Vertex Data.
+     * @param shader Shader telling how to draw data.
+     * @param first Index of the first vertex to draw.
+     * @param number Number of vertices to draw.
+     */
+    void draw(const VertexArray& va, const sf::Shader& shader, int first, int number,
+              const DrawMode& drawMode) const;
+
 private:
     unsigned toOpenGL(const DrawMode& drawMode) const;
 };
\ No newline at end of file
@@ -2,11 +2,13 @@
 #include "Renderer3D/Renderer3D.h"
 #include "pch.h"
 
-VertexBuffer::VertexBuffer(const void* data, unsigned size)
+#include <cstring>
+
+VertexBuffer::VertexBuffer(const void* data, unsigned size, unsigned usage)
 {
     GLCall(glGenBuffers(1, &mBufferId));
     GLCall(glBindBuffer(GL_ARRAY_BUFFER, mBufferId));
-    GLCall(glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW));
+    GLCall(glBufferData(GL_ARRAY_BUFFER, size, data, usage));
 }
 
 VertexBuffer::~VertexBuffer()
@@ -23,3 +25,14 @@ void VertexBuffer::unbind() const
 {
     GLCall(glBindBuffer(GL_ARRAY_BUFFER, 0));
 }
+
+void VertexBuffer::writeUnsynchronized(unsigned offset, const void* data, unsigned size)
+{
+    bind();
+    void* destination = nullptr;
+    GLCall(destination = glMapBufferRange(GL_ARRAY_BUFFER, offset, size,
+                                          GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+                                              GL_MAP_UNSYNCHRONIZED_BIT));
+    std::memcpy(destination, data, size);
+    GLCall(glUnmapBuffer(GL_ARRAY_BUFFER));
+}
@@ -8,7 +8,14 @@
 class VertexBuffer : public Buffer
 {
 public:
-    VertexBuffer(const void* data, unsigned int size);
+    /**
+     * Creates the buffer and fills it with the given data.
+     * @param data Data to be copied to the buffer, or nullptr to leave the buffer uninitialized.
+     * @param size Size of the buffer in bytes.
+     * @param usage Expected usage pattern of the data, for example GL_STATIC_DRAW or
+     * GL_STREAM_DRAW.
+     */
+    VertexBuffer(const void* data, unsigned int size, unsigned int usage = GL_STATIC_DRAW);
 
     template<typename T>
     VertexBuffer(const std::vector<T>& vector);
@@ -30,6 +37,17 @@ public:
      * Unbinds a buffer object (GL_ARRAY_BUFFER)
      */
     void unbind() const override;
+
+    /**
+     * Overwrites a part of the buffer without waiting for the draw calls which still use the
+     * buffer.
+     * @param offset Offset in bytes from the beginning of the buffer.
+     * @param data Data to be copied to the buffer.
+     * @param size Size of the data in bytes.
+     * @warning The overwritten part must not be used by any draw call that may still be in flight,
+     * which can be ensured by waiting for a fence placed after the last of them.
+     */
+    void writeUnsynchronized(unsigned int offset, const void* data, unsigned int size);
 };
 
 template<typename T>
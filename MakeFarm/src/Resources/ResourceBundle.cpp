@@ -0,0 +1,437 @@
+#include "ResourceBundle.h"
+#include "pch.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include "World/Block/BlockMap.h"
+#include "World/Crafting/RecipeContainer.h"
+#include "World/Item/ItemMap.h"
+
+namespace
+{
+
+constexpr auto NUMBER_OF_BLOCK_IDS = static_cast<std::uint32_t>(BlockId::Counter);
+constexpr auto NUMBER_OF_ITEM_IDS = static_cast<std::uint32_t>(ItemId::Counter);
+constexpr auto NUMBER_OF_ITEM_RENDERS = static_cast<std::uint32_t>(Item::Render::Item) + 1;
+
+/**
+ * @brief Appends values to the bytes of the bundle. Numbers are always little-endian, so the
+ * bundle does not depend on the machine that baked it.
+ */
+class BundleWriter
+{
+public:
+    void writeUint32(std::uint32_t value)
+    {
+        for (auto byte = 0; byte < 4; ++byte)
+        {
+            mBytes.push_back(static_cast<unsigned char>(value >> (8 * byte)));
+        }
+    }
+
+    void writeBool(bool value)
+    {
+        mBytes.push_back(value ? 1 : 0);
+    }
+
+    void writeString(const std::string& value)
+    {
+        writeUint32(static_cast<std::uint32_t>(value.size()));
+        mBytes.insert(mBytes.end(), value.cbegin(), value.cend());
+    }
+
+    template<typename Enum>
+    void writeEnum(Enum value)
+    {
+        writeUint32(static_cast<std::uint32_t>(value));
+    }
+
+    std::vector<unsigned char>& bytes()
+    {
+        return mBytes;
+    }
+
+private:
+    std::vector<unsigned char> mBytes;
+};
+
+/**
+ * @brief Reads values from the bytes of the bundle. Reading past the end of the bytes or reading an
+ * enumerator which does not exist marks the reader as failed instead of returning invalid values.
+ */
+class BundleReader
+{
+public:
+    BundleReader(const unsigned char* data, std::size_t size)
+        : mData(data)
+        , mSize(size)
+    {
+    }
+
+    std::uint32_t readUint32()
+    {
+        std::uint32_t value = 0;
+        if (canRead(4))
+        {
+            for (auto byte = 0; byte < 4; ++byte)
+            {
+                value |= static_cast<std::uint32_t>(mData[mPosition + byte]) << (8 * byte);
+            }
+            mPosition += 4;
+        }
+        return value;
+    }
+
+    bool readBool()
+    {
+        return canRead(1) && mData[mPosition++] != 0;
+    }
+
+    std::string readString()
+    {
+        const auto size = readUint32();
+        if (!canRead(size))
+        {
+            return {};
+        }
+        std::string value(reinterpret_cast<const char*>(mData + mPosition), size);
+        mPosition += size;
+        return value;
+    }
+
+    template<typename Enum>
+    Enum readEnum(std::uint32_t numberOfValues)
+    {
+        const auto value = readUint32();
+        if (value >= numberOfValues)
+        {
+            mHasFailed = true;
+            return Enum{};
+        }
+        return static_cast<Enum>(value);
+    }
+
+    [[nodiscard]] bool hasFailed() const
+    {
+        return mHasFailed;
+    }
+
+    [[nodiscard]] bool isAtEnd() const
+    {
+        return mPosition == mSize;
+    }
+
+private:
+    bool canRead(std::size_t numberOfBytes)
+    {
+        mHasFailed = mHasFailed || numberOfBytes > mSize - mPosition;
+        return !mHasFailed;
+    }
+
+    const unsigned char* mData;
+    std::size_t mSize;
+    std::size_t mPosition = 0;
+    bool mHasFailed = false;
+};
+
+void writeBlockType(BundleWriter& writer, const BlockType& blockType)
+{
+    writer.writeEnum(blockType.id);
+    writer.writeString(blockType.fileName);
+    writer.writeString(blockType.name);
+    writer.writeBool(blockType.transparent);
+    writer.writeBool(blockType.collidable);
+    writer.writeBool(blockType.floral);
+    writer.writeBool(blockType.dropItemId.has_value());
+    writer.writeEnum(blockType.dropItemId.value_or(ItemId::None));
+    for (const auto textureId: blockType.textureId)
+    {
+        writer.writeUint32(textureId);
+    }
+}
+
+BlockType readBlockType(BundleReader& reader)
+{
+    BlockType blockType;
+    blockType.id = reader.readEnum<BlockId>(NUMBER_OF_BLOCK_IDS);
+    blockType.fileName = reader.readString();
+    blockType.name = reader.readString();
+    blockType.transparent = reader.readBool();
+    blockType.collidable = reader.readBool();
+    blockType.floral = reader.readBool();
+    const auto dropsItem = reader.readBool();
+    const auto dropItemId = reader.readEnum<ItemId>(NUMBER_OF_ITEM_IDS);
+    if (dropsItem)
+    {
+        blockType.dropItemId = dropItemId;
+    }
+    for (auto& textureId: blockType.textureId)
+    {
+        textureId = reader.readUint32();
+    }
+    return blockType;
+}
+
+void writeItemType(BundleWriter& writer, const ItemType& itemType)
+{
+    writer.writeEnum(itemType.id);
+    writer.writeString(itemType.fileName);
+    writer.writeString(itemType.name);
+    writer.writeEnum(itemType.render);
+    writer.writeBool(itemType.textureId.has_value());
+    writer.writeUint32(itemType.textureId.value_or(0));
+    writer.writeUint32(static_cast<std::uint32_t>(itemType.maxAmountInSlot));
+}
+
+ItemType readItemType(BundleReader& reader)
+{
+    ItemType itemType;
+    itemType.id = reader.readEnum<ItemId>(NUMBER_OF_ITEM_IDS);
+    itemType.fileName = reader.readString();
+    itemType.name = reader.readString();
+    itemType.render = reader.readEnum<Item::Render>(NUMBER_OF_ITEM_RENDERS);
+    const auto hasTexture = reader.readBool();
+    const auto textureId = reader.readUint32();
+    if (hasTexture)
+    {
+        itemType.textureId = textureId;
+    }
+    itemType.maxAmountInSlot = static_cast<int>(reader.readUint32());
+    return itemType;
+}
+
+void writeRecipe(BundleWriter& writer, const Recipe& recipe)
+{
+    for (const auto& column: recipe.layout)
+    {
+        for (const auto itemId: column)
+        {
+            writer.writeEnum(itemId);
+        }
+    }
+    writer.writeEnum(recipe.finalItem);
+    writer.writeUint32(static_cast<std::uint32_t>(recipe.finalAmount));
+    writer.writeBool(recipe.shapeless);
+}
+
+Recipe readRecipe(BundleReader& reader)
+{
+    Recipe recipe;
+    for (auto& column: recipe.layout)
+    {
+        for (auto& itemId: column)
+        {
+            itemId = reader.readEnum<ItemId>(NUMBER_OF_ITEM_IDS);
+        }
+    }
+    recipe.finalItem = reader.readEnum<ItemId>(NUMBER_OF_ITEM_IDS);
+    recipe.finalAmount = static_cast<int>(reader.readUint32());
+    recipe.shapeless = reader.readBool();
+    return recipe;
+}
+
+template<typename Value, typename WriteValue>
+void writeTable(BundleWriter& writer, const std::vector<Value>& table, WriteValue writeValue)
+{
+    writer.writeUint32(static_cast<std::uint32_t>(table.size()));
+    for (const auto& value: table)
+    {
+        writeValue(writer, value);
+    }
+}
+
+template<typename ReadValue>
+auto readTable(BundleReader& reader, ReadValue readValue)
+{
+    std::vector<decltype(readValue(reader))> table;
+    const auto size = reader.readUint32();
+    for (auto i = 0u; i < size && !reader.hasFailed(); ++i)
+    {
+        table.push_back(readValue(reader));
+    }
+    return table;
+}
+
+/**
+ * @brief Checks if the bundle was written after every file of the given directories was modified.
+ * @param pathToBundle Path to the bundle.
+ * @param sourceDirectories Directories with the files the bundle is made of.
+ * @return True if the bundle exists and is newer than the files, false otherwise.
+ */
+bool isBundleUpToDate(const std::string& pathToBundle,
+                      const std::vector<std::string>& sourceDirectories)
+{
+    std::error_code error;
+    const auto bundleWriteTime = std::filesystem::last_write_time(pathToBundle, error);
+    if (error)
+    {
+        return false;
+    }
+
+    for (const auto& directory: sourceDirectories)
+    {
+        // A change of the directory itself tells that a file was added or removed
+        if (std::filesystem::last_write_time(directory, error) >= bundleWriteTime || error)
+        {
+            return false;
+        }
+        for (const auto& file: std::filesystem::recursive_directory_iterator(directory, error))
+        {
+            if (file.last_write_time(error) >= bundleWriteTime || error)
+            {
+                return false;
+            }
+        }
+        if (error)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks if the block table holds every block, each one at the position of its id.
+ * @param blockTypes Block table read from the bundle.
+ * @return True if the table is complete, false otherwise.
+ */
+bool isBlockTableComplete(const std::vector<BlockType>& blockTypes)
+{
+    if (blockTypes.size() != NUMBER_OF_BLOCK_IDS)
+    {
+        return false;
+    }
+    for (auto i = 0u; i < blockTypes.size(); ++i)
+    {
+        if (blockTypes[i].id != static_cast<BlockId>(i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+}// namespace
+
+const std::optional<ResourceBundle::Contents>& ResourceBundle::bundle()
+{
+    static const auto contents = read(BUNDLE_PATH, SOURCE_DIRECTORIES);
+
+    return contents;
+}
+
+void ResourceBundle::bakeIfOutdated()
+{
+    if (bundle())
+    {
+        return;
+    }
+
+    Contents contents;
+    for (auto i = 0; i < static_cast<int>(BlockId::Counter); ++i)
+    {
+        contents.blockTypes.push_back(BlockMap::blockMap().blockType(static_cast<BlockId>(i)));
+    }
+    for (const auto& [itemId, itemType]: ItemMap::itemMap().itemTypes())
+    {
+        contents.itemTypes.push_back(itemType);
+    }
+    contents.recipes = RecipeContainer::recipeContainer().recipes();
+
+    // The game runs just as well without the bundle, only its next start is slower
+    try
+    {
+        write(BUNDLE_PATH, contents);
+    }
+    catch (const std::exception& exception)
+    {
+        std::cout << "[ResourceBundle] Unable to bake the resource bundle: " << exception.what()
+                  << std::endl;
+    }
+}
+
+std::optional<ResourceBundle::Contents> ResourceBundle::read(
+    const std::string& pathToBundle, const std::vector<std::string>& sourceDirectories)
+{
+    if (!isBundleUpToDate(pathToBundle, sourceDirectories))
+    {
+        return std::nullopt;
+    }
+
+    std::ifstream file(pathToBundle, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return std::nullopt;
+    }
+    std::vector<unsigned char> bytes(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(bytes.data()),
+                   static_cast<std::streamsize>(bytes.size())))
+    {
+        return std::nullopt;
+    }
+    return decode(bytes.data(), bytes.size());
+}
+
+void ResourceBundle::write(const std::string& pathToBundle, const Contents& contents)
+{
+    const auto bytes = encode(contents);
+    const auto temporaryPath = pathToBundle + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(bytes.data()),
+                   static_cast<std::streamsize>(bytes.size()));
+        if (!file.flush())
+        {
+            std::error_code error;
+            std::filesystem::remove(temporaryPath, error);
+            throw std::runtime_error("Writing the resource bundle: " + temporaryPath +
+                                     " has failed");
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporaryPath, pathToBundle, error);
+    if (error)
+    {
+        std::filesystem::remove(temporaryPath, error);
+        throw std::runtime_error("Replacing the resource bundle: " + pathToBundle +
+                                 " has failed");
+    }
+}
+
+std::vector<unsigned char> ResourceBundle::encode(const Contents& contents)
+{
+    BundleWriter writer;
+    writer.bytes().insert(writer.bytes().end(), MAGIC_NUMBER.cbegin(), MAGIC_NUMBER.cend());
+    writer.writeUint32(FORMAT_VERSION);
+    writeTable(writer, contents.blockTypes, writeBlockType);
+    writeTable(writer, contents.itemTypes, writeItemType);
+    writeTable(writer, contents.recipes, writeRecipe);
+    return std::move(writer.bytes());
+}
+
+std::optional<ResourceBundle::Contents> ResourceBundle::decode(const unsigned char* data,
+                                                               std::size_t size)
+{
+    if (size < MAGIC_NUMBER.size() || !std::equal(MAGIC_NUMBER.cbegin(), MAGIC_NUMBER.cend(), data))
+    {
+        return std::nullopt;
+    }
+
+    BundleReader reader(data + MAGIC_NUMBER.size(), size - MAGIC_NUMBER.size());
+    if (reader.readUint32() != FORMAT_VERSION)
+    {
+        return std::nullopt;
+    }
+
+    Contents contents;
+    contents.blockTypes = readTable(reader, readBlockType);
+    contents.itemTypes = readTable(reader, readItemType);
+    contents.recipes = readTable(reader, readRecipe);
+    if (reader.hasFailed() || !reader.isAtEnd() || !isBlockTableComplete(contents.blockTypes))
+    {
+        return std::nullopt;
+    }
+    return contents;
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "World/Block/BlockType.h"
+#include "World/Crafting/Recipe.h"
+#include "World/Item/ItemType.h"
+
+/**
+ * @brief A single binary file holding the already parsed block, item and recipe tables, so that
+ * the game does not have to read and parse every configuration file at startup.
+ *
+ * The bundle is baked on the first run from the tables parsed from the configuration files. It is
+ * used only when it has the current format version and is newer than every configuration file,
+ * otherwise the configuration files are parsed again and the bundle is baked anew. The whole
+ * bundle is read with a single read.
+ */
+class ResourceBundle
+{
+public:
+    /**
+     * @brief Path to the bundle, next to the settings of the game.
+     */
+    static inline const std::string BUNDLE_PATH = "resources.bundle";
+
+    /**
+     * @brief Directories with the configuration files the bundle is made of.
+     */
+    static inline const std::vector<std::string> SOURCE_DIRECTORIES = {"resources/blocks",
+                                                                       "resources/items"};
+
+    /**
+     * @brief Tables stored in the bundle.
+     */
+    struct Contents
+    {
+        std::vector<BlockType> blockTypes;
+        std::vector<ItemType> itemTypes;
+        std::vector<Recipe> recipes;
+    };
+
+    /**
+     * @brief Returns the contents of the game bundle. The bundle is read only once, at first use.
+     * @return Contents of the bundle, or nothing if it is missing, outdated or damaged.
+     */
+    static const std::optional<Contents>& bundle();
+
+    /**
+     * @brief Bakes the tables loaded by BlockMap, ItemMap and RecipeContainer into the game bundle,
+     * unless they have been read from it. A bundle which can not be written is only reported, as
+     * the game does not need it.
+     */
+    static void bakeIfOutdated();
+
+    /**
+     * @brief Reads the bundle if it is newer than every file of the given directories.
+     * @param pathToBundle Path to the bundle.
+     * @param sourceDirectories Directories with the files the bundle is made of.
+     * @return Contents of the bundle, or nothing if it is missing, outdated or damaged.
+     */
+    static std::optional<Contents> read(const std::string& pathToBundle,
+                                        const std::vector<std::string>& sourceDirectories);
+
+    /**
+     * @brief Writes the bundle. It is first written next to the target and then replaces it, so
+     * the bundle is never left half written.
+     * @param pathToBundle Path to the bundle.
+     * @param contents Tables to store in the bundle.
+     */
+    static void write(const std::string& pathToBundle, const Contents& contents);
+
+    /**
+     * @brief Converts the tables into the binary form stored in the bundle.
+     * @param contents Tables to convert.
+     * @return Bytes of the bundle.
+     */
+    static std::vector<unsigned char> encode(const Contents& contents);
+
+    /**
+     * @brief Converts the bytes of the bundle back into the tables.
+     * @param data Bytes of the bundle.
+     * @param size Number of bytes.
+     * @return The tables, or nothing if the bytes have another format version, are damaged or
+     * do not hold every block.
+     */
+    static std::optional<Contents> decode(const unsigned char* data, std::size_t size);
+
+private:
+    static constexpr std::array<char, 4> MAGIC_NUMBER = {'M', 'F', 'R', 'B'};
+    static constexpr std::uint32_t FORMAT_VERSION = 2;
+};
@@ -0,0 +1,134 @@
+#include "ResourceLoader.h"
+#include "pch.h"
+
+#include <memory>
+
+namespace
+{
+
+std::chrono::microseconds elapsedSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                 start);
+}
+
+}// namespace
+
+ResourceLoader::ResourceLoader()
+    : mStart(std::chrono::steady_clock::now())
+{
+}
+
+void ResourceLoader::loadTexture(TextureManager& textures, TextureManagerId id,
+                                 const std::string& pathToFile)
+{
+    enqueue(pathToFile,
+            [&textures, id, pathToFile]() -> Upload
+            {
+                auto image = std::make_shared<sf::Image>();
+                if (!image->loadFromFile(pathToFile))
+                {
+                    throw std::runtime_error("This file does not exist: " + pathToFile);
+                }
+
+                return [&textures, id, pathToFile, image]
+                {
+                    auto texture = std::make_unique<sf::Texture>();
+                    if (!texture->loadFromImage(*image))
+                    {
+                        throw std::runtime_error("Unable to create the texture of: " + pathToFile);
+                    }
+                    textures.storeResource(id, std::move(texture));
+                };
+            });
+}
+
+void ResourceLoader::loadFont(FontManager& fonts, FontId id, const std::string& pathToFile)
+{
+    enqueue(pathToFile,
+            [&fonts, id, pathToFile]() -> Upload
+            {
+                // Glyphs are rendered into textures only when they are drawn, so the whole font
+                // can be read on the worker
+                auto font = std::make_shared<sf::Font>();
+                if (!font->loadFromFile(pathToFile))
+                {
+                    throw std::runtime_error("This file does not exist: " + pathToFile);
+                }
+
+                return [&fonts, id, font]
+                { fonts.storeResource(id, std::make_unique<sf::Font>(*font)); };
+            });
+}
+
+void ResourceLoader::loadTexturePack(TexturePack& texturePack,
+                                     const std::string& texturePackFolder)
+{
+    enqueue("texture pack " + texturePackFolder,
+            [&texturePack, texturePackFolder]() -> Upload
+            {
+                auto spritesheets = std::make_shared<TexturePack::Spritesheets>(
+                    TexturePack::loadSpritesheets(texturePackFolder));
+
+                return [&texturePack, texturePackFolder, spritesheets]
+                { texturePack.loadTexturePack(texturePackFolder, *spritesheets); };
+            });
+}
+
+void ResourceLoader::run(const std::string& name, std::function<void()> task)
+{
+    enqueue(name,
+            [task = std::move(task)]() -> Upload
+            {
+                task();
+                return [] {};
+            });
+}
+
+void ResourceLoader::finish()
+{
+    for (auto& pendingResource: mPendingResources)
+    {
+        auto [upload, decodeTime] = pendingResource.decoded.get();
+
+        const auto uploadStart = std::chrono::steady_clock::now();
+        upload();
+        mTimings.push_back({pendingResource.name, decodeTime, elapsedSince(uploadStart)});
+    }
+    mPendingResources.clear();
+    mTotalTime = elapsedSince(mStart);
+}
+
+const std::vector<ResourceLoader::Timing>& ResourceLoader::timings() const
+{
+    return mTimings;
+}
+
+void ResourceLoader::report(std::ostream& output) const
+{
+    auto toMilliseconds = [](std::chrono::microseconds time)
+    {
+        return static_cast<double>(time.count()) / 1000.0;
+    };
+
+    for (const auto& timing: mTimings)
+    {
+        output << "[Resources] " << timing.name << ": decoded in "
+               << toMilliseconds(timing.decodeTime) << " ms, uploaded in "
+               << toMilliseconds(timing.uploadTime) << " ms\n";
+    }
+    output << "[Resources] All resources loaded in " << toMilliseconds(mTotalTime) << " ms"
+           << std::endl;
+}
+
+void ResourceLoader::enqueue(const std::string& name, std::function<Upload()> decode)
+{
+    mPendingResources.push_back(
+        {name, std::async(std::launch::async,
+                          [decode = std::move(decode)]
+                          {
+                              const auto decodeStart = std::chrono::steady_clock::now();
+                              auto upload = decode();
+                              return std::make_pair(std::move(upload), elapsedSince(decodeStart));
+                          })});
+}
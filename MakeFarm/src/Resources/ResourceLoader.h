@@ -0,0 +1,113 @@
+#pragma once
+#include <chrono>
+#include <functional>
+#include <future>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Resources/Resources.h"
+
+/**
+ * @brief Loads the resources of the game in parallel.
+ *
+ * Files are read and decoded on worker threads, while only the part which needs the OpenGL
+ * context, like uploading a texture, is done on the thread that calls finish(). The time spent on
+ * every resource is measured, so that the time to reach the main menu can be tracked down.
+ */
+class ResourceLoader
+{
+public:
+    /**
+     * @brief Time spent on loading a single resource.
+     */
+    struct Timing
+    {
+        std::string name;
+
+        /** Time of reading and decoding the resource on a worker thread */
+        std::chrono::microseconds decodeTime;
+
+        /** Time of the part done on the thread owning the OpenGL context */
+        std::chrono::microseconds uploadTime;
+    };
+
+    ResourceLoader();
+
+    /**
+     * @brief Decodes the image on a worker thread and stores it as a texture once finished.
+     * @param textures Manager in which the texture will be stored.
+     * @param id Identifier under which the texture will be stored.
+     * @param pathToFile Path to the image file.
+     */
+    void loadTexture(TextureManager& textures, TextureManagerId id, const std::string& pathToFile);
+
+    /**
+     * @brief Reads the font on a worker thread and stores it once finished.
+     * @param fonts Manager in which the font will be stored.
+     * @param id Identifier under which the font will be stored.
+     * @param pathToFile Path to the font file.
+     */
+    void loadFont(FontManager& fonts, FontId id, const std::string& pathToFile);
+
+    /**
+     * @brief Decodes the spritesheets of the texture pack on a worker thread and loads the texture
+     * pack with them once finished.
+     * @param texturePack Texture pack to load.
+     * @param texturePackFolder Name of the folder with the texture pack.
+     */
+    void loadTexturePack(TexturePack& texturePack, const std::string& texturePackFolder);
+
+    /**
+     * @brief Runs a task which does not need the OpenGL context on a worker thread.
+     * @param name Name of the task in the timings.
+     * @param task The task to run.
+     */
+    void run(const std::string& name, std::function<void()> task);
+
+    /**
+     * @brief Waits for all the workers and finishes loading their resources on the calling thread.
+     * @warning It must be called on the thread owning the OpenGL context. If loading of any
+     * resource failed, its exception is rethrown here.
+     */
+    void finish();
+
+    /**
+     * @brief Returns the time spent on every resource.
+     * @return Timings of the resources in the order they were requested.
+     */
+    [[nodiscard]] const std::vector<Timing>& timings() const;
+
+    /**
+     * @brief Writes the time spent on every resource and the time of the whole loading.
+     * @param output Stream to which the timings are written.
+     */
+    void report(std::ostream& output) const;
+
+private:
+    /**
+     * @brief Part of loading a resource that is done on the thread owning the OpenGL context.
+     */
+    using Upload = std::function<void()>;
+
+    /**
+     * @brief Runs the decoding on a worker thread, measuring its time.
+     * @param name Name of the resource in the timings.
+     * @param decode Function decoding the resource and returning the rest of its loading.
+     */
+    void enqueue(const std::string& name, std::function<Upload()> decode);
+
+    /**
+     * @brief Resource which is being decoded on a worker thread.
+     */
+    struct PendingResource
+    {
+        std::string name;
+        std::future<std::pair<Upload, std::chrono::microseconds>> decoded;
+    };
+
+    std::chrono::steady_clock::time_point mStart;
+    std::chrono::microseconds mTotalTime{0};
+    std::vector<PendingResource> mPendingResources;
+    std::vector<Timing> mTimings;
+};
@@ -56,6 +56,15 @@ public:
     void storeResource(Identifier id, const std::string& path_to_file,
                        const Additional_Parameter& parameter);
 
+    /**
+     * \brief Assigns a given id to a resource which has already been loaded
+     * \param id Identifier to which the resource is to be assigned
+     * \param resource The loaded resource
+     *
+     * Allows the resource to be loaded elsewhere, for example decoded on another thread
+     */
+    void storeResource(Identifier id, std::unique_ptr<Resource> resource);
+
 
 private:
     /**
@@ -159,5 +168,13 @@ void ResourceManager<Resource, Identifier>::storeResource(Identifier id,
     // for Release version of the program is optimized as it ignores this line.
 }
 
+template<typename Resource, typename Identifier>
+void ResourceManager<Resource, Identifier>::storeResource(Identifier id,
+                                                          std::unique_ptr<Resource> resource)
+{
+    auto inserted_resource = ResourceMap.insert(std::make_pair(id, std::move(resource)));
+
+    assert(inserted_resource.second);// Tried to insert resource multiple times
+}
 
 #endif
\ No newline at end of file
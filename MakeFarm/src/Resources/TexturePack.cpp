@@ -9,13 +9,19 @@ TexturePack::TexturePack(const std::string& texturePackFolder)
 }
 
 void TexturePack::loadTexturePack(const std::string& texturePackFolder)
+{
+    loadTexturePack(texturePackFolder, loadSpritesheets(texturePackFolder));
+}
+
+void TexturePack::loadTexturePack(const std::string& texturePackFolder,
+                                  const Spritesheets& spritesheets)
 {
     mTexturePackSettings.openFile("resources/textures/texturePacks/" + texturePackFolder +
                                   "/config.cfg");
     mTexturePackName = mTexturePackSettings.get<std::string>("Name");
     mTextureSize = mTexturePackSettings.get<int>("TextureSize");
-    mBlocks.loadFromFile("resources/textures/texturePacks/" + texturePackFolder + "/blocks.png");
-    mItems.loadFromFile("resources/textures/texturePacks/" + texturePackFolder + "/items.png");
+    mBlocks.loadFromImage(spritesheets.blocks);
+    mItems.loadFromImage(spritesheets.items);
     mTexturePackSettings.closeFile();
 
     if ((mBlocks.getSize().x % mTextureSize) && (mBlocks.getSize().y % mTextureSize))
@@ -31,6 +37,16 @@ void TexturePack::loadTexturePack(const std::string& texturePackFolder)
     }
 }
 
+TexturePack::Spritesheets TexturePack::loadSpritesheets(const std::string& texturePackFolder)
+{
+    Spritesheets spritesheets;
+    spritesheets.blocks.loadFromFile("resources/textures/texturePacks/" + texturePackFolder +
+                                     "/blocks.png");
+    spritesheets.items.loadFromFile("resources/textures/texturePacks/" + texturePackFolder +
+                                    "/items.png");
+    return spritesheets;
+}
+
 void TexturePack::bind(const Spritesheet& textures) const
 {
     switch (textures)
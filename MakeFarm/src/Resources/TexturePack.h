@@ -22,12 +22,37 @@ public:
         Items
     };
 
+    /**
+     * @brief Decoded images of the spritesheets, not yet sent to the graphics card.
+     */
+    struct Spritesheets
+    {
+        sf::Image blocks;
+        sf::Image items;
+    };
+
     /**
      * Allows to load any texture pack from the resources folder
      * @param texturePackFolder Name of the folder with the texture pack
      */
     void loadTexturePack(const std::string& texturePackFolder);
 
+    /**
+     * @brief Loads the texture pack from the already decoded spritesheets
+     * @param texturePackFolder Name of the folder with the texture pack
+     * @param spritesheets Spritesheets of the texture pack
+     * @warning It must be called on the thread owning the OpenGL context
+     */
+    void loadTexturePack(const std::string& texturePackFolder, const Spritesheets& spritesheets);
+
+    /**
+     * @brief Decodes the spritesheets of the texture pack. It does not need the OpenGL context, so
+     * it can be called on any thread.
+     * @param texturePackFolder Name of the folder with the texture pack
+     * @return Decoded spritesheets of the texture pack
+     */
+    static Spritesheets loadSpritesheets(const std::string& texturePackFolder);
+
     /**
      * Bind a texture pack for rendering
      */
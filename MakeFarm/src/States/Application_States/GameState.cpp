@@ -4,12 +4,14 @@
 
 #include "World/Item/ItemMap.h"
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Text.hpp>
 #include <filesystem>
 #include <iomanip>
 #include <sstream>
 
 #include "States/StateStack.h"
 #include "Utils/Mouse.h"
+#include "Utils/utils.h"
 #include "World/Block/BlockMap.h"
 #include "World/Chunks/TerrainGenerator.h"
 
@@ -24,6 +26,7 @@ GameState::GameState(StateStack& stack, sf::RenderWindow& window, GameResources&
     , mPlayer(mChunkManager.calculateSpawnPoint(), mGameWindow, m3DWorldRendererShader,
               mChunkManager, mGameResources, mSavedWorldName)
     , mGameSettings("settings.cfg")
+    , mAutosave(mChunkManager, mPlayer, mGameSettings)
 {
     Mouse::lockMouseAtCenter(mGameWindow);
     m3DWorldRendererShader.loadFromFile("resources/shaders/3DWorldRenderer/VertexShader.shader",
@@ -150,6 +153,29 @@ void GameState::updateDebugMenu()
                     }
                     ImGui::EndMenu();
                 }
+                if (ImGui::MenuItem("Switch Chunk Borders (on/off)"))
+                {
+                    mChunkManager.toggleChunkBorders();
+                }
+                if (ImGui::BeginMenu("Chunk Saves"))
+                {
+                    const auto saveStatistics = mChunkManager.saveStatistics();
+                    ImGui::Text("Performed: %zu", saveStatistics.performedSaves);
+                    ImGui::Text("Skipped: %zu", saveStatistics.skippedSaves);
+                    ImGui::Text("Written: %llu bytes",
+                                static_cast<unsigned long long>(saveStatistics.writtenBytes));
+                    ImGui::EndMenu();
+                }
+                if (ImGui::BeginMenu("Autosave"))
+                {
+                    const auto autosaveMetrics = mAutosave.metrics();
+                    ImGui::Text("Finished cycles: %zu", autosaveMetrics.finishedCycles);
+                    ImGui::Text("Last cycle written: %llu bytes",
+                                static_cast<unsigned long long>(autosaveMetrics.writtenBytes));
+                    ImGui::Text("Last cycle duration: %lld ms",
+                                static_cast<long long>(autosaveMetrics.duration.count()));
+                    ImGui::EndMenu();
+                }
                 ImGui::EndMenu();
             }
 
@@ -170,10 +196,15 @@ void GameState::updateDebugMenu()
 bool GameState::update(const float& deltaTime)
 {
     mPlayer.update(deltaTime);
+    mPlayer.camera().updateViewProjection(mOverlayRenderer.shader());
 
-    mChunkManager.update(deltaTime, mPlayer.camera());
+    mChunkManager.update(deltaTime);
     mChunkManager.generateChunksAround(mPlayer.position());
     mChunkManager.clearFarAwayChunks(mPlayer.position());
+    mChunkManager.drawOverlay(mOverlayRenderer);
+    mPlayer.drawOverlay(mOverlayRenderer);
+    mOverlayRenderer.finishFrame();
+    mAutosave.update(deltaTime);
     updateDebugMenu();
     checkIfPlayerIsDead(deltaTime);
 
@@ -193,6 +224,7 @@ void GameState::checkIfPlayerIsDead(const float& deltaTime)
 void GameState::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
     mChunkManager.draw(mGameRenderer, m3DWorldRendererShader);
+    mOverlayRenderer.draw(mGameRenderer);
     mPlayer.draw(mGameRenderer, target, states);
 }
 
@@ -208,7 +240,27 @@ void GameState::saveGameDataToFile()
     mSerializer.saveToFile(gameDataSaveFilePath());
 }
 
+void GameState::drawSavingIndicator(std::size_t savedChunks, std::size_t allChunks)
+{
+    sf::Text savingText;
+    savingText.setFont(mGameResources.fontManager.getResourceReference(FontId::ArialNarrow));
+    savingText.setOutlineThickness(1.f);
+    savingText.setOutlineColor(sf::Color::Black);
+    savingText.setCharacterSize(48);
+    savingText.setString("Saving the world... " + std::to_string(savedChunks) + "/" +
+                         std::to_string(allChunks));
+    centerOrigin(savingText);
+    savingText.setPosition(mGameWindow.getSize().x / 2.f, mGameWindow.getSize().y / 2.f);
+
+    GLCall(glClearColor(0.43f, 0.69f, 1.0f, 1.0f));
+    GLCall(glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT));
+    SfmlDraw(savingText, mGameWindow, sf::RenderStates::Default);
+    mGameWindow.display();
+}
+
 GameState::~GameState()
 {
+    mChunkManager.saveBeforeClosing([this](std::size_t savedChunks, std::size_t allChunks)
+                                    { drawSavingIndicator(savedChunks, allChunks); });
     saveGameDataToFile();
 }
\ No newline at end of file
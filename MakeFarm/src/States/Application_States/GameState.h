@@ -4,12 +4,14 @@
 #include <SFML/Graphics/Shader.hpp>
 
 #include "Player/Player.h"
+#include "Renderer3D/OverlayRenderer.h"
 #include "Renderer3D/Renderer3D.h"
 #include "Resources/Resources.h"
 #include "Resources/TexturePack.h"
 #include "States/State.h"
 #include "Utils/Serializer.h"
 #include "Utils/Settings.h"
+#include "World/Autosave.h"
 #include "World/Block/HighlightedBlock.h"
 #include "World/Chunks/Chunk.h"
 #include "World/Chunks/ChunkManager.h"
@@ -88,11 +90,19 @@ private:
      */
     void waitForAndGenerateChunksBelowPlayer();
 
+    /**
+     * @brief Draws the progress of saving the world while the game is being closed.
+     * @param savedChunks Number of chunks saved so far.
+     * @param allChunks Number of all chunks to save.
+     */
+    void drawSavingIndicator(std::size_t savedChunks, std::size_t allChunks);
+
 private:
     /** Rendering */
     sf::RenderWindow& mGameWindow;//!< Window to which this status is displayed
     sf::Shader m3DWorldRendererShader;
     Renderer3D mGameRenderer;
+    OverlayRenderer mOverlayRenderer;
 
     /** Settings */
     GameResources& mGameResources;
@@ -104,6 +114,7 @@ private:
     /** Utils */
     ChunkManager mChunkManager;
     Player mPlayer;
+    Autosave mAutosave;
     bool isDebugMenuActivated = false;
 };
 
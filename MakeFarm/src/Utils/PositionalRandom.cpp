@@ -0,0 +1,64 @@
+#include "PositionalRandom.h"
+#include "pch.h"
+
+PositionalRandom::PositionalRandom(int seed, std::uint32_t salt)
+    : mKey(mix((static_cast<std::uint64_t>(static_cast<std::uint32_t>(seed)) << 32) | salt))
+{
+}
+
+std::uint64_t PositionalRandom::valueAt(int x, int z) const
+{
+    auto value = mKey ^ (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) *
+                         0x9E3779B97F4A7C15ull);
+    value = mix(value);
+    value ^= static_cast<std::uint64_t>(static_cast<std::uint32_t>(z)) * 0xC2B2AE3D27D4EB4Full;
+    return mix(value);
+}
+
+double PositionalRandom::realNumberAt(int x, int z) const
+{
+    // 53 most significant bits fit exactly in the mantissa of a double
+    return static_cast<double>(valueAt(x, z) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+int PositionalRandom::integerInRangeAt(int min, int max, int x, int z) const
+{
+    const auto range = static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min) + 1;
+    return static_cast<int>(min + static_cast<std::int64_t>(valueAt(x, z) % range));
+}
+
+std::uint64_t PositionalRandom::mix(std::uint64_t value)
+{
+    value += 0x9E3779B97F4A7C15ull;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+PositionalBernoulliDistribution::PositionalBernoulliDistribution(double probability)
+    : mProbability(probability)
+{
+}
+
+bool PositionalBernoulliDistribution::operator()(const PositionalRandom& random, int x,
+                                                 int z) const
+{
+    return random.realNumberAt(x, z) < mProbability;
+}
+
+double PositionalBernoulliDistribution::probability() const
+{
+    return mProbability;
+}
+
+PositionalUniformIntDistribution::PositionalUniformIntDistribution(int min, int max)
+    : mMin(min)
+    , mMax(max)
+{
+}
+
+int PositionalUniformIntDistribution::operator()(const PositionalRandom& random, int x,
+                                                 int z) const
+{
+    return random.integerInRangeAt(mMin, mMax, x, z);
+}
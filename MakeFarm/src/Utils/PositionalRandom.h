@@ -0,0 +1,107 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief Stateless source of randomness that depends only on the seed, the salt and the position
+ * it is asked about. Asking twice about the same position always gives the same answer, so the
+ * world can be regenerated from its seed and one instance can be safely shared between threads.
+ */
+class PositionalRandom
+{
+public:
+    /**
+     * @brief Creates a positional random source.
+     * @param seed The seed of the world.
+     * @param salt Value distinguishing independent decisions made at the same position (for
+     * example whether to place a tree and how tall it should be).
+     */
+    PositionalRandom(int seed, std::uint32_t salt);
+
+    /**
+     * @brief Returns a pseudo-random 64-bit value bound to the given position.
+     * @param x Position x in the world.
+     * @param z Position z in the world.
+     * @return Pseudo-random 64-bit value.
+     */
+    [[nodiscard]] std::uint64_t valueAt(int x, int z) const;
+
+    /**
+     * @brief Returns a pseudo-random real number in range [0, 1) bound to the given position.
+     * @param x Position x in the world.
+     * @param z Position z in the world.
+     * @return Pseudo-random real number in range [0, 1).
+     */
+    [[nodiscard]] double realNumberAt(int x, int z) const;
+
+    /**
+     * @brief Returns a pseudo-random integer in range [min, max] bound to the given position.
+     * @param min The smallest value that can be returned.
+     * @param max The largest value that can be returned.
+     * @param x Position x in the world.
+     * @param z Position z in the world.
+     * @return Pseudo-random integer in range [min, max].
+     */
+    [[nodiscard]] int integerInRangeAt(int min, int max, int x, int z) const;
+
+private:
+    /**
+     * @brief Finalizer of the splitmix64 generator. Spreads every input bit over the whole output.
+     * @param value Value to mix.
+     * @return Mixed value.
+     */
+    static std::uint64_t mix(std::uint64_t value);
+
+private:
+    std::uint64_t mKey;
+};
+
+/**
+ * @brief Positional counterpart of std::bernoulli_distribution. Decides whether something should
+ * happen at the given position with a given probability.
+ */
+class PositionalBernoulliDistribution
+{
+public:
+    explicit PositionalBernoulliDistribution(double probability = 0.5);
+
+    /**
+     * @brief Decides whether something should happen at the given position.
+     * @param random Positional random source.
+     * @param x Position x in the world.
+     * @param z Position z in the world.
+     * @return True with the probability of this distribution, false otherwise.
+     */
+    bool operator()(const PositionalRandom& random, int x, int z) const;
+
+    /**
+     * @brief Returns the probability of the positive outcome.
+     * @return The probability of the positive outcome.
+     */
+    [[nodiscard]] double probability() const;
+
+private:
+    double mProbability;
+};
+
+/**
+ * @brief Positional counterpart of std::uniform_int_distribution. Draws an integer in range [min,
+ * max] for the given position.
+ */
+class PositionalUniformIntDistribution
+{
+public:
+    PositionalUniformIntDistribution(int min, int max);
+
+    /**
+     * @brief Draws an integer for the given position.
+     * @param random Positional random source.
+     * @param x Position x in the world.
+     * @param z Position z in the world.
+     * @return Integer in range [min, max].
+     */
+    int operator()(const PositionalRandom& random, int x, int z) const;
+
+private:
+    int mMin;
+    int mMax;
+};
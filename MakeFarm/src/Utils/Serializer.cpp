@@ -9,4 +9,9 @@ void Serializer::saveToFile(const std::string& pathToFile)
     outfile.write(reinterpret_cast<const char*>(mSerializedData.data()),
                   mSerializedData.size() * sizeof(char));
     outfile.close();
+}
+
+const std::vector<unsigned char>& Serializer::serializedData() const
+{
+    return mSerializedData;
 }
\ No newline at end of file
@@ -18,7 +18,8 @@ public:
     void saveToFile(const std::string& pathToFile);
 
     /**
-     * @brief Serializes passed data by converting it to byte form
+     * @brief Serializes passed data by converting it to byte form. Previously serialized data is
+     * discarded.
      * @tparam Ts Types of data to be serialized
      * @param args Data to be serialized
      */
@@ -34,6 +35,22 @@ public:
     template<typename... Ts>
     void readSerialized(std::ifstream& file, Ts&... args);
 
+    /**
+     * @brief Reads the serialized data from the memory
+     * @tparam Ts Types of variables to which the serialized data are to be read
+     * @param data Pointer to the binary data which should be read.
+     * @param size Size of the binary data in bytes.
+     * @param args Variables to which the serialized data are to be read
+     */
+    template<typename... Ts>
+    void readSerialized(const unsigned char* data, std::size_t size, Ts&... args);
+
+    /**
+     * @brief Returns the most recently serialized data in byte form
+     * @return Serialized data
+     */
+    [[nodiscard]] const std::vector<unsigned char>& serializedData() const;
+
 private:
     std::vector<unsigned char> mSerializedData;
 };
@@ -41,6 +58,7 @@ private:
 template<typename... Ts>
 void Serializer::serialize(Ts&&... args)
 {
+    mSerializedData.clear();
     zpp::serializer::memory_output_archive out(mSerializedData);
     out(std::forward<Ts>(args)...);
 }
@@ -48,9 +66,20 @@ void Serializer::serialize(Ts&&... args)
 template<typename... Ts>
 void Serializer::readSerialized(std::ifstream& file, Ts&... args)
 {
-    std::istreambuf_iterator<char> iter(file);
-    std::vector<char> vec(iter, std::istreambuf_iterator<char>{});
-    std::vector<unsigned char> data(vec.begin(), vec.end());
-    zpp::serializer::memory_input_archive in(data);
+    // The rest of the file is read at once into the reused buffer and decoded straight from it
+    const auto start = file.tellg();
+    file.seekg(0, std::ios::end);
+    const auto size = static_cast<std::size_t>(file.tellg() - start);
+    file.seekg(start);
+
+    mSerializedData.resize(size);
+    file.read(reinterpret_cast<char*>(mSerializedData.data()), static_cast<std::streamsize>(size));
+    readSerialized(mSerializedData.data(), mSerializedData.size(), args...);
+}
+
+template<typename... Ts>
+void Serializer::readSerialized(const unsigned char* data, std::size_t size, Ts&... args)
+{
+    zpp::serializer::memory_view_input_archive in(data, size);
     in(std::forward<Ts>(args)...);
 }
\ No newline at end of file
@@ -1,28 +1,53 @@
 #include "Settings.h"
 #include "pch.h"
 
+#include <filesystem>
+
 Settings::Settings(const std::string& fileName)
-    : mSettingsFilename(fileName)
 {
     openFile(fileName);
 }
 
 void Settings::openFile(const std::string& fileName)
 {
+    std::ifstream settingsFile(fileName);
+    if (!settingsFile)
+    {
+        throw std::logic_error("Opening a file: " + fileName + " has failed");
+    }
+
     mSettingsFilename = fileName;
-    mSettingsFile.open(mSettingsFilename);
+    mLines.clear();
+    mSettings.clear();
 
-    if (!mSettingsFile)
+    std::string fileLine;
+    bool isInsideCrafting = false;
+    while (std::getline(settingsFile, fileLine))
     {
-        throw std::logic_error("Opening a file: " + fileName + " has failed");
+        auto [settingName, settingValue] = splitLine(fileLine);
+        if (settingName == "Crafting")
+        {
+            isInsideCrafting = true;
+        }
+        else if (settingName == "EndCrafting")
+        {
+            isInsideCrafting = false;
+        }
+        else if (!isInsideCrafting && !settingName.empty())
+        {
+            // Just like before, the first occurrence of the setting is the one that counts
+            mSettings.try_emplace(std::move(settingName),
+                                  Setting{std::move(settingValue), mLines.size()});
+        }
+        mLines.push_back(std::move(fileLine));
     }
 }
 
 void Settings::closeFile()
 {
-    mSettingsFile.close();
     mSettingsFilename = "";
-    mSettingsFile.clear();
+    mLines.clear();
+    mSettings.clear();
 }
 
 bool Settings::isPresent(const std::string& settingName) const
@@ -32,42 +57,48 @@ bool Settings::isPresent(const std::string& settingName) const
         throw std::logic_error("Trying to get content of file of unknown/closed name");
     }
 
-    prepareToReadFromFstreamAgain();
+    return mSettings.contains(settingName);
+}
 
-    std::string fileLine;
-    while (std::getline(mSettingsFile, fileLine))
-    {
-        std::stringstream ss(fileLine);
-        std::string foundSetting;
+std::pair<std::string, std::string> Settings::splitLine(const std::string& line)
+{
+    std::stringstream ss(line);
+    std::string foundSetting;
 
-        std::string word;
+    // Now I extract the settingName part
+    // settingName = settingValue
+    // ^^^^^^^^^^^
+    // foundSetting
+    std::string word;
+    while (ss >> word && word != "=")
+    {
+        foundSetting += word;
+    }
 
-        while (ss >> word && word != "=")
-        {
-            foundSetting += word;
-        }
+    // Now I'm removing white spaces at the beginning and take the settingValue part
+    std::string settingValue;
+    ss >> std::ws;
+    std::getline(ss, settingValue);
+    return {foundSetting, settingValue};
+}
 
-        bool stopParsing = false;
-        if (foundSetting == "Crafting")
-        {
-            stopParsing = true;
-        }
-        else if (foundSetting == "EndCrafting")
+void Settings::saveFile() const
+{
+    const auto temporaryFilename = mSettingsFilename + ".tmp";
+    {
+        std::ofstream settingsFileWrite(temporaryFilename, std::ios::trunc);
+        for (const auto& fileLine: mLines)
         {
-            stopParsing = false;
+            settingsFileWrite << fileLine << "\n";
         }
 
-
-        if (!stopParsing && foundSetting == settingName)
+        if (!settingsFileWrite.flush())
         {
-            return true;
+            throw std::runtime_error("Writing the settings file: " + temporaryFilename +
+                                     " has failed");
         }
     }
-    return false;
-}
 
-void Settings::prepareToReadFromFstreamAgain() const
-{
-    mSettingsFile.clear();
-    mSettingsFile.seekg(0);
+    // Replacing the file with rename never leaves it half written
+    std::filesystem::rename(temporaryFilename, mSettingsFilename);
 }
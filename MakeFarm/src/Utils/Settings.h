@@ -1,10 +1,17 @@
 #pragma once
 #include <fstream>
+#include <limits>
 #include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 
 /**
  * \brief A class used to read game settings
+ *
+ * The file is read and split into settings once when it is opened, so reading the settings later
+ * is only a lookup in memory. Lines between Crafting and EndCrafting are not treated as settings.
  */
 class Settings : sf::NonCopyable
 {
@@ -14,7 +21,7 @@ public:
     virtual ~Settings() = default;
 
     /**
-     * Opens game settings file
+     * Opens game settings file and reads all of its settings
      * @param fileName Name of the settings file
      */
     void openFile(const std::string& fileName);
@@ -26,7 +33,7 @@ public:
 
     /**
      * Reads the value of the setting under the specified name from the currently opened settings
-     * file. If there is no such setting, it throws an error.
+     * file. If there is no such setting, or its value is not of the given type, it throws an error.
      * @tparam T Type of value hiding under a given setting
      * @param settingName The name of the setting to read from the settings file
      * @return The value hiding under the given setting name in the currently open settings file
@@ -43,7 +50,8 @@ public:
 
     /**
      * Writes a new setting with the specified name and specified value to the currently open
-     * settings file.
+     * settings file. The file is written next to the old one and then replaces it, so it is never
+     * left half written.
      * @tparam T The type of value that will be written to the file
      * @param settingName The name of the setting to write to the settings file
      * @param value Value for a given setting name
@@ -62,13 +70,41 @@ protected:
     T parseResult(const std::string& settingResult) const;
 
     /**
-     * @brief If a file has been read before, to read it from the beginning you have to reset it,
-     * which this function does.
+     * @brief Converts the number with the whole setting entry, so that values like "12abc" are not
+     * read as 12.
+     * @param settingResult Setting entry to be converted
+     * @param convert Function converting the string like std::stoi, which reports the number of
+     * characters it has processed
+     * @return The converted value
      */
-    void prepareToReadFromFstreamAgain() const;
+    template<typename Convert>
+    auto parseNumber(const std::string& settingResult, Convert convert) const;
+
+    /**
+     * @brief Splits the line into the setting name and its value.
+     * @param line Line of the settings file in the form of "settingName = settingValue"
+     * @return Pair of the setting name and its value
+     */
+    static std::pair<std::string, std::string> splitLine(const std::string& line);
+
+    /**
+     * @brief Writes all lines of the settings file to a temporary file and replaces the settings
+     * file with it.
+     */
+    void saveFile() const;
+
+    /**
+     * @brief Value of a setting along with the line of the file where it was found.
+     */
+    struct Setting
+    {
+        std::string value;
+        std::size_t lineIndex;
+    };
 
     std::string mSettingsFilename;
-    mutable std::ifstream mSettingsFile;
+    std::vector<std::string> mLines;
+    std::unordered_map<std::string, Setting> mSettings;
 };
 
 
@@ -80,47 +116,26 @@ T Settings::get(const std::string& settingName) const
         throw std::logic_error("Trying to get content of file of unknown/closed file");
     }
 
-    prepareToReadFromFstreamAgain();
-
-    std::string fileLine;
-    bool stopParsing = false;
-    while (std::getline(mSettingsFile, fileLine))
+    const auto setting = mSettings.find(settingName);
+    if (setting == mSettings.cend())
     {
-        std::stringstream ss(fileLine);
-        std::string foundSetting;
-
-        // Now I extract the settingName part
-        // settingName = settingValue
-        // ^^^^^^^^^^^
-        // foundSetting
-        std::string word;
-        while (ss >> word && word != "=")
-        {
-            foundSetting += word;
-        }
-
-        if (foundSetting == "Crafting")
-        {
-            stopParsing = true;
-        }
-        else if (foundSetting == "EndCrafting")
-        {
-            stopParsing = false;
-        }
+        throw std::runtime_error("No such setting found: " + settingName);
+    }
 
-        if (!stopParsing && foundSetting == settingName)
-        {
-            // Now I'm removing white spaces at the beginning
-            // and return the settingValue part
-            // settingName = settingValue
-            //               ^^^^^^^^^^^^
-            //               foundSetting
-            ss >> std::ws;
-            std::getline(ss, foundSetting);
-            return parseResult<T>(foundSetting);
-        }
+    try
+    {
+        return parseResult<T>(setting->second.value);
+    }
+    catch (const std::invalid_argument&)
+    {
+        throw std::runtime_error("Invalid value of setting " + settingName + " in " +
+                                 mSettingsFilename + ": " + setting->second.value);
+    }
+    catch (const std::out_of_range&)
+    {
+        throw std::runtime_error("Value of setting " + settingName + " in " + mSettingsFilename +
+                                 " is out of range: " + setting->second.value);
     }
-    throw std::runtime_error("No such setting found: " + settingName);
 }
 
 template<typename T>
@@ -131,37 +146,34 @@ void Settings::set(const std::string& settingName, const T& value)
         throw std::logic_error("Trying to get content of file of unknown/closed file");
     }
 
-    // Check if the setting is present there
-    std::ofstream settingsFileWrite("temp-" + mSettingsFilename);
-
-    bool found = false;
+    std::ostringstream valueStream;
+    valueStream << value;
+    const auto line = settingName + " = " + valueStream.str();
 
-    std::string fileLine;
-    while (std::getline(mSettingsFile, fileLine))
+    if (const auto setting = mSettings.find(settingName); setting != mSettings.end())
     {
-        if (fileLine.rfind(settingName, 0) == 0)
-        {
-            settingsFileWrite << settingName << " = " << std::to_string(value) << "\n";
-            found = true;
-        }
-        else
-        {
-            settingsFileWrite << fileLine << "\n";
-        }
+        setting->second.value = valueStream.str();
+        mLines[setting->second.lineIndex] = line;
     }
-
-    if (!found)
+    else
     {
-        settingsFileWrite << settingName << " = " << std::to_string(value) << "\n";
+        mSettings.emplace(settingName, Setting{valueStream.str(), mLines.size()});
+        mLines.push_back(line);
     }
 
-    settingsFileWrite.close();
-    closeFile();
-
-    std::remove(mSettingsFilename.c_str());
-    std::rename(("temp-" + mSettingsFilename).c_str(), mSettingsFilename.c_str());
+    saveFile();
+}
 
-    openFile(mSettingsFilename);
+template<typename Convert>
+auto Settings::parseNumber(const std::string& settingResult, Convert convert) const
+{
+    std::size_t processedCharacters = 0;
+    const auto result = convert(settingResult, &processedCharacters);
+    if (settingResult.find_first_not_of(" \t\r", processedCharacters) != std::string::npos)
+    {
+        throw std::invalid_argument("Trailing characters in: " + settingResult);
+    }
+    return result;
 }
 
 template<typename T>
@@ -173,30 +185,45 @@ T Settings::parseResult(const std::string& settingResult) const
 template<>
 inline int Settings::parseResult(const std::string& settingResult) const
 {
-    return std::stoi(settingResult);
+    return parseNumber(settingResult, [](const std::string& string, std::size_t* index)
+                       { return std::stoi(string, index); });
 }
 
 template<>
 inline unsigned Settings::parseResult(const std::string& settingResult) const
 {
-    return std::stoul(settingResult);
+    const auto result =
+        parseNumber(settingResult, [](const std::string& string, std::size_t* index)
+                    { return std::stoul(string, index); });
+    if (settingResult.find('-') != std::string::npos ||
+        result > std::numeric_limits<unsigned>::max())
+    {
+        throw std::out_of_range("Not an unsigned value: " + settingResult);
+    }
+    return static_cast<unsigned>(result);
 }
 
 template<>
 inline float Settings::parseResult(const std::string& settingResult) const
 {
-    return std::stof(settingResult);
+    return parseNumber(settingResult, [](const std::string& string, std::size_t* index)
+                       { return std::stof(string, index); });
 }
 
 template<>
 inline double Settings::parseResult(const std::string& settingResult) const
 {
-    return std::stod(settingResult);
+    return parseNumber(settingResult, [](const std::string& string, std::size_t* index)
+                       { return std::stod(string, index); });
 }
 
 template<>
 inline bool Settings::parseResult(const std::string& settingResult) const
 {
+    if (settingResult.empty())
+    {
+        throw std::invalid_argument("Empty boolean provided");
+    }
     if (std::isdigit(settingResult[0]))
     {
         return (settingResult == "0" ? false : true);
@@ -0,0 +1,98 @@
+#include "Autosave.h"
+#include "pch.h"
+
+#include "Player/Player.h"
+#include "Utils/Settings.h"
+#include "World/Chunks/ChunkManager.h"
+
+Autosave::Autosave(ChunkManager& chunkManager, Player& player, const Settings& settings)
+    : mChunkManager(chunkManager)
+    , mPlayer(player)
+    , mInterval(DEFAULT_INTERVAL)
+{
+    if (settings.isPresent("AutosaveInterval"))
+    {
+        // Zero would start a new cycle in every frame
+        const auto interval = settings.get<int>("AutosaveInterval");
+        if (interval > 0)
+        {
+            mInterval = std::chrono::seconds(interval);
+        }
+        else
+        {
+            std::cout << "[Autosave] Ignoring AutosaveInterval which is not positive: " << interval
+                      << std::endl;
+        }
+    }
+
+    auto bandwidthLimit = DEFAULT_BANDWIDTH_LIMIT;
+    if (settings.isPresent("AutosaveBandwidthLimit"))
+    {
+        const auto configuredBandwidthLimit = settings.get<float>("AutosaveBandwidthLimit");
+        if (configuredBandwidthLimit >= 0.f)
+        {
+            bandwidthLimit = configuredBandwidthLimit;
+        }
+        else
+        {
+            std::cout << "[Autosave] Ignoring negative AutosaveBandwidthLimit: "
+                      << configuredBandwidthLimit << std::endl;
+        }
+    }
+    constexpr auto BYTES_PER_MEGABYTE = 1024.f * 1024.f;
+    mChunkManager.limitSaveBandwidth(static_cast<std::size_t>(bandwidthLimit * BYTES_PER_MEGABYTE));
+}
+
+void Autosave::update(const float& deltaTime)
+{
+    finishCycleIfWritten();
+
+    mTimeSinceLastCycle += std::chrono::duration<float>(deltaTime);
+    if (mTimeSinceLastCycle >= mInterval && !mCycle.valid())
+    {
+        mTimeSinceLastCycle = std::chrono::duration<float>::zero();
+        beginCycle();
+    }
+}
+
+Autosave::Metrics Autosave::metrics() const
+{
+    return mMetrics;
+}
+
+void Autosave::beginCycle()
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto batch = mChunkManager.beginSaveBatch(true);
+
+    // Chunks which did not change since they were last saved are skipped
+    mChunkManager.saveAllChunks(batch);
+    mPlayer.saveInBackground(batch);
+
+    mCycle = std::async(std::launch::async,
+                        [this, start, batch]
+                        {
+                            const auto writtenBytes =
+                                mChunkManager.waitUntilSaveBatchIsWritten(batch);
+                            return Metrics{writtenBytes,
+                                           std::chrono::duration_cast<std::chrono::milliseconds>(
+                                               std::chrono::steady_clock::now() - start)};
+                        });
+}
+
+void Autosave::finishCycleIfWritten()
+{
+    if (mCycle.valid() && mCycle.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+        const auto finishedCycles = mMetrics.finishedCycles + 1;
+        try
+        {
+            mMetrics = mCycle.get();
+        }
+        catch (const std::exception& exception)
+        {
+            std::cout << "[Autosave] Unable to save the world: " << exception.what() << std::endl;
+        }
+        mMetrics.finishedCycles = finishedCycles;
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <chrono>
+#include <future>
+
+class ChunkManager;
+class Player;
+class Settings;
+
+/**
+ * @brief Saves the world periodically while the game is played, so that little is lost if the game
+ * is not closed properly.
+ *
+ * Every cycle hands over the chunks changed since they were last saved, the player and their
+ * inventory to the background threads saving the chunks, so the frame only pays for taking their
+ * snapshots. They are handed over as a single batch, so the cycle waits only for its own saves and
+ * measures only its own writes. The writes of the autosave are limited to a configured number of
+ * megabytes per second, so the autosave does not compete with loading the chunks for the disk.
+ * Chunks saved because they are unloaded are not limited, as they free memory.
+ */
+class Autosave
+{
+public:
+    /**
+     * @brief Time between consecutive cycles, used when the settings do not specify it.
+     */
+    static constexpr std::chrono::seconds DEFAULT_INTERVAL{60};
+
+    /**
+     * @brief Megabytes written per second by the saving threads, used when the settings do not
+     * specify it.
+     */
+    static constexpr float DEFAULT_BANDWIDTH_LIMIT = 4.f;
+
+    /**
+     * @brief Describes the last finished cycle of the autosave.
+     */
+    struct Metrics
+    {
+        /** Bytes written by the saves of the cycle */
+        std::uint64_t writtenBytes = 0;
+
+        /** Time from handing over the data to having all of it written */
+        std::chrono::milliseconds duration{0};
+
+        /** Number of cycles finished so far */
+        std::size_t finishedCycles = 0;
+    };
+
+    /**
+     * @brief Reads the configuration of the autosave and limits the bandwidth of the saving
+     * threads.
+     * @param chunkManager Chunk manager whose chunks are saved and whose threads save the world.
+     * @param player Player whose state and inventory are saved.
+     * @param settings Game settings which may contain "AutosaveInterval" in seconds and
+     * "AutosaveBandwidthLimit" in megabytes per second. An interval that is not positive or a
+     * negative limit is reported and the default is used instead.
+     */
+    Autosave(ChunkManager& chunkManager, Player& player, const Settings& settings);
+
+    /**
+     * @brief Starts the next cycle once the interval has passed and the previous cycle finished.
+     * @param deltaTime the time that has passed since the game was last updated.
+     */
+    void update(const float& deltaTime);
+
+    /**
+     * @brief Returns the metrics of the last finished cycle.
+     * @return Metrics of the autosave.
+     */
+    [[nodiscard]] Metrics metrics() const;
+
+private:
+    /**
+     * @brief Hands over everything to be saved and measures in the background how long it takes
+     * until it is written.
+     */
+    void beginCycle();
+
+    /**
+     * @brief Collects the metrics of the cycle if its data has already been written. A cycle which
+     * failed to write its data is reported and counted as finished without changing the metrics.
+     */
+    void finishCycleIfWritten();
+
+private:
+    ChunkManager& mChunkManager;
+    Player& mPlayer;
+    std::chrono::duration<float> mInterval;
+    std::chrono::duration<float> mTimeSinceLastCycle{0};
+    std::future<Metrics> mCycle;
+    Metrics mMetrics;
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include "World/Biomes/BiomeId.h"
+#include "Utils/PositionalRandom.h"
 #include "World/Chunks/Chunk.h"
 #include <FastNoiseLite.h>
 
@@ -12,6 +13,22 @@ public:
     Biome(int seed);
     virtual ~Biome() = default;
 
+    /**
+     * @brief An element of the environment (tree, cactus) decided while generating a column of
+     * blocks, which is placed after the whole chunk is generated.
+     */
+    struct Decoration
+    {
+        Block::Coordinate position;
+        int length;
+    };
+
+    /**
+     * @brief Decorations decided for a single chunk. They are owned by the caller generating the
+     * chunk, so that one biome can be shared by many chunks generated at the same time.
+     */
+    using Decorations = std::vector<Decoration>;
+
     static constexpr auto SEA_LEVEL = 60;
     static constexpr auto MINIMAL_TERRAIN_LEVEL = 20;
 
@@ -41,16 +58,24 @@ public:
      * @param blockCoordinateX The x position on which the column of blocks should appear.
      * @param blockCoordinateZ The z position on which the column of blocks should appear.
      * @param surfaceLevel Ground level/grass level.
+     * @param globalColumnCoordinate Position of the column in the world. Decorations are decided
+     * from it, so the same seed always decorates the same column in the same way.
+     * @param decorations Decorations of the chunk to which the decorations decided for this column
+     * are appended.
      */
     virtual void generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chunkBlocks, int surfaceLevel,
-                                        int blockCoordinateX, int blockCoordinateZ) = 0;
+                                        int blockCoordinateX, int blockCoordinateZ,
+                                        const Block::Coordinate& globalColumnCoordinate,
+                                        Decorations& decorations) const = 0;
 
     /**
      * @brief It contains the steps that need to be done after generating the terrain. These include
      * such things as putting up vegetation and general beautification of the world.
      * @param chunk Chunk to be beautified
+     * @param decorations Decorations decided by this biome while generating the chunk
      */
-    virtual void postGenerationPlacements(ChunkInterface& chunk) = 0;
+    virtual void postGenerationPlacements(ChunkInterface& chunk,
+                                          const Decorations& decorations) const = 0;
 
     /**
      * @brief The seed with which the biome is created
@@ -3,10 +3,10 @@
 
 DesertBiome::DesertBiome(int seed)
     : Biome(seed)
-    , rd()
-    , gen(rd())
-    , mCactusDecider(0.003)
+    , mCactusPlacementRandom(seed, CACTUS_PLACEMENT_SALT)
+    , mCactusLengthRandom(seed, CACTUS_LENGTH_SALT)
     , mCactusLengthGenerator(2, 5)
+    , mCactusDecider(0.003)
 {
     mBasicTerrain.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
     mBasicTerrain.SetFrequency(0.03);
@@ -31,10 +31,14 @@ int DesertBiome::surfaceLevelAtGivenPosition(int blockCoordinateX, int blockCoor
 }
 
 void DesertBiome::generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chunkBlocks, int surfaceLevel,
-                                         int blockCoordinateX, int blockCoordinateZ)
+                                         int blockCoordinateX, int blockCoordinateZ,
+                                         const Block::Coordinate& globalColumnCoordinate,
+                                         Decorations& decorations) const
 {
     auto& x = blockCoordinateX;
     auto& z = blockCoordinateZ;
+    const auto& globalX = globalColumnCoordinate.x;
+    const auto& globalZ = globalColumnCoordinate.z;
 
     for (auto y = 0; y < ChunkInterface::BLOCKS_PER_Y_DIMENSION; ++y)
     {
@@ -54,10 +58,11 @@ void DesertBiome::generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chunkBlock
         {
             chunkBlocks[x][y][z] = std::make_unique<Block>(BlockId::Water);
         }
-        else if (y == surfaceLevel + 1 && mCactusDecider(gen))
+        else if (y == surfaceLevel + 1 && mCactusDecider(mCactusPlacementRandom, globalX, globalZ))
         {
             chunkBlocks[x][y][z] = std::make_unique<Block>(BlockId::Cactus);
-            mCactusToPlace.emplace_back(x, y, z);
+            auto cactusLength = mCactusLengthGenerator(mCactusLengthRandom, globalX, globalZ);
+            decorations.push_back({Block::Coordinate(x, y, z), cactusLength});
         }
         else
         {
@@ -66,21 +71,22 @@ void DesertBiome::generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chunkBlock
     }
 }
 
-void DesertBiome::postGenerationPlacements(ChunkInterface& chunk)
+void DesertBiome::postGenerationPlacements(ChunkInterface& chunk,
+                                           const Decorations& decorations) const
 {
-    placeCactuses(chunk);
+    placeCactuses(chunk, decorations);
 }
 
-void DesertBiome::placeCactuses(ChunkInterface& chunk)
+void DesertBiome::placeCactuses(ChunkInterface& chunk, const Decorations& cactuses) const
 {
-    for (auto& coordinateToPlaceCactus: mCactusToPlace)
+    for (auto& cactusToPlace: cactuses)
     {
-        auto cactusLength = mCactusLengthGenerator(gen);
-        for (int i = 0; i < cactusLength; ++i)
+        for (int i = 0; i < cactusToPlace.length; ++i)
         {
-            auto& block = coordinateToPlaceCactus;
+            auto& block = cactusToPlace.position;
             chunk.tryToPlaceBlock(BlockId::Cactus, {block.x, block.y + i, block.z},
-                                  {BlockId::AllBlocks}, RebuildOperation::None);
+                                  {BlockId::AllBlocks}, RebuildOperation::None,
+                                  PlacementOrigin::Generation);
         }
     }
 }
@@ -25,16 +25,23 @@ public:
      * @param blockCoordinateX The x position on which the column of blocks should appear.
      * @param blockCoordinateZ The z position on which the column of blocks should appear.
      * @param surfaceLevel Ground/Terrain level.
+     * @param globalColumnCoordinate Position of the column in the world.
+     * @param decorations Decorations of the chunk to which the decorations decided for this column
+     * are appended.
      */
     void generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chunkBlocks, int surfaceLevel,
-                                int blockCoordinateX, int blockCoordinateZ) override;
+                                int blockCoordinateX, int blockCoordinateZ,
+                                const Block::Coordinate& globalColumnCoordinate,
+                                Decorations& decorations) const override;
 
     /**
      * @brief It contains the steps that need to be done after generating the terrain. These include
      * such things as putting up vegetation and general beautification of the world.
      * @param chunk Chunk to be beautified
+     * @param decorations Decorations decided by this biome while generating the chunk
      */
-    void postGenerationPlacements(ChunkInterface& chunk) override;
+    void postGenerationPlacements(ChunkInterface& chunk,
+                                  const Decorations& decorations) const override;
 
     /**
      * @brief Returns a biome identifier that specifies what biome it is.
@@ -46,8 +53,9 @@ private:
     /**
      * @brief It places cactuses on the given chunk.
      * @param chunk Chunk on which cactuses should appear.
+     * @param cactuses Cactuses decided while generating the chunk.
      */
-    void placeCactuses(ChunkInterface& chunk);
+    void placeCactuses(ChunkInterface& chunk, const Decorations& cactuses) const;
 
 private:
     /**
@@ -57,11 +65,13 @@ private:
     static constexpr auto BASIC_TERRAIN_SQUASHING_FACTOR = 0.15f;
     FastNoiseLite mBasicTerrain;
 
-    std::random_device rd;
-    std::mt19937 gen;
-    std::uniform_int_distribution<int> mCactusLengthGenerator;
-    std::vector<Block::Coordinate> mCactusToPlace;
+    static constexpr std::uint32_t CACTUS_PLACEMENT_SALT = 1;
+    static constexpr std::uint32_t CACTUS_LENGTH_SALT = 2;
+
+    PositionalRandom mCactusPlacementRandom;
+    PositionalRandom mCactusLengthRandom;
+    PositionalUniformIntDistribution mCactusLengthGenerator;
 
 protected:// Ugly testing purpose :c
-    std::bernoulli_distribution mCactusDecider;
+    PositionalBernoulliDistribution mCactusDecider;
 };
\ No newline at end of file
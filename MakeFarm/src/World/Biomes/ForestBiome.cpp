@@ -4,10 +4,10 @@
 
 ForestBiome::ForestBiome(int seed)
     : Biome(seed)
-    , rd()
-    , gen(rd())
-    , mTreeDecider(0.01)
+    , mTreePlacementRandom(seed, TREE_PLACEMENT_SALT)
+    , mTreeLengthRandom(seed, TREE_LENGTH_SALT)
     , mTreeLengthGenerator(5, 9)
+    , mTreeDecider(0.01)
 {
     mBasicTerrain.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
     mBasicTerrain.SetFrequency(0.04);
@@ -38,10 +38,14 @@ int ForestBiome::surfaceLevelAtGivenPosition(int blockCoordinateX, int blockCoor
     return surfaceLevel;
 }
 void ForestBiome::generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chunkBlocks, int surfaceLevel,
-                                         int blockCoordinateX, int blockCoordinateZ)
+                                         int blockCoordinateX, int blockCoordinateZ,
+                                         const Block::Coordinate& globalColumnCoordinate,
+                                         Decorations& decorations) const
 {
     auto& x = blockCoordinateX;
     auto& z = blockCoordinateZ;
+    const auto& globalX = globalColumnCoordinate.x;
+    const auto& globalZ = globalColumnCoordinate.z;
 
     for (auto y = 0; y < ChunkInterface::BLOCKS_PER_Y_DIMENSION; ++y)
     {
@@ -71,10 +75,11 @@ void ForestBiome::generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chunkBlock
         {
             chunkBlocks[x][y][z] = std::make_unique<Block>(BlockId::Water);
         }
-        else if (y == surfaceLevel + 1 && mTreeDecider(gen))
+        else if (y == surfaceLevel + 1 && mTreeDecider(mTreePlacementRandom, globalX, globalZ))
         {
             chunkBlocks[x][y][z] = std::make_unique<Block>(BlockId::Log);
-            mTreesToPlace.emplace_back(x, y, z);
+            auto treeLength = mTreeLengthGenerator(mTreeLengthRandom, globalX, globalZ);
+            decorations.push_back({Block::Coordinate(x, y, z), treeLength});
         }
         else
         {
@@ -82,24 +87,23 @@ void ForestBiome::generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chunkBlock
         }
     }
 }
-void ForestBiome::postGenerationPlacements(ChunkInterface& chunk)
+void ForestBiome::postGenerationPlacements(ChunkInterface& chunk,
+                                           const Decorations& decorations) const
 {
-    placeTrees(chunk);
-    mTreesToPlace.clear();
+    placeTrees(chunk, decorations);
 }
-void ForestBiome::placeTrees(ChunkInterface& chunk)
+void ForestBiome::placeTrees(ChunkInterface& chunk, const Decorations& trees) const
 {
-    for (auto& coordinateToPlaceTree: mTreesToPlace)
+    for (auto& coordinateToPlaceTree: trees)
     {
         placeTree(chunk, coordinateToPlaceTree);
     }
 }
-void ForestBiome::placeTree(ChunkInterface& chunk, const Block::Coordinate& block)
+void ForestBiome::placeTree(ChunkInterface& chunk, const Decoration& tree) const
 {
-    auto treeLength = mTreeLengthGenerator(gen);
-    placeLogOfTheTree(chunk, block, treeLength);
-    placeTopPartOfTreeTopMadeOfLeaves(chunk, block, treeLength);
-    placeBottomPartOfTreeTopMadeOfLeaves(chunk, block, treeLength);
+    placeLogOfTheTree(chunk, tree.position, tree.length);
+    placeTopPartOfTreeTopMadeOfLeaves(chunk, tree.position, tree.length);
+    placeBottomPartOfTreeTopMadeOfLeaves(chunk, tree.position, tree.length);
 }
 void ForestBiome::placeBottomPartOfTreeTopMadeOfLeaves(ChunkInterface& chunk,
                                                        const Block::Coordinate& block,
@@ -112,7 +116,7 @@ void ForestBiome::placeBottomPartOfTreeTopMadeOfLeaves(ChunkInterface& chunk,
         for (int i = 0; i < 24; ++i)
         {
             chunk.tryToPlaceBlock(BlockId::Leaves, coordinatesAround.nextValue(), {BlockId::Air},
-                                  RebuildOperation::None);
+                                  RebuildOperation::None, PlacementOrigin::Generation);
         }
     }
 }
@@ -121,17 +125,18 @@ void ForestBiome::placeTopPartOfTreeTopMadeOfLeaves(ChunkInterface& chunk,
                                                     int treeLength) const
 {
     auto treeTop = sf::Vector3i(block.x, block.y + treeLength, block.z);
-    chunk.tryToPlaceBlock(BlockId::Leaves, {treeTop.x, treeTop.y, treeTop.z});
+    chunk.tryToPlaceBlock(BlockId::Leaves, {treeTop.x, treeTop.y, treeTop.z}, {BlockId::Air},
+                          RebuildOperation::None, PlacementOrigin::Generation);
     for (int i = -1; i < 1; ++i)
     {
         chunk.tryToPlaceBlock(BlockId::Leaves, {treeTop.x + 1, treeTop.y + i, treeTop.z},
-                              {BlockId::Air}, RebuildOperation::None);
+                              {BlockId::Air}, RebuildOperation::None, PlacementOrigin::Generation);
         chunk.tryToPlaceBlock(BlockId::Leaves, {treeTop.x - 1, treeTop.y + i, treeTop.z},
-                              {BlockId::Air}, RebuildOperation::None);
+                              {BlockId::Air}, RebuildOperation::None, PlacementOrigin::Generation);
         chunk.tryToPlaceBlock(BlockId::Leaves, {treeTop.x, treeTop.y + i, treeTop.z + 1},
-                              {BlockId::Air}, RebuildOperation::None);
+                              {BlockId::Air}, RebuildOperation::None, PlacementOrigin::Generation);
         chunk.tryToPlaceBlock(BlockId::Leaves, {treeTop.x, treeTop.y + i, treeTop.z - 1},
-                              {BlockId::Air}, RebuildOperation::None);
+                              {BlockId::Air}, RebuildOperation::None, PlacementOrigin::Generation);
     }
 }
 void ForestBiome::placeLogOfTheTree(ChunkInterface& chunk, const Block::Coordinate& block,
@@ -140,7 +145,7 @@ void ForestBiome::placeLogOfTheTree(ChunkInterface& chunk, const Block::Coordina
     for (int i = 0; i < treeLength; ++i)
     {
         chunk.tryToPlaceBlock(BlockId::Log, {block.x, block.y + i, block.z}, {BlockId::AllBlocks},
-                              RebuildOperation::None);
+                              RebuildOperation::None, PlacementOrigin::Generation);
     }
 }
 BiomeId ForestBiome::biomeId()
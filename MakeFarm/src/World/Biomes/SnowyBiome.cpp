@@ -4,10 +4,10 @@
 
 SnowyBiome::SnowyBiome(int seed)
     : Biome(seed)
-    , rd()
-    , gen(rd())
-    , mTreeDecider(0.01)
+    , mTreePlacementRandom(seed, TREE_PLACEMENT_SALT)
+    , mTreeLengthRandom(seed, TREE_LENGTH_SALT)
     , mTreeLengthGenerator(5, 9)
+    , mTreeDecider(0.01)
 {
     mBasicTerrain.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
     mBasicTerrain.SetFrequency(0.04);
@@ -40,10 +40,14 @@ int SnowyBiome::surfaceLevelAtGivenPosition(int blockCoordinateX, int blockCoord
 }
 
 void SnowyBiome::generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chunkBlocks, int surfaceLevel,
-                                        int blockCoordinateX, int blockCoordinateZ)
+                                        int blockCoordinateX, int blockCoordinateZ,
+                                        const Block::Coordinate& globalColumnCoordinate,
+                                        Decorations& decorations) const
 {
     auto& x = blockCoordinateX;
     auto& z = blockCoordinateZ;
+    const auto& globalX = globalColumnCoordinate.x;
+    const auto& globalZ = globalColumnCoordinate.z;
 
     for (auto y = 0; y < ChunkInterface::BLOCKS_PER_Y_DIMENSION; ++y)
     {
@@ -72,10 +76,11 @@ void SnowyBiome::generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chunkBlocks
                 chunkBlocks[x][y - 1][z]->setBlockType(BlockId::Sand);
             }
         }
-        else if (y == surfaceLevel + 1 && mTreeDecider(gen))
+        else if (y == surfaceLevel + 1 && mTreeDecider(mTreePlacementRandom, globalX, globalZ))
         {
             chunkBlocks[x][y][z] = std::make_unique<Block>(BlockId::SpruceLog);
-            mTreesToPlace.emplace_back(x, y, z);
+            auto treeLength = mTreeLengthGenerator(mTreeLengthRandom, globalX, globalZ);
+            decorations.push_back({Block::Coordinate(x, y, z), treeLength});
         }
         else
         {
@@ -84,26 +89,25 @@ void SnowyBiome::generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chunkBlocks
     }
 }
 
-void SnowyBiome::postGenerationPlacements(ChunkInterface& chunk)
+void SnowyBiome::postGenerationPlacements(ChunkInterface& chunk,
+                                          const Decorations& decorations) const
 {
-    placeTrees(chunk);
-    mTreesToPlace.clear();
+    placeTrees(chunk, decorations);
 }
 
-void SnowyBiome::placeTrees(ChunkInterface& chunk)
+void SnowyBiome::placeTrees(ChunkInterface& chunk, const Decorations& trees) const
 {
-    for (auto& coordinateToPlaceTree: mTreesToPlace)
+    for (auto& coordinateToPlaceTree: trees)
     {
         placeTree(chunk, coordinateToPlaceTree);
     }
 }
 
-void SnowyBiome::placeTree(ChunkInterface& chunk, const Block::Coordinate& block)
+void SnowyBiome::placeTree(ChunkInterface& chunk, const Decoration& tree) const
 {
-    auto treeLength = mTreeLengthGenerator(gen);
-    placeLogOfTheTree(chunk, block, treeLength);
-    placeTopPartOfTreeTopMadeOfLeaves(chunk, block, treeLength);
-    placeBottomPartOfTreeTopMadeOfLeaves(chunk, block, treeLength);
+    placeLogOfTheTree(chunk, tree.position, tree.length);
+    placeTopPartOfTreeTopMadeOfLeaves(chunk, tree.position, tree.length);
+    placeBottomPartOfTreeTopMadeOfLeaves(chunk, tree.position, tree.length);
 }
 
 void SnowyBiome::placeBottomPartOfTreeTopMadeOfLeaves(ChunkInterface& chunk,
@@ -138,7 +142,8 @@ void SnowyBiome::placeBottomPartOfTreeTopMadeOfLeaves(ChunkInterface& chunk,
         for (int i = 0; i < leavesInThisLevel; ++i)
         {
             chunk.tryToPlaceBlock(BlockId::SnowyLeaves, coordinatesAround.nextValue(),
-                                  {BlockId::Air}, RebuildOperation::None);
+                                  {BlockId::Air}, RebuildOperation::None,
+                                  PlacementOrigin::Generation);
         }
     }
 }
@@ -148,15 +153,16 @@ void SnowyBiome::placeTopPartOfTreeTopMadeOfLeaves(ChunkInterface& chunk,
                                                    int treeLength) const
 {
     auto treeTop = sf::Vector3i(block.x, block.y + treeLength, block.z);
-    chunk.tryToPlaceBlock(BlockId::SnowyLeaves, {treeTop.x, treeTop.y, treeTop.z});
+    chunk.tryToPlaceBlock(BlockId::SnowyLeaves, {treeTop.x, treeTop.y, treeTop.z}, {BlockId::Air},
+                          RebuildOperation::None, PlacementOrigin::Generation);
     chunk.tryToPlaceBlock(BlockId::SnowyLeaves, {treeTop.x + 1, treeTop.y - 1, treeTop.z},
-                          {BlockId::Air}, RebuildOperation::None);
+                          {BlockId::Air}, RebuildOperation::None, PlacementOrigin::Generation);
     chunk.tryToPlaceBlock(BlockId::SnowyLeaves, {treeTop.x - 1, treeTop.y - 1, treeTop.z},
-                          {BlockId::Air}, RebuildOperation::None);
+                          {BlockId::Air}, RebuildOperation::None, PlacementOrigin::Generation);
     chunk.tryToPlaceBlock(BlockId::SnowyLeaves, {treeTop.x, treeTop.y - 1, treeTop.z + 1},
-                          {BlockId::Air}, RebuildOperation::None);
+                          {BlockId::Air}, RebuildOperation::None, PlacementOrigin::Generation);
     chunk.tryToPlaceBlock(BlockId::SnowyLeaves, {treeTop.x, treeTop.y - 1, treeTop.z - 1},
-                          {BlockId::Air}, RebuildOperation::None);
+                          {BlockId::Air}, RebuildOperation::None, PlacementOrigin::Generation);
 }
 
 void SnowyBiome::placeLogOfTheTree(ChunkInterface& chunk, const Block::Coordinate& block,
@@ -165,7 +171,8 @@ void SnowyBiome::placeLogOfTheTree(ChunkInterface& chunk, const Block::Coordinat
     for (int i = 0; i < treeLength; ++i)
     {
         chunk.tryToPlaceBlock(BlockId::SpruceLog, {block.x, block.y + i, block.z},
-                              {BlockId::AllBlocks}, RebuildOperation::None);
+                              {BlockId::AllBlocks}, RebuildOperation::None,
+                              PlacementOrigin::Generation);
     }
 }
 
@@ -28,16 +28,23 @@ public:
      * @param blockCoordinateX The x position on which the column of blocks should appear.
      * @param blockCoordinateZ The z position on which the column of blocks should appear.
      * @param surfaceLevel Ground/Terrain level.
+     * @param globalColumnCoordinate Position of the column in the world.
+     * @param decorations Decorations of the chunk to which the decorations decided for this column
+     * are appended.
      */
     void generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chunkBlocks, int surfaceLevel,
-                                int blockCoordinateX, int blockCoordinateZ) override;
+                                int blockCoordinateX, int blockCoordinateZ,
+                                const Block::Coordinate& globalColumnCoordinate,
+                                Decorations& decorations) const override;
 
     /**
      * @brief It contains the steps that need to be done after generating the terrain. These include
      * such things as putting up vegetation and general beautification of the world.
      * @param chunk Chunk to be beautified
+     * @param decorations Decorations decided by this biome while generating the chunk
      */
-    void postGenerationPlacements(ChunkInterface& chunk) override;
+    void postGenerationPlacements(ChunkInterface& chunk,
+                                  const Decorations& decorations) const override;
 
     /**
      * @brief Returns a biome identifier that specifies what biome it is.
@@ -49,15 +56,16 @@ private:
     /**
      * @brief Places trees on the indicated chunk
      * @param chunk Chunk on which trees should be placed
+     * @param trees Trees decided while generating the chunk
      */
-    void placeTrees(ChunkInterface& chunk);
+    void placeTrees(ChunkInterface& chunk, const Decorations& trees) const;
 
     /**
      * @brief Places tree on the indicated chunk in indicated position
      * @param chunk Chunk on which tree should be placed
-     * @param block Block on which a new tree should be built
+     * @param tree Position on which a new tree should be built along with its length
      */
-    void placeTree(ChunkInterface& chunk, const Block::Coordinate& block);
+    void placeTree(ChunkInterface& chunk, const Decoration& tree) const;
 
     /**
      * @brief Places the main root of the tree, i.e. the column of logs.
@@ -97,11 +105,13 @@ private:
     FastNoiseLite mBasicTerrain;
     FastNoiseLite mHillsAndValleys;
 
-    std::random_device rd;
-    std::mt19937 gen;
-    std::uniform_int_distribution<int> mTreeLengthGenerator;
-    std::vector<Block::Coordinate> mTreesToPlace;
+    static constexpr std::uint32_t TREE_PLACEMENT_SALT = 1;
+    static constexpr std::uint32_t TREE_LENGTH_SALT = 2;
+
+    PositionalRandom mTreePlacementRandom;
+    PositionalRandom mTreeLengthRandom;
+    PositionalUniformIntDistribution mTreeLengthGenerator;
 
 protected:// For ugly testing purposes :<
-    std::bernoulli_distribution mTreeDecider;
+    PositionalBernoulliDistribution mTreeDecider;
 };
\ No newline at end of file
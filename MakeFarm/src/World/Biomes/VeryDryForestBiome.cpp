@@ -3,10 +3,10 @@
 
 VeryDryForestBiome::VeryDryForestBiome(int seed)
     : Biome(seed)
-    , rd()
-    , gen(rd())
-    , mDryTreeDecider(0.003)
+    , mDryTreePlacementRandom(seed, DRY_TREE_PLACEMENT_SALT)
+    , mDryTreeLengthRandom(seed, DRY_TREE_LENGTH_SALT)
     , mDryTreeLengthGenerator(2, 5)
+    , mDryTreeDecider(0.003)
 {
     mBasicTerrain.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
     mBasicTerrain.SetFrequency(0.03);
@@ -32,10 +32,14 @@ int VeryDryForestBiome::surfaceLevelAtGivenPosition(int blockCoordinateX, int bl
 
 void VeryDryForestBiome::generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chunkBlocks,
                                                 int surfaceLevel, int blockCoordinateX,
-                                                int blockCoordinateZ)
+                                                int blockCoordinateZ,
+                                                const Block::Coordinate& globalColumnCoordinate,
+                                                Decorations& decorations) const
 {
     auto& x = blockCoordinateX;
     auto& z = blockCoordinateZ;
+    const auto& globalX = globalColumnCoordinate.x;
+    const auto& globalZ = globalColumnCoordinate.z;
 
     for (auto y = 0; y < ChunkInterface::BLOCKS_PER_Y_DIMENSION; ++y)
     {
@@ -65,10 +69,12 @@ void VeryDryForestBiome::generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chu
         {
             chunkBlocks[x][y][z] = std::make_unique<Block>(BlockId::Water);
         }
-        else if (y == surfaceLevel + 1 && mDryTreeDecider(gen))
+        else if (y == surfaceLevel + 1 &&
+                 mDryTreeDecider(mDryTreePlacementRandom, globalX, globalZ))
         {
             chunkBlocks[x][y][z] = std::make_unique<Block>(BlockId::Log);
-            mDryTreesToPlace.emplace_back(x, y, z);
+            auto treeLength = mDryTreeLengthGenerator(mDryTreeLengthRandom, globalX, globalZ);
+            decorations.push_back({Block::Coordinate(x, y, z), treeLength});
         }
         else
         {
@@ -77,10 +83,10 @@ void VeryDryForestBiome::generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chu
     }
 }
 
-void VeryDryForestBiome::postGenerationPlacements(ChunkInterface& chunk)
+void VeryDryForestBiome::postGenerationPlacements(ChunkInterface& chunk,
+                                                  const Decorations& decorations) const
 {
-    placeDryTrees(chunk);
-    mDryTreesToPlace.clear();
+    placeDryTrees(chunk, decorations);
 }
 
 BiomeId VeryDryForestBiome::biomeId()
@@ -88,16 +94,16 @@ BiomeId VeryDryForestBiome::biomeId()
     return BiomeId::VeryDryForest;
 }
 
-void VeryDryForestBiome::placeDryTrees(ChunkInterface& chunk)
+void VeryDryForestBiome::placeDryTrees(ChunkInterface& chunk, const Decorations& dryTrees) const
 {
-    for (auto& coordinateToPlaceTree: mDryTreesToPlace)
+    for (auto& treeToPlace: dryTrees)
     {
-        auto treeLength = mDryTreeLengthGenerator(gen);
-        auto& block = coordinateToPlaceTree;
-        for (int i = 0; i < treeLength; ++i)
+        auto& block = treeToPlace.position;
+        for (int i = 0; i < treeToPlace.length; ++i)
         {
             chunk.tryToPlaceBlock(BlockId::Log, {block.x, block.y + i, block.z},
-                                  {BlockId::AllBlocks}, RebuildOperation::None);
+                                  {BlockId::AllBlocks}, RebuildOperation::None,
+                                  PlacementOrigin::Generation);
         }
     }
 }
\ No newline at end of file
@@ -25,16 +25,23 @@ public:
      * @param blockCoordinateX The x position on which the column of blocks should appear.
      * @param blockCoordinateZ The z position on which the column of blocks should appear.
      * @param surfaceLevel Ground/Terrain level.
+     * @param globalColumnCoordinate Position of the column in the world.
+     * @param decorations Decorations of the chunk to which the decorations decided for this column
+     * are appended.
      */
     void generateColumnOfBlocks(ChunkInterface::ChunkBlocks& chunkBlocks, int surfaceLevel,
-                                int blockCoordinateX, int blockCoordinateZ) override;
+                                int blockCoordinateX, int blockCoordinateZ,
+                                const Block::Coordinate& globalColumnCoordinate,
+                                Decorations& decorations) const override;
 
     /**
      * @brief It contains the steps that need to be done after generating the terrain. These include
      * such things as putting up vegetation and general beautification of the world.
      * @param chunk Chunk to be beautified
+     * @param decorations Decorations decided by this biome while generating the chunk
      */
-    void postGenerationPlacements(ChunkInterface& chunk) override;
+    void postGenerationPlacements(ChunkInterface& chunk,
+                                  const Decorations& decorations) const override;
 
     /**
      * @brief Returns a biome identifier that specifies what biome it is.
@@ -46,8 +53,9 @@ private:
     /**
      * @brief He puts a dry tree on the map. That is, in fact, the trunk itself
      * @param chunk Chunk on which the tree is to be placed
+     * @param dryTrees Dry trees decided while generating the chunk
      */
-    void placeDryTrees(ChunkInterface& chunk);
+    void placeDryTrees(ChunkInterface& chunk, const Decorations& dryTrees) const;
 
 private:
     /**
@@ -58,11 +66,13 @@ private:
 
     FastNoiseLite mBasicTerrain;
 
-    std::random_device rd;
-    std::mt19937 gen;
-    std::uniform_int_distribution<int> mDryTreeLengthGenerator;
-    std::vector<Block::Coordinate> mDryTreesToPlace;
+    static constexpr std::uint32_t DRY_TREE_PLACEMENT_SALT = 1;
+    static constexpr std::uint32_t DRY_TREE_LENGTH_SALT = 2;
+
+    PositionalRandom mDryTreePlacementRandom;
+    PositionalRandom mDryTreeLengthRandom;
+    PositionalUniformIntDistribution mDryTreeLengthGenerator;
 
 protected:
-    std::bernoulli_distribution mDryTreeDecider;
+    PositionalBernoulliDistribution mDryTreeDecider;
 };
\ No newline at end of file
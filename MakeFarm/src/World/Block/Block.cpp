@@ -48,7 +48,7 @@ void Block::setBlockType(const BlockId& blockId)
 
 Block::TextureId Block::blockTextureId(const Block::Face& blockFace) const
 {
-    return mBlockType->textureId.at(blockFace);
+    return BlockMap::blockMap().textureId(mBlockType->id, blockFace);
 }
 
 BlockId Block::id() const
@@ -60,23 +60,24 @@ BlockId Block::id() const
     return mBlockType->id;
 }
 
+const BlockType& Block::type() const
+{
+    std::shared_lock guard(mBlockAccessMutex);
+    return *mBlockType;
+}
+
 bool Block::isTransparent() const
 {
-    return mBlockType->transparent;
+    return BlockMap::blockMap().isTransparent(mBlockType->id);
 }
 
 bool Block::isFloral() const
 {
-    switch (id())
-    {
-        case BlockId::Leaves:
-        case BlockId::SnowyLeaves: return true;
-        default: return false;
-    }
+    return BlockMap::blockMap().isFloral(id());
 }
 bool Block::isCollidable() const
 {
-    return mBlockType->collidable;
+    return BlockMap::blockMap().isCollidable(mBlockType->id);
 }
 
 Direction Block::directionOfFace(Block::Face face)
@@ -141,6 +141,12 @@ public:
      */
     [[nodiscard]] BlockId id() const;
 
+    /**
+     * Returns the type of the block describing its properties
+     * @return Type of the block
+     */
+    [[nodiscard]] const BlockType& type() const;
+
     /**
      * Returns information about whether the block is transparent. For example, it can be glass.
      * @return True if the block is transparent, false otherwise
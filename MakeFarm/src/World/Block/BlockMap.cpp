@@ -1,4 +1,5 @@
 #include "BlockMap.h"
+#include "Resources/ResourceBundle.h"
 #include "Utils/Settings.h"
 #include "pch.h"
 #include <filesystem>
@@ -13,12 +14,61 @@ const BlockMap& BlockMap::blockMap()
 
 const BlockType& BlockMap::blockType(const BlockId& blockId) const
 {
-    return mBlockMap.at(blockId);
+    return mBlockTypes[static_cast<int>(blockId)];
+}
+
+bool BlockMap::isTransparent(const BlockId& blockId) const
+{
+    return mTransparentBlocks[static_cast<int>(blockId)];
+}
+
+bool BlockMap::isCollidable(const BlockId& blockId) const
+{
+    return mCollidableBlocks[static_cast<int>(blockId)];
+}
+
+bool BlockMap::isFloral(const BlockId& blockId) const
+{
+    return mFloralBlocks[static_cast<int>(blockId)];
+}
+
+Block::TextureId BlockMap::textureId(const BlockId& blockId, const Block::Face& blockFace) const
+{
+    return mTextureIds[static_cast<int>(blockId)][static_cast<int>(blockFace)];
 }
 
 BlockMap::BlockMap()
 {
-    parseDirectory("resources/blocks");
+    if (const auto& bundle = ResourceBundle::bundle())
+    {
+        for (const auto& blockType: bundle->blockTypes)
+        {
+            addBlockType(blockType);
+        }
+    }
+    else
+    {
+        parseDirectory("resources/blocks");
+    }
+    finalize();
+}
+
+void BlockMap::finalize()
+{
+    for (auto i = 0; i < NUMBER_OF_BLOCKS; ++i)
+    {
+        if (!mReadBlocks[i])
+        {
+            throw std::runtime_error("Block with id " + std::to_string(i) +
+                                     " does not have a settings file");
+        }
+
+        const auto& blockType = mBlockTypes[i];
+        mTransparentBlocks[i] = blockType.transparent;
+        mCollidableBlocks[i] = blockType.collidable;
+        mFloralBlocks[i] = blockType.floral;
+        mTextureIds[i] = blockType.textureId;
+    }
 }
 
 void BlockMap::parseDirectory(const std::string& directoryName)
@@ -51,9 +101,21 @@ void BlockMap::readBlockValues(const Settings& settingsFile, const std::string&
     readBlockTextures(settingsFile, blockType);
     blockType.transparent = readBlockTransparency(settingsFile);
     blockType.collidable = readBlockCollidability(settingsFile);
+    blockType.floral = readBlockFloral(settingsFile);
     blockType.dropItemId = readBlockDropItemId(settingsFile);
 
-    mBlockMap[blockType.id] = blockType;
+    addBlockType(blockType);
+}
+
+void BlockMap::addBlockType(const BlockType& blockType)
+{
+    const auto index = static_cast<int>(blockType.id);
+    if (index < 0 || index >= NUMBER_OF_BLOCKS || mReadBlocks[index])
+    {
+        throw std::runtime_error("Block " + blockType.fileName + " has an unknown or repeated id");
+    }
+    mBlockTypes[index] = blockType;
+    mReadBlocks[index] = true;
 }
 
 std::optional<ItemId> BlockMap::readBlockDropItemId(const Settings& settingsFile) const
@@ -84,6 +146,16 @@ bool BlockMap::readBlockCollidability(const Settings& settingsFile) const
     return isBlockCollidable;
 }
 
+bool BlockMap::readBlockFloral(const Settings& settingsFile) const
+{
+    bool isBlockFloral = false;
+    if (settingsFile.isPresent("Floral"))
+    {
+        isBlockFloral = settingsFile.get<bool>("Floral");
+    }
+    return isBlockFloral;
+}
+
 bool BlockMap::readBlockTransparency(const Settings& settingsFile) const
 {
     bool isBlockTransparent = false;
@@ -109,7 +181,8 @@ void BlockMap::readCustomBlockFacesTextures(const Settings& settingsFile,
     {
         if (settingsFile.isPresent(setting))
         {
-            blockType.textureId[blockFace] = settingsFile.get<Block::TextureId>(setting);
+            blockType.textureId[static_cast<int>(blockFace)] =
+                settingsFile.get<Block::TextureId>(setting);
         }
     };
 
@@ -127,10 +200,10 @@ void BlockMap::readBlockSideTexture(const Settings& settingsFile, BlockType& blo
     if (settingsFile.isPresent("TextureSide"))
     {
         auto sideTexture = settingsFile.get<Block::TextureId>("TextureSide");
-        blockType.textureId[Block::Face::Left] = sideTexture;
-        blockType.textureId[Block::Face::Right] = sideTexture;
-        blockType.textureId[Block::Face::Front] = sideTexture;
-        blockType.textureId[Block::Face::Back] = sideTexture;
+        blockType.textureId[static_cast<int>(Block::Face::Left)] = sideTexture;
+        blockType.textureId[static_cast<int>(Block::Face::Right)] = sideTexture;
+        blockType.textureId[static_cast<int>(Block::Face::Front)] = sideTexture;
+        blockType.textureId[static_cast<int>(Block::Face::Back)] = sideTexture;
     }
 }
 
@@ -139,10 +212,7 @@ void BlockMap::readBlockTexture(const Settings& settingsFile, BlockType& blockTy
     if (settingsFile.isPresent("Texture"))
     {
         auto generalTexture = settingsFile.get<Block::TextureId>("Texture");
-        for (auto i = 0; i < static_cast<int>(Block::Face::Counter); ++i)
-        {
-            blockType.textureId[static_cast<Block::Face>(i)] = generalTexture;
-        }
+        blockType.textureId.fill(generalTexture);
     }
 }
 
@@ -1,9 +1,15 @@
 #pragma once
 #include "BlockType.h"
 #include "Utils/Settings.h"
+#include <array>
+#include <bitset>
 
 /**
  * A map containing access to information about the blocks in the game.
+ *
+ * All block types are read once and kept in arrays indexed by the block id, so that looking them
+ * up during meshing and collision checks does not hash anything. The properties read most often
+ * are additionally packed into bitsets and a texture table next to each other.
  */
 class BlockMap
 {
@@ -21,9 +27,48 @@ public:
      */
     [[nodiscard]] const BlockType& blockType(const BlockId& blockId) const;
 
+    /**
+     * @brief Checks if the block of the given type is transparent
+     * @param blockId The id of the block
+     * @return True if transparent, false otherwise
+     */
+    [[nodiscard]] bool isTransparent(const BlockId& blockId) const;
+
+    /**
+     * @brief Checks if the block of the given type is collidable
+     * @param blockId The id of the block
+     * @return True if collidable, false otherwise
+     */
+    [[nodiscard]] bool isCollidable(const BlockId& blockId) const;
+
+    /**
+     * @brief Checks if the block of the given type is floral, like leaves
+     * @param blockId The id of the block
+     * @return True if floral, false otherwise
+     */
+    [[nodiscard]] bool isFloral(const BlockId& blockId) const;
+
+    /**
+     * @brief Retrieves the ID of the texture that is on the given face of the block type
+     * @param blockId The id of the block
+     * @param blockFace Selected block face from which texture will be read
+     * @return ID of the corresponding texture face
+     */
+    [[nodiscard]] Block::TextureId textureId(const BlockId& blockId,
+                                             const Block::Face& blockFace) const;
+
 private:
+    static constexpr auto NUMBER_OF_BLOCKS = static_cast<int>(BlockId::Counter);
+    static constexpr auto NUMBER_OF_FACES = static_cast<int>(Block::Face::Counter);
+
     BlockMap();
 
+    /**
+     * @brief Makes sure that every block has been read and fills the tables of properties.
+     * @warning If any block does not have its settings file it throws a runtime_error.
+     */
+    void finalize();
+
     /**
      * It searches the folder for block settings.
      * @param directoryName Path to folder in search of blocks
@@ -92,6 +137,13 @@ private:
      */
     [[nodiscard]] bool readBlockCollidability(const Settings& settingsFile) const;
 
+    /**
+     * @brief Reads if the block is floral
+     * @param settingsFile File containing block settings
+     * @return True if floral, false otherwise
+     */
+    [[nodiscard]] bool readBlockFloral(const Settings& settingsFile) const;
+
     /**
      * @brief Reads block identifier
      * @param settingsFile File containing block settings
@@ -106,6 +158,13 @@ private:
      */
     void readBlockValues(const Settings& settingsFile, const std::string& fileName);
 
+    /**
+     * @brief Stores the block type under its id
+     * @param blockType Information about the block
+     * @warning If the id is unknown or already taken it throws a runtime_error.
+     */
+    void addBlockType(const BlockType& blockType);
+
     /**
      * @brief Reads the ID of the item that the block is dropping when destroyed
      * @param settingsFile File containing block settings
@@ -115,7 +174,17 @@ private:
     [[nodiscard]] std::optional<ItemId> readBlockDropItemId(const Settings& settingsFile) const;
 
     /**
-     * Maps filename to specific BlockType
+     * Block types indexed by the block id
      */
-    std::unordered_map<BlockId, BlockType> mBlockMap;
+    std::array<BlockType, NUMBER_OF_BLOCKS> mBlockTypes;
+
+    /**
+     * Marks the block types which have already been read
+     */
+    std::bitset<NUMBER_OF_BLOCKS> mReadBlocks;
+
+    std::bitset<NUMBER_OF_BLOCKS> mTransparentBlocks;
+    std::bitset<NUMBER_OF_BLOCKS> mCollidableBlocks;
+    std::bitset<NUMBER_OF_BLOCKS> mFloralBlocks;
+    std::array<std::array<Block::TextureId, NUMBER_OF_FACES>, NUMBER_OF_BLOCKS> mTextureIds{};
 };
@@ -0,0 +1,17 @@
+#pragma once
+
+/**
+ * Properties of the block which the physics and the building of the meshes ask about most often.
+ * Chunks keep them packed into bitsets, so they can be checked without looking up the block type.
+ */
+// clang-format off
+enum class BlockProperty
+{
+    Collidable = 0,
+    Opaque     = 1,
+    Fluid      = 2,
+    NonAir     = 3,
+
+    Counter
+};
+// clang-format on
@@ -1,6 +1,7 @@
 #pragma once
 #include "Block.h"
 #include "World/Item/ItemId.h"
+#include <array>
 #include <optional>
 
 
@@ -14,6 +15,7 @@ struct BlockType
     std::string name;
     bool transparent = false;
     bool collidable = true;
+    bool floral = false;
     std::optional<ItemId> dropItemId;
-    std::unordered_map<Block::Face, Block::TextureId> textureId;
+    std::array<Block::TextureId, static_cast<int>(Block::Face::Counter)> textureId{};
 };
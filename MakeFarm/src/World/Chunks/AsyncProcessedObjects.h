@@ -115,6 +115,20 @@ struct AsyncProcessedObjects
         return processedObjectsThreads.empty();
     }
 
+    /**
+     * @brief Waits until every process finishes its work and removes them from the list. The
+     * objects they have processed are discarded.
+     */
+    void finishEveryProcess()
+    {
+        std::scoped_lock guard(processedObjectsThreadsMutex);
+        for (auto& processedObjectsThread: processedObjectsThreads)
+        {
+            processedObjectsThread.wait();
+        }
+        processedObjectsThreads.clear();
+    }
+
     /**
      * @brief This function expects a lambda that can execute something on each thread getting an
      * iterator.
@@ -0,0 +1,419 @@
+#include "BlockEditJournal.h"
+#include "pch.h"
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+
+#if defined(_WIN32)
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace
+{
+
+constexpr std::array<char, 4> MAGIC_NUMBER = {'M', 'F', 'J', 'L'};
+constexpr std::uint32_t FORMAT_VERSION = 2;
+constexpr std::size_t HEADER_SIZE = sizeof(MAGIC_NUMBER) + sizeof(FORMAT_VERSION);
+
+/**
+ * Three coordinates, two block ids, the tick and a CRC-32 of all of them, which tells apart an
+ * entry that was not written completely because the game crashed.
+ */
+constexpr std::size_t ENTRY_SIZE = 3 * sizeof(std::int32_t) + 2 + 2 * sizeof(std::uint32_t);
+constexpr std::size_t CHECKSUM_OFFSET = ENTRY_SIZE - sizeof(std::uint32_t);
+
+constexpr std::array<std::uint32_t, 256> CRC32_TABLE = []
+{
+    std::array<std::uint32_t, 256> table{};
+    for (auto i = 0u; i < table.size(); ++i)
+    {
+        auto value = i;
+        for (auto bit = 0; bit < 8; ++bit)
+        {
+            value = (value & 1) ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+        }
+        table[i] = value;
+    }
+    return table;
+}();
+
+void writeUint32(unsigned char* destination, std::uint32_t value)
+{
+    // Always little-endian, so the saved world can be moved between machines
+    for (auto byte = 0; byte < 4; ++byte)
+    {
+        destination[byte] = static_cast<unsigned char>(value >> (8 * byte));
+    }
+}
+
+std::uint32_t readUint32(const unsigned char* source)
+{
+    std::uint32_t value = 0;
+    for (auto byte = 0; byte < 4; ++byte)
+    {
+        value |= static_cast<std::uint32_t>(source[byte]) << (8 * byte);
+    }
+    return value;
+}
+
+std::uint32_t checksum(const unsigned char* entry)
+{
+    // The initial value makes sure that an entry made of zeros is never valid
+    std::uint32_t crc = 0xFFFFFFFF;
+    for (auto byte = entry; byte != entry + CHECKSUM_OFFSET; ++byte)
+    {
+        crc = CRC32_TABLE[(crc ^ *byte) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+void encodeEntry(unsigned char* destination, const BlockEditJournal::Entry& entry)
+{
+    writeUint32(destination, static_cast<std::uint32_t>(entry.worldCoordinate.x));
+    writeUint32(destination + 4, static_cast<std::uint32_t>(entry.worldCoordinate.y));
+    writeUint32(destination + 8, static_cast<std::uint32_t>(entry.worldCoordinate.z));
+    destination[12] = static_cast<unsigned char>(entry.oldBlockId);
+    destination[13] = static_cast<unsigned char>(entry.newBlockId);
+    writeUint32(destination + 14, entry.tick);
+    writeUint32(destination + CHECKSUM_OFFSET, checksum(destination));
+}
+
+/**
+ * @brief Reads the entry whose checksum has already been verified.
+ * @param source Encoded entry.
+ * @return The entry, or nothing if it changes a block unknown to this version of the game.
+ */
+std::optional<BlockEditJournal::Entry> decodeEntry(const unsigned char* source)
+{
+    const auto numberOfBlockIds = static_cast<unsigned char>(BlockId::Counter);
+    if (source[12] >= numberOfBlockIds || source[13] >= numberOfBlockIds)
+    {
+        return std::nullopt;
+    }
+    return BlockEditJournal::Entry{{static_cast<int>(readUint32(source)),
+                                    static_cast<int>(readUint32(source + 4)),
+                                    static_cast<int>(readUint32(source + 8))},
+                                   static_cast<BlockId>(source[12]),
+                                   static_cast<BlockId>(source[13]),
+                                   readUint32(source + 14)};
+}
+
+}// namespace
+
+BlockEditJournal::BlockEditJournal(std::string savedWorldPath)
+    : mJournalPath(savedWorldPath + "/journal.bin")
+    , mCompactedJournalPath(savedWorldPath + "/journal_compacted.bin")
+{
+    // A journal being compacted when the game crashed holds the older edits
+    auto entries = readJournalFile(mCompactedJournalPath);
+    const auto newerEntries = readJournalFile(mJournalPath);
+    entries.insert(entries.end(), newerEntries.begin(), newerEntries.end());
+
+    for (const auto& entry: entries)
+    {
+        const auto chunkCoordinate =
+            ChunkContainer::Coordinate::blockToChunkMetric(entry.worldCoordinate);
+        mRecoveredEdits[chunkCoordinate].push_back(entry);
+        mNextTick = std::max(mNextTick, entry.tick + 1);
+    }
+
+    {
+        std::scoped_lock guard(mFileMutex);
+        startJournalFile();
+    }
+    std::filesystem::remove(mCompactedJournalPath);
+    mFlushingThread = std::thread(&BlockEditJournal::processFlushes, this);
+}
+
+BlockEditJournal::~BlockEditJournal()
+{
+    {
+        std::scoped_lock guard(mPendingEntriesMutex);
+        mShouldStop = true;
+    }
+    mStopRequested.notify_one();
+    mFlushingThread.join();
+
+    try
+    {
+        flush();
+    }
+    catch (const std::exception&)
+    {
+        // Edits that could not be written are lost, but their chunks are still saved
+    }
+}
+
+void BlockEditJournal::append(const Block::Coordinate& worldCoordinate, BlockId oldBlockId,
+                              BlockId newBlockId)
+{
+    std::scoped_lock guard(mPendingEntriesMutex);
+    mPendingEntries.push_back({worldCoordinate, oldBlockId, newBlockId, mNextTick++});
+}
+
+std::vector<BlockEditJournal::Entry> BlockEditJournal::takeRecoveredEdits(
+    const ChunkContainer::Coordinate& chunkCoordinate)
+{
+    std::scoped_lock guard(mPendingEntriesMutex);
+    auto recoveredEdits = mRecoveredEdits.extract(chunkCoordinate);
+    if (recoveredEdits.empty())
+    {
+        return {};
+    }
+    return std::move(recoveredEdits.mapped());
+}
+
+void BlockEditJournal::flush()
+{
+    std::scoped_lock guard(mFileMutex);
+    writePendingEntries();
+}
+
+bool BlockEditJournal::shouldBeCompacted() const
+{
+    return mFileSize > mCompactionFileSize;
+}
+
+bool BlockEditJournal::beginCompaction()
+{
+    std::scoped_lock guard(mFileMutex);
+    writePendingEntries();
+    mFile.reset();
+
+    std::string compactionError;
+    std::error_code errorCode;
+    const auto isPreviousCompactionUnfinished =
+        std::filesystem::exists(mCompactedJournalPath, errorCode);
+    if (errorCode)
+    {
+        compactionError = errorCode.message();
+    }
+    else if (isPreviousCompactionUnfinished)
+    {
+        // The previous compaction did not finish, so its edits are still needed
+        try
+        {
+            auto entries = readJournalFile(mCompactedJournalPath);
+            const auto newerEntries = readJournalFile(mJournalPath);
+            entries.insert(entries.end(), newerEntries.begin(), newerEntries.end());
+            writeJournalFile(mCompactedJournalPath, entries);
+        }
+        catch (const std::exception& exception)
+        {
+            compactionError = exception.what();
+        }
+    }
+    else
+    {
+        std::filesystem::rename(mJournalPath, mCompactedJournalPath, errorCode);
+        if (errorCode)
+        {
+            compactionError = errorCode.message();
+        }
+    }
+
+    if (!compactionError.empty())
+    {
+        // The current journal still holds every edit, so it is simply continued
+        std::cout << "[BlockEditJournal] Unable to compact the journal: " << compactionError
+                  << std::endl;
+        mFile.reset(std::fopen(mJournalPath.c_str(), "ab"));
+        mCompactionFileSize = mFileSize + COMPACTION_THRESHOLD;
+        return false;
+    }
+    startJournalFile();
+    return true;
+}
+
+void BlockEditJournal::finishCompaction()
+{
+    std::scoped_lock guard(mFileMutex);
+    std::filesystem::remove(mCompactedJournalPath);
+}
+
+void BlockEditJournal::FileCloser::operator()(std::FILE* file) const
+{
+    std::fclose(file);
+}
+
+void BlockEditJournal::processFlushes()
+{
+    std::unique_lock lock(mPendingEntriesMutex);
+    while (!mShouldStop)
+    {
+        mStopRequested.wait_for(lock, FLUSH_INTERVAL, [this] { return mShouldStop; });
+        lock.unlock();
+        try
+        {
+            flush();
+        }
+        catch (const std::exception&)
+        {
+            // The edits stay waiting and are written with the next flush
+        }
+        lock.lock();
+    }
+}
+
+void BlockEditJournal::writePendingEntries()
+{
+    std::vector<Entry> entries;
+    {
+        std::scoped_lock guard(mPendingEntriesMutex);
+        entries.swap(mPendingEntries);
+    }
+    if (entries.empty())
+    {
+        return;
+    }
+
+    try
+    {
+        if (!mFile)
+        {
+            throw std::runtime_error("The block edit journal is not open: " + mJournalPath);
+        }
+        writeEntries(mFile.get(), entries);
+        synchronize(mFile.get());
+        mFileSize += entries.size() * ENTRY_SIZE;
+    }
+    catch (const std::exception&)
+    {
+        std::scoped_lock guard(mPendingEntriesMutex);
+        mPendingEntries.insert(mPendingEntries.begin(), entries.begin(), entries.end());
+        throw;
+    }
+}
+
+void BlockEditJournal::startJournalFile()
+{
+    std::vector<Entry> recoveredEdits;
+    {
+        std::scoped_lock guard(mPendingEntriesMutex);
+        for (const auto& [chunkCoordinate, entries]: mRecoveredEdits)
+        {
+            recoveredEdits.insert(recoveredEdits.end(), entries.begin(), entries.end());
+        }
+    }
+    std::stable_sort(recoveredEdits.begin(), recoveredEdits.end(),
+                     [](const Entry& lhs, const Entry& rhs) { return lhs.tick < rhs.tick; });
+
+    writeJournalFile(mJournalPath, recoveredEdits);
+    mFile.reset(std::fopen(mJournalPath.c_str(), "ab"));
+    if (!mFile)
+    {
+        throw std::runtime_error("Unable to open the block edit journal: " + mJournalPath);
+    }
+    mFileSize = HEADER_SIZE + recoveredEdits.size() * ENTRY_SIZE;
+    mCompactionFileSize = COMPACTION_THRESHOLD;
+}
+
+std::vector<BlockEditJournal::Entry> BlockEditJournal::readJournalFile(
+    const std::string& pathToFile)
+{
+    std::ifstream file(pathToFile, std::ios::binary);
+    if (!file.is_open())
+    {
+        return {};
+    }
+    const std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)),
+                                          std::istreambuf_iterator<char>());
+    if (data.size() < HEADER_SIZE)
+    {
+        return {};
+    }
+    if (!std::equal(MAGIC_NUMBER.begin(), MAGIC_NUMBER.end(), data.begin()) ||
+        readUint32(data.data() + sizeof(MAGIC_NUMBER)) != FORMAT_VERSION)
+    {
+        // The world is still opened, only without the edits of the journal, and the file is kept
+        // aside so that it is not overwritten
+        std::cout << "[BlockEditJournal] Moving aside journal of unsupported format: " << pathToFile
+                  << std::endl;
+        file.close();
+        std::error_code errorCode;
+        std::filesystem::rename(pathToFile, pathToFile + ".damaged", errorCode);
+        return {};
+    }
+
+    std::vector<Entry> entries;
+    for (auto offset = HEADER_SIZE; offset + ENTRY_SIZE <= data.size(); offset += ENTRY_SIZE)
+    {
+        const auto* entry = data.data() + offset;
+        if (checksum(entry) != readUint32(entry + CHECKSUM_OFFSET))
+        {
+            break;
+        }
+        if (const auto decodedEntry = decodeEntry(entry))
+        {
+            entries.push_back(*decodedEntry);
+        }
+    }
+    return entries;
+}
+
+void BlockEditJournal::writeJournalFile(const std::string& pathToFile,
+                                        const std::vector<Entry>& entries)
+{
+    const auto pathWithoutFile = std::filesystem::path(pathToFile).parent_path();
+    if (!pathWithoutFile.empty())
+    {
+        std::filesystem::create_directories(pathWithoutFile);
+    }
+
+    const auto temporaryPath = pathToFile + ".tmp";
+    {
+        const File file(std::fopen(temporaryPath.c_str(), "wb"));
+        if (!file)
+        {
+            throw std::runtime_error("Unable to create the block edit journal: " + temporaryPath);
+        }
+
+        std::array<unsigned char, HEADER_SIZE> header{};
+        std::copy(MAGIC_NUMBER.begin(), MAGIC_NUMBER.end(), header.begin());
+        writeUint32(header.data() + sizeof(MAGIC_NUMBER), FORMAT_VERSION);
+        if (std::fwrite(header.data(), 1, header.size(), file.get()) != header.size())
+        {
+            throw std::runtime_error("Unable to write the block edit journal: " + temporaryPath);
+        }
+        writeEntries(file.get(), entries);
+        synchronize(file.get());
+    }
+    std::filesystem::rename(temporaryPath, pathToFile);
+}
+
+void BlockEditJournal::writeEntries(std::FILE* file, const std::vector<Entry>& entries)
+{
+    std::vector<unsigned char> data(entries.size() * ENTRY_SIZE);
+    for (auto i = 0u; i < entries.size(); ++i)
+    {
+        encodeEntry(data.data() + i * ENTRY_SIZE, entries[i]);
+    }
+    if (std::fwrite(data.data(), 1, data.size(), file) != data.size())
+    {
+        throw std::runtime_error("Unable to write the block edit journal");
+    }
+}
+
+void BlockEditJournal::synchronize(std::FILE* file)
+{
+    if (std::fflush(file) != 0)
+    {
+        throw std::runtime_error("Unable to write the block edit journal");
+    }
+#if defined(_WIN32)
+    const auto result = _commit(_fileno(file));
+#else
+    const auto result = fsync(fileno(file));
+#endif
+    if (result != 0)
+    {
+        throw std::runtime_error("Unable to store the block edit journal on the disk");
+    }
+}
@@ -0,0 +1,203 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "World/Block/Block.h"
+#include "World/Chunks/ChunkContainer.h"
+
+/**
+ * @brief Append-only journal of the blocks changed in the world.
+ *
+ * Every change of a block costs only a few bytes in the journal, so it survives a crash of the game
+ * long before its chunk is saved. Appended edits are collected in memory and written together,
+ * followed by a single fsync, by the thread of the journal on a timer.
+ *
+ * Edits found in the journal when the world is opened are the ones whose chunks may not have been
+ * saved. They are handed over to the chunks when these are created. The journal is compacted by
+ * saving the chunks, after which the edits written so far are no longer needed:
+ * beginCompaction() starts a new journal, and finishCompaction() drops the previous one once the
+ * chunks have been written to the chunk storage.
+ */
+class BlockEditJournal
+{
+public:
+    /**
+     * @brief A single change of a block.
+     */
+    struct Entry
+    {
+        Block::Coordinate worldCoordinate;
+        BlockId oldBlockId;
+        BlockId newBlockId;
+
+        /**
+         * Order in which the blocks were changed. It grows with every change made in the world,
+         * also across the game sessions.
+         */
+        std::uint32_t tick;
+    };
+
+    /**
+     * @brief Time between consecutive writes of the appended edits to the disk.
+     */
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL{500};
+
+    /**
+     * @brief Size of the journal file in bytes, above which it should be compacted.
+     */
+    static constexpr std::uintmax_t COMPACTION_THRESHOLD = 1 << 20;
+
+    /**
+     * @brief Opens the journal of the world, remembers the edits found in it and starts the thread
+     * writing the appended edits.
+     * @param savedWorldPath Path to the directory of the saved world.
+     */
+    explicit BlockEditJournal(std::string savedWorldPath);
+    BlockEditJournal(const BlockEditJournal&) = delete;
+    BlockEditJournal& operator=(const BlockEditJournal&) = delete;
+
+    /**
+     * @brief Writes the edits which are still waiting and stops the writing thread.
+     */
+    ~BlockEditJournal();
+
+    /**
+     * @brief Appends the change of the block to the journal. Never waits for the disk.
+     * @param worldCoordinate World coordinates of the changed block.
+     * @param oldBlockId The id of the block before the change.
+     * @param newBlockId The id of the block after the change.
+     */
+    void append(const Block::Coordinate& worldCoordinate, BlockId oldBlockId, BlockId newBlockId);
+
+    /**
+     * @brief Takes the edits of the chunk found in the journal when the world was opened. They are
+     * returned only once, in the order in which they were made.
+     * @param chunkCoordinate Coordinates of the chunk.
+     * @return Edits of the blocks of the chunk that may not have been saved.
+     */
+    std::vector<Entry> takeRecoveredEdits(const ChunkContainer::Coordinate& chunkCoordinate);
+
+    /**
+     * @brief Writes the appended edits to the disk and waits until they are stored.
+     */
+    void flush();
+
+    /**
+     * @brief Checks whether the journal has grown so much that it should be compacted.
+     * @return True if the journal should be compacted, false otherwise.
+     */
+    [[nodiscard]] bool shouldBeCompacted() const;
+
+    /**
+     * @brief Writes the appended edits and starts a new journal. Edits appended from now on go to
+     * the new journal. The previous journal is kept until finishCompaction() is called.
+     * @warning Every chunk should be handed over to be saved after this call, as the edits of the
+     * previous journal are dropped afterwards.
+     * @return True if the compaction began. False if the journal could not be moved aside, in
+     * which case it is continued and finishCompaction() must not be called.
+     */
+    [[nodiscard]] bool beginCompaction();
+
+    /**
+     * @brief Drops the journal replaced by beginCompaction().
+     * @warning The chunks handed over to be saved after beginCompaction() must already be written.
+     */
+    void finishCompaction();
+
+private:
+    /**
+     * @brief Closes the file through std::fclose.
+     */
+    struct FileCloser
+    {
+        void operator()(std::FILE* file) const;
+    };
+
+    using File = std::unique_ptr<std::FILE, FileCloser>;
+
+    /**
+     * @brief Loop of the writing thread. Writes appended edits until the journal is destroyed.
+     */
+    void processFlushes();
+
+    /**
+     * @brief Writes the appended edits to the journal file and synchronizes it with the disk.
+     * @warning The file mutex must be locked.
+     */
+    void writePendingEntries();
+
+    /**
+     * @brief Creates the journal file holding the edits recovered so far, which have not been taken
+     * yet, and opens it for appending.
+     * @warning The file mutex must be locked.
+     */
+    void startJournalFile();
+
+    /**
+     * @brief Reads the edits stored in the journal file. The reading stops at the first entry
+     * which was not written completely, and edits of blocks unknown to this version of the game
+     * are skipped. A file of unsupported format is reported and moved aside.
+     * @param pathToFile Path to the journal file.
+     * @return Edits stored in the file.
+     */
+    static std::vector<Entry> readJournalFile(const std::string& pathToFile);
+
+    /**
+     * @brief Replaces the journal file with the one containing only the given edits. The file is
+     * first written aside and then renamed, so an interrupted write never damages it.
+     * @param pathToFile Path to the journal file.
+     * @param entries Edits to store.
+     */
+    static void writeJournalFile(const std::string& pathToFile, const std::vector<Entry>& entries);
+
+    /**
+     * @brief Writes the edits at the current end of the file.
+     * @param file The journal file.
+     * @param entries Edits to write.
+     */
+    static void writeEntries(std::FILE* file, const std::vector<Entry>& entries);
+
+    /**
+     * @brief Waits until everything written to the file is stored on the disk.
+     * @param file The journal file.
+     */
+    static void synchronize(std::FILE* file);
+
+private:
+    std::string mJournalPath;
+    std::string mCompactedJournalPath;
+
+    std::mutex mFileMutex;
+    File mFile;
+    std::atomic<std::uintmax_t> mFileSize = 0;
+
+    /**
+     * Size of the journal file above which it should be compacted. It grows after a failed
+     * compaction, so that it is not retried until the journal grows again.
+     */
+    std::atomic<std::uintmax_t> mCompactionFileSize = COMPACTION_THRESHOLD;
+
+    std::mutex mPendingEntriesMutex;
+    std::condition_variable mStopRequested;
+    std::vector<Entry> mPendingEntries;
+    std::uint32_t mNextTick = 0;
+    bool mShouldStop = false;
+
+    /**
+     * Edits found in the journal when the world was opened, which have not been taken by their
+     * chunks yet.
+     */
+    std::unordered_map<ChunkContainer::Coordinate, std::vector<Entry>, std::hash<CoordinateBase>>
+        mRecoveredEdits;
+
+    std::thread mFlushingThread;
+};
@@ -0,0 +1,76 @@
+#include "BlockRegion.h"
+#include "pch.h"
+
+BlockRegion::BlockRegion(const Block::Coordinate& min, const Block::Coordinate& max)
+    : mMin(min)
+    , mMax(max)
+{
+    const auto numberOfBlocks = static_cast<long long>(max.x - min.x + 1) *
+                                (max.y - min.y + 1) * (max.z - min.z + 1);
+    if (max.x < min.x || max.y < min.y || max.z < min.z || numberOfBlocks > MAX_NUMBER_OF_BLOCKS)
+    {
+        throw std::runtime_error("The region of blocks is empty or too large to be gathered");
+    }
+}
+
+const Block::Coordinate& BlockRegion::min() const
+{
+    return mMin;
+}
+
+const Block::Coordinate& BlockRegion::max() const
+{
+    return mMax;
+}
+
+bool BlockRegion::contains(const Block::Coordinate& blockCoordinate) const
+{
+    return blockCoordinate.x >= mMin.x && blockCoordinate.x <= mMax.x &&
+           blockCoordinate.y >= mMin.y && blockCoordinate.y <= mMax.y &&
+           blockCoordinate.z >= mMin.z && blockCoordinate.z <= mMax.z;
+}
+
+ChunkOccupancy::Properties BlockRegion::properties(const Block::Coordinate& blockCoordinate) const
+{
+    return contains(blockCoordinate) ? mProperties[index(blockCoordinate)] : 0;
+}
+
+void BlockRegion::setProperties(const Block::Coordinate& blockCoordinate,
+                                ChunkOccupancy::Properties properties)
+{
+    mProperties[index(blockCoordinate)] = properties;
+}
+
+bool BlockRegion::isCollidable(const Block::Coordinate& blockCoordinate) const
+{
+    return ChunkOccupancy::hasProperty(properties(blockCoordinate), BlockProperty::Collidable);
+}
+
+bool BlockRegion::isAnyBlockTouching(const sf::Vector3f& min, const sf::Vector3f& max,
+                                     BlockProperty property) const
+{
+    const auto minBlock = Block::Coordinate::nonBlockToBlockMetric(min);
+    const auto maxBlock = Block::Coordinate::nonBlockToBlockMetric(max);
+    for (auto x = minBlock.x; x <= maxBlock.x; ++x)
+    {
+        for (auto y = minBlock.y; y <= maxBlock.y; ++y)
+        {
+            for (auto z = minBlock.z; z <= maxBlock.z; ++z)
+            {
+                if (ChunkOccupancy::hasProperty(properties(Block::Coordinate(x, y, z)), property))
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+int BlockRegion::index(const Block::Coordinate& blockCoordinate) const
+{
+    const auto sizeY = mMax.y - mMin.y + 1;
+    const auto sizeZ = mMax.z - mMin.z + 1;
+    return ((blockCoordinate.x - mMin.x) * sizeY + (blockCoordinate.y - mMin.y)) * sizeZ +
+           (blockCoordinate.z - mMin.z);
+}
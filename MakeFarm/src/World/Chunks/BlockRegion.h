@@ -0,0 +1,98 @@
+#pragma once
+#include <SFML/System/Vector3.hpp>
+#include <array>
+
+#include "World/Block/Block.h"
+#include "World/Block/BlockProperty.h"
+#include "World/Chunks/ChunkOccupancy.h"
+
+/**
+ * @brief Copy of the block properties in a small box of the world, gathered at once so that the
+ * physics and gameplay probes can query them without locking the chunks for every block.
+ *
+ * The properties are stored inside the object itself, so it is meant to be created on the stack
+ * for a single tick. Blocks of chunks which are not loaded have no properties.
+ */
+class BlockRegion
+{
+public:
+    /**
+     * @brief Maximum number of blocks the region can hold.
+     */
+    static constexpr int MAX_NUMBER_OF_BLOCKS = 512;
+
+    /**
+     * @brief Creates a region in which no block has any properties.
+     * @param min Coordinates of the block of the region with the lowest coordinates.
+     * @param max Coordinates of the block of the region with the highest coordinates.
+     * @warning If the region holds more than MAX_NUMBER_OF_BLOCKS blocks it throws a runtime_error.
+     */
+    BlockRegion(const Block::Coordinate& min, const Block::Coordinate& max);
+
+    /**
+     * @brief Returns the coordinates of the block of the region with the lowest coordinates.
+     * @return Coordinates of the block with the lowest coordinates.
+     */
+    [[nodiscard]] const Block::Coordinate& min() const;
+
+    /**
+     * @brief Returns the coordinates of the block of the region with the highest coordinates.
+     * @return Coordinates of the block with the highest coordinates.
+     */
+    [[nodiscard]] const Block::Coordinate& max() const;
+
+    /**
+     * @brief Checks if the block with the given coordinates is inside the region.
+     * @param blockCoordinate World coordinates of the block.
+     * @return True if the block is inside the region, false otherwise.
+     */
+    [[nodiscard]] bool contains(const Block::Coordinate& blockCoordinate) const;
+
+    /**
+     * @brief Returns the properties of the block with the given coordinates.
+     * @param blockCoordinate World coordinates of the block.
+     * @return Properties of the block, none if the block is outside the region or its chunk is not
+     * loaded.
+     */
+    [[nodiscard]] ChunkOccupancy::Properties properties(
+        const Block::Coordinate& blockCoordinate) const;
+
+    /**
+     * @brief Sets the properties of the block with the given coordinates.
+     * @param blockCoordinate World coordinates of the block inside the region.
+     * @param properties Properties of the block.
+     */
+    void setProperties(const Block::Coordinate& blockCoordinate,
+                       ChunkOccupancy::Properties properties);
+
+    /**
+     * @brief Checks if the block with the given coordinates stops the movement.
+     * @param blockCoordinate World coordinates of the block.
+     * @return True if the block is collidable, false if it is not or it is not loaded.
+     */
+    [[nodiscard]] bool isCollidable(const Block::Coordinate& blockCoordinate) const;
+
+    /**
+     * @brief Checks if any block with the given property touches the box.
+     * @param min Non-metric position of the corner of the box with the lowest coordinates.
+     * @param max Non-metric position of the corner of the box with the highest coordinates.
+     * @param property Property of the sought block.
+     * @return True if such a block touches the box, false otherwise.
+     * @warning The box should lie inside the region.
+     */
+    [[nodiscard]] bool isAnyBlockTouching(const sf::Vector3f& min, const sf::Vector3f& max,
+                                          BlockProperty property) const;
+
+private:
+    /**
+     * @brief Returns the position of the block inside the stored properties.
+     * @param blockCoordinate World coordinates of the block inside the region.
+     * @return Index of the properties of the block.
+     */
+    [[nodiscard]] int index(const Block::Coordinate& blockCoordinate) const;
+
+private:
+    Block::Coordinate mMin;
+    Block::Coordinate mMax;
+    std::array<ChunkOccupancy::Properties, MAX_NUMBER_OF_BLOCKS> mProperties{};
+};
@@ -1,136 +1,102 @@
 #include "Chunk.h"
 #include "pch.h"
 
-#include <filesystem>
 #include <optional>
 
 #include "Resources/TexturePack.h"
+#include "World/Chunks/BlockRegion.h"
+#include "World/Chunks/BlockEditJournal.h"
 #include "World/Chunks/ChunkContainer.h"
 #include "World/Chunks/ChunkManager.h"
+#include "World/Chunks/ChunkPrefetcher.h"
+#include "World/Chunks/ChunkSaveQueue.h"
+#include "World/Chunks/ChunkStorage.h"
 #include "World/Chunks/TerrainGenerator.h"
 
+namespace
+{
+
+ChunkMeshBuilder::TextureCoordinatesProvider textureCoordinatesFrom(const TexturePack& texturePack)
+{
+    return [&texturePack](Block::TextureId textureId)
+    { return texturePack.normalizedCoordinates(textureId); };
+}
+
+}// namespace
+
 Chunk::Chunk(sf::Vector3i pixelPosition, const TexturePack& texturePack, ChunkContainer& parent,
-             ChunkManager& manager, const std::string& savedWorldPath, const int& worldSeed)
+             ChunkManager& manager, ChunkPrefetcher& chunkPrefetcher,
+             ChunkSaveQueue& chunkSaveQueue, BlockEditJournal& blockEditJournal,
+             const int& worldSeed)
     : Chunk(Block::Coordinate::nonBlockToBlockMetric(pixelPosition), texturePack, parent, manager,
-            savedWorldPath, worldSeed)
+            chunkPrefetcher, chunkSaveQueue, blockEditJournal, worldSeed)
 {
 }
 
 Chunk::Chunk(Block::Coordinate blockPosition, const TexturePack& texturePack,
-             ChunkContainer& parent, ChunkManager& manager, const std::string& savedWorldPath,
+             ChunkContainer& parent, ChunkManager& manager, ChunkPrefetcher& chunkPrefetcher,
+             ChunkSaveQueue& chunkSaveQueue, BlockEditJournal& blockEditJournal,
              const int& worldSeed)
     : mChunkPosition(std::move(blockPosition))
     , mTexturePack(texturePack)
     , mParentContainer(parent)
-    , mTerrainMeshBuilder(mChunkPosition)
-    , mFluidMeshBuilder(mChunkPosition)
-    , mFloralMeshBuilder(mChunkPosition)
+    , mMeshBuilder(mChunkPosition, textureCoordinatesFrom(texturePack))
     , mChunkOfBlocks(std::make_shared<ChunkBlocks>())
     , mChunkManager(manager)
     , mTerrainGenerator(std::make_unique<TerrainGenerator>(worldSeed))
-    , mSavedWorldPath(savedWorldPath)
+    , mChunkPrefetcher(&chunkPrefetcher)
+    , mChunkSaveQueue(&chunkSaveQueue)
+    , mBlockEditJournal(&blockEditJournal)
 {
-    auto chunkCoordinate = ChunkContainer::Coordinate::blockToChunkMetric(mChunkPosition);
-
-    if (doesChunkHaveSavedFile())
-    {
-        loadSavedChunkData();
-    }
-    else
-    {
-        generateChunkTerrain();
-    }
+    generateChunkTerrain();
+    loadSavedChunkData();
+    applyRecoveredBlockEdits();
+    mAreBlockEditsTracked = true;
 }
 
 Chunk::Chunk(Chunk&& rhs) noexcept
     : mChunkPosition(std::move(rhs.mChunkPosition))
     , mTexturePack(rhs.mTexturePack)
     , mParentContainer(rhs.mParentContainer)
-    , mTerrainMeshBuilder(mChunkPosition)
-    , mFluidMeshBuilder(mChunkPosition)
-    , mFloralMeshBuilder(mChunkPosition)
+    , mMeshBuilder(mChunkPosition, textureCoordinatesFrom(rhs.mTexturePack))
     , mTerrainModel(std::move(rhs.mTerrainModel))
     , mChunkOfBlocks(std::move(rhs.mChunkOfBlocks))
+    , mOccupancy(rhs.mOccupancy)
     , mChunkManager(rhs.mChunkManager)
     , mTerrainGenerator(std::move(rhs.mTerrainGenerator))
+    , mChunkPrefetcher(std::exchange(rhs.mChunkPrefetcher, nullptr))
+    , mChunkSaveQueue(std::exchange(rhs.mChunkSaveQueue, nullptr))
+    , mBlockEditJournal(std::exchange(rhs.mBlockEditJournal, nullptr))
+    , mBlockEdits(std::move(rhs.mBlockEdits))
+    , mAreBlockEditsTracked(rhs.mAreBlockEditsTracked)
+    , mIsSavedDataToBeRewritten(rhs.mIsSavedDataToBeRewritten)
+    , mModificationGeneration(rhs.mModificationGeneration)
+    , mSavedModificationGeneration(rhs.mSavedModificationGeneration)
 {
 }
 
-void Chunk::overwriteChunk(const Chunk::ChunkArray1D& chunk) const
-{
-    for (auto x = 0; x < BLOCKS_PER_X_DIMENSION; ++x)
-    {
-        for (auto y = 0; y < BLOCKS_PER_Y_DIMENSION; ++y)
-        {
-            for (auto z = 0; z < BLOCKS_PER_Z_DIMENSION; ++z)
-            {
-                (*mChunkOfBlocks)[x][y][z] = std::make_unique<Block>(
-                    chunk[x + BLOCKS_PER_X_DIMENSION * (y + BLOCKS_PER_Y_DIMENSION * z)]);
-            }
-        }
-    }
-}
-
 void Chunk::generateChunkTerrain()
 {
     mTerrainGenerator->generateTerrain(*this, *mChunkOfBlocks);
-}
-
-void Chunk::createBlockMesh(const Block::Coordinate& pos)
-{
-    const auto& block = localBlock(pos);
 
-    for (auto i = 0; i < static_cast<int>(Block::Face::Counter); ++i)
-    {
-        if (doesBlockFaceHasTransparentNeighbor(static_cast<Block::Face>(i), pos))
-        {
-            if (block.id() == BlockId::Water)
-            {
-                if (!doesBlockFaceHasGivenBlockNeighbour(static_cast<Block::Face>(i), pos,
-                                                         BlockId::Water))
-                {
-                    mFluidMeshBuilder.addQuad(
-                        static_cast<Block::Face>(i),
-                        mTexturePack.normalizedCoordinates(
-                            block.blockTextureId(static_cast<Block::Face>(i))),
-                        pos);
-                }
-            }
-            else if (block.isFloral())
-            {
-                mFloralMeshBuilder.addQuad(static_cast<Block::Face>(i),
-                                           mTexturePack.normalizedCoordinates(
-                                               block.blockTextureId(static_cast<Block::Face>(i))),
-                                           pos);
-            }
-            else
-            {
-                mTerrainMeshBuilder.addQuad(static_cast<Block::Face>(i),
-                                            mTexturePack.normalizedCoordinates(
-                                                block.blockTextureId(static_cast<Block::Face>(i))),
-                                            pos);
-            }
-        }
-    }
+    // Biomes fill the blocks directly, so the bitsets are built once the terrain is ready
+    std::scoped_lock guard(mChunkAccessMutex);
+    mOccupancy.rebuild(*mChunkOfBlocks);
 }
 
 void Chunk::prepareMesh()
 {
-    for (auto x = 0; x < BLOCKS_PER_X_DIMENSION; ++x)
+    // The chunk can not stay locked while its mesh is built, as the faces on its edges look into
+    // the neighbouring chunks. The bitsets are small, so a copy of them is taken instead
+    const auto occupancy = [this]()
     {
-        for (auto y = 0; y < BLOCKS_PER_Y_DIMENSION; ++y)
-        {
-            for (auto z = 0; z < BLOCKS_PER_Z_DIMENSION; ++z)
-            {
-                if (localBlock({x, y, z}).id() == BlockId::Air)
-                {
-                    continue;
-                }
-
-                createBlockMesh({x, y, z});
-            }
-        }
-    }
+        std::scoped_lock guard(mChunkAccessMutex);
+        return mOccupancy;
+    }();
+
+    mMeshBuilder.addBlocks(*this, occupancy,
+                           [this](const Block::Face& blockFace, const Block::Coordinate& blockPos)
+                           { return neighbourProperties(blockFace, blockPos); });
 }
 
 void Chunk::updateMesh()
@@ -140,19 +106,19 @@ void Chunk::updateMesh()
     {
         mTerrainModel = std::make_unique<Model3D>();
     }
-    mTerrainModel->setMesh(mTerrainMeshBuilder.mesh3D());
+    mTerrainModel->setMesh(mMeshBuilder.terrainMesh());
 
     if (!mFluidModel)
     {
         mFluidModel = std::make_unique<Model3D>();
     }
-    mFluidModel->setMesh(mFluidMeshBuilder.mesh3D());
+    mFluidModel->setMesh(mMeshBuilder.fluidMesh());
 
     if (!mFloralModel)
     {
         mFloralModel = std::make_unique<Model3D>();
     }
-    mFloralModel->setMesh(mFloralMeshBuilder.mesh3D());
+    mFloralModel->setMesh(mMeshBuilder.floralMesh());
 }
 
 void Chunk::fixedUpdate(const float& deltaTime)
@@ -198,17 +164,16 @@ void Chunk::rebuildFast()
 
 void Chunk::rebuildMesh()
 {
-    mTerrainMeshBuilder.resetMesh();
-    mFluidMeshBuilder.resetMesh();
-    mFloralMeshBuilder.resetMesh();
+    mMeshBuilder.resetMeshes();
     prepareMesh();
 }
 
 void Chunk::removeLocalBlock(const Block::Coordinate& localCoordinates)
 {
     std::unique_lock guard(mChunkAccessMutex);
-    (*mChunkOfBlocks)[localCoordinates.x][localCoordinates.y][localCoordinates.z]->setBlockType(
-        BlockId::Air);
+    const auto oldBlockId = localBlock(localCoordinates).id();
+    setLocalBlockType(localCoordinates, BlockId::Air);
+    recordBlockEdit(localCoordinates, oldBlockId, BlockId::Air);
     guard.unlock();
 
     rebuildFast();
@@ -262,12 +227,11 @@ Chunk::Chunk(std::shared_ptr<ChunkBlocks> chunkBlocks, Block::Coordinate blockPo
     : mChunkPosition(std::move(blockPosition))
     , mTexturePack(texturePack)
     , mParentContainer(parent)
-    , mTerrainMeshBuilder(mChunkPosition)
-    , mFluidMeshBuilder(mChunkPosition)
-    , mFloralMeshBuilder(mChunkPosition)
+    , mMeshBuilder(mChunkPosition, textureCoordinatesFrom(texturePack))
     , mChunkOfBlocks(std::move(chunkBlocks))
     , mChunkManager(manager)
 {
+    mOccupancy.rebuild(*mChunkOfBlocks);
     prepareMesh();
 }
 
@@ -309,47 +273,24 @@ std::vector<Direction> Chunk::directionOfBlockFacesInContactWithOtherChunk(
     return directions;
 }
 
-bool Chunk::doesBlockFaceHasTransparentNeighbor(const Block::Face& blockFace,
-                                                const Block::Coordinate& blockPos)
+std::optional<ChunkOccupancy::Properties> Chunk::neighbourProperties(
+    const Block::Face& blockFace, const Block::Coordinate& blockPos) const
 {
-    auto isBlockTransparent = [&blockPos, this](const Direction& face)
-    {
-        auto neighbour = neighbourBlockInGivenDirection(blockPos, face);
-        return (neighbour.has_value() && neighbour.value().isTransparent());
-    };
-
-    switch (blockFace)
+    const auto blockNeighborPosition =
+        localNearbyBlockPosition(blockPos, Block::directionOfFace(blockFace));
+    if (areLocalCoordinatesInsideChunk(blockNeighborPosition))
     {
-        case Block::Face::Top: return (isBlockTransparent(Direction::Above));
-        case Block::Face::Left: return (isBlockTransparent(Direction::ToTheLeft));
-        case Block::Face::Right: return (isBlockTransparent(Direction::ToTheRight));
-        case Block::Face::Bottom: return (isBlockTransparent(Direction::Below));
-        case Block::Face::Front: return (isBlockTransparent(Direction::InFront));
-        case Block::Face::Back: return (isBlockTransparent(Direction::Behind));
-        default: throw std::runtime_error("Unsupported Block::Face value was provided");
+        std::scoped_lock guard(mChunkAccessMutex);
+        return mOccupancy.properties(blockNeighborPosition);
     }
-}
 
-bool Chunk::doesBlockFaceHasGivenBlockNeighbour(const Block::Face& blockFace,
-                                                const Block::Coordinate& blockPos,
-                                                const BlockId& blockId)
-{
-    auto isBlockOfGivenId = [&blockPos, &blockId, this](const Direction& face)
-    {
-        auto neighbour = neighbourBlockInGivenDirection(blockPos, face);
-        return (neighbour.has_value() && neighbour.value().id() == blockId);
-    };
-
-    switch (blockFace)
+    if (const auto& neighborBlock =
+            mParentContainer.worldBlock(localToGlobalCoordinates(blockNeighborPosition)))
     {
-        case Block::Face::Top: return (isBlockOfGivenId(Direction::Above));
-        case Block::Face::Left: return (isBlockOfGivenId(Direction::ToTheLeft));
-        case Block::Face::Right: return (isBlockOfGivenId(Direction::ToTheRight));
-        case Block::Face::Bottom: return (isBlockOfGivenId(Direction::Below));
-        case Block::Face::Front: return (isBlockOfGivenId(Direction::InFront));
-        case Block::Face::Back: return (isBlockOfGivenId(Direction::Behind));
-        default: throw std::runtime_error("Unsupported Block::Face value was provided");
+        return ChunkOccupancy::properties(neighborBlock->type());
     }
+
+    return std::nullopt;
 }
 
 std::optional<Block> Chunk::neighbourBlockInGivenDirection(const Block::Coordinate& blockPos,
@@ -402,35 +343,78 @@ const Block::Coordinate& Chunk::positionInBlocks() const
     return mChunkPosition;
 }
 
+void Chunk::copyBlocksTo(BlockRegion& region) const
+{
+    // The whole part of the region is copied under a single lock of the chunk
+    std::scoped_lock guard(mChunkAccessMutex);
+    mOccupancy.copyTo(region, mChunkPosition);
+}
+
+bool Chunk::isAnyBlockWithProperty(const Block::Coordinate& min, const Block::Coordinate& max,
+                                   BlockProperty property) const
+{
+    const auto [localMin, localMax] = ChunkOccupancy::localPartOfBox(min, max, mChunkPosition);
+    if (localMin.x > localMax.x || localMin.y > localMax.y || localMin.z > localMax.z)
+    {
+        return false;
+    }
+
+    std::scoped_lock guard(mChunkAccessMutex);
+    return mOccupancy.isAnyBlockWithProperty(localMin, localMax, property);
+}
+
 void Chunk::tryToPlaceBlock(const BlockId& blockId, const Block::Coordinate& localCoordinates,
                             std::vector<BlockId> blocksThatMightBeOverplaced,
-                            const RebuildOperation& rebuildOperation)
+                            const RebuildOperation& rebuildOperation,
+                            const PlacementOrigin& placementOrigin)
 {
     if (areLocalCoordinatesInsideChunk(localCoordinates))
     {
         tryToPlaceBlockInsideThisChunk(blockId, localCoordinates, blocksThatMightBeOverplaced,
-                                       rebuildOperation);
+                                       rebuildOperation, placementOrigin);
     }
     else
     {
+        // The neighbour is not generated again together with this chunk, so it has to keep the
+        // blocks of this chunk which reach into it
+        const auto neighbourPlacementOrigin = placementOrigin == PlacementOrigin::Generation
+                                                  ? PlacementOrigin::NeighbourGeneration
+                                                  : placementOrigin;
         auto globalCoordinates = localToGlobalCoordinates(localCoordinates);
         mParentContainer.tryToPlaceBlock(blockId, globalCoordinates, blocksThatMightBeOverplaced,
-                                         rebuildOperation);
+                                         rebuildOperation, neighbourPlacementOrigin);
     }
 }
 
 void Chunk::tryToPlaceBlockInsideThisChunk(const BlockId& blockId,
                                            const Block::Coordinate& localCoordinates,
                                            std::vector<BlockId>& blocksThatMightBeOverplaced,
-                                           const RebuildOperation& rebuildOperation)
+                                           const RebuildOperation& rebuildOperation,
+                                           const PlacementOrigin& placementOrigin)
 {
     std::unique_lock guard(mChunkAccessMutex);
-    auto& block = (*mChunkOfBlocks)[localCoordinates.x][localCoordinates.y][localCoordinates.z];
-    auto idOfTheBlockToOverplace = block->id();
+    auto idOfTheBlockToOverplace = localBlock(localCoordinates).id();
+
+    // Generated blocks must not undo changes already made here. A block generated by a neighbour
+    // is kept as a change of this chunk, so it is not placed again over itself either.
+    auto isPlacedByGeneration = placementOrigin != PlacementOrigin::Edit;
+    auto isEditOverwrittenByGeneration =
+        isPlacedByGeneration && mBlockEdits.contains(localCoordinatesToIndex(localCoordinates));
 
-    if (canGivenBlockBeOverplaced(blocksThatMightBeOverplaced, idOfTheBlockToOverplace))
+    if (!isEditOverwrittenByGeneration &&
+        canGivenBlockBeOverplaced(blocksThatMightBeOverplaced, idOfTheBlockToOverplace))
     {
-        block->setBlockType(blockId);
+        setLocalBlockType(localCoordinates, blockId);
+        switch (placementOrigin)
+        {
+            case PlacementOrigin::Edit:
+                recordBlockEdit(localCoordinates, idOfTheBlockToOverplace, blockId);
+                break;
+            case PlacementOrigin::NeighbourGeneration:
+                rememberBlockEdit(localCoordinates, blockId);
+                break;
+            case PlacementOrigin::Generation: break;
+        }
         switch (rebuildOperation)
         {
             case RebuildOperation::Fast: rebuildFast(); break;
@@ -451,52 +435,188 @@ bool Chunk::canGivenBlockBeOverplaced(std::vector<BlockId>& blocksThatMightBeOve
                        });
 }
 
-std::string Chunk::chunkSaveFilePath() const
+int Chunk::localCoordinatesToIndex(const Block::Coordinate& localCoordinates)
+{
+    return localCoordinates.x +
+           BLOCKS_PER_X_DIMENSION *
+               (localCoordinates.y + BLOCKS_PER_Y_DIMENSION * localCoordinates.z);
+}
+
+Block::Coordinate Chunk::indexToLocalCoordinates(int index)
+{
+    auto x = index % BLOCKS_PER_X_DIMENSION;
+    auto y = (index / BLOCKS_PER_X_DIMENSION) % BLOCKS_PER_Y_DIMENSION;
+    auto z = index / (BLOCKS_PER_X_DIMENSION * BLOCKS_PER_Y_DIMENSION);
+    return {x, y, z};
+}
+
+void Chunk::setLocalBlockType(const Block::Coordinate& localCoordinates, const BlockId& blockId)
 {
-    auto chunkCoordinate = ChunkContainer::Coordinate::blockToChunkMetric(mChunkPosition);
-    return mSavedWorldPath + "/chunk_" + std::to_string(chunkCoordinate.x) + "_" +
-           std::to_string(chunkCoordinate.y) + "_" + std::to_string(chunkCoordinate.z) + ".bin";
+    std::scoped_lock guard(mChunkAccessMutex);
+    auto& block = localBlock(localCoordinates);
+    block.setBlockType(blockId);
+    mOccupancy.update(localCoordinates, block.type());
 }
 
-Chunk::ChunkArray1D Chunk::oneDimensionalChunkRepresentation()
+void Chunk::recordBlockEdit(const Block::Coordinate& localCoordinates, const BlockId& oldBlockId,
+                            const BlockId& newBlockId)
 {
-    auto chunkCoordinate = ChunkContainer::Coordinate::blockToChunkMetric(mChunkPosition);
-    ChunkArray1D chunk;
-    for (auto x = 0; x < BLOCKS_PER_X_DIMENSION; ++x)
+    std::scoped_lock guard(mChunkAccessMutex);
+    if (mAreBlockEditsTracked)
     {
-        for (auto y = 0; y < BLOCKS_PER_Y_DIMENSION; ++y)
+        rememberBlockEdit(localCoordinates, newBlockId);
+        if (mBlockEditJournal && oldBlockId != newBlockId)
         {
-            for (auto z = 0; z < BLOCKS_PER_Z_DIMENSION; ++z)
-            {
-                chunk[x + BLOCKS_PER_X_DIMENSION * (y + BLOCKS_PER_Y_DIMENSION * z)] =
-                    localBlock({x, y, z}).id();
-            }
+            mBlockEditJournal->append(localToGlobalCoordinates(localCoordinates), oldBlockId,
+                                      newBlockId);
         }
     }
-    return chunk;
 }
 
-void Chunk::saveChunkDataToFile()
+void Chunk::rememberBlockEdit(const Block::Coordinate& localCoordinates, const BlockId& newBlockId)
 {
-    auto chunk = oneDimensionalChunkRepresentation();
-    mSerializer.serialize(chunk);
-    mSerializer.saveToFile(chunkSaveFilePath());
+    std::scoped_lock guard(mChunkAccessMutex);
+    if (mAreBlockEditsTracked)
+    {
+        mBlockEdits.set(localCoordinatesToIndex(localCoordinates), newBlockId);
+        ++mModificationGeneration;
+    }
+}
+
+void Chunk::saveChunkData(SaveBatch batch)
+{
+    std::scoped_lock guard(mChunkAccessMutex);
+    handOverToSaveQueue(batch);
+}
+
+void Chunk::handOverToSaveQueue(SaveBatch batch)
+{
+    if (!mChunkSaveQueue)
+    {
+        return;
+    }
+
+    // Outdated or damaged saved data is rewritten even if nothing changed. When the chunk does not
+    // differ from the generated terrain, the empty snapshot removes it.
+    if (mModificationGeneration == mSavedModificationGeneration && !mIsSavedDataToBeRewritten)
+    {
+        mChunkSaveQueue->countSkippedSave();
+        return;
+    }
+
+    // Only pointers to the sections are copied, the blocks are copied when they are changed. The
+    // snapshot owns no section, so the threads reading it never write to it.
+    const auto chunkCoordinate = ChunkContainer::Coordinate::blockToChunkMetric(mChunkPosition);
+    mChunkSaveQueue->push(chunkCoordinate,
+                          std::make_shared<const ChunkBlockEdits>(mBlockEdits.snapshot()), batch);
+    mSavedModificationGeneration = mModificationGeneration;
+    mIsSavedDataToBeRewritten = false;
 }
 
 void Chunk::loadSavedChunkData()
 {
-    std::ifstream file(chunkSaveFilePath(), std::ios::binary);
-    if (file.is_open())
+    const auto chunkCoordinate = ChunkContainer::Coordinate::blockToChunkMetric(mChunkPosition);
+    if (const auto pendingSnapshot = mChunkSaveQueue->pendingSnapshot(chunkCoordinate))
+    {
+        applyBlockEdits(*pendingSnapshot);
+        return;
+    }
+
+    // Chunks are loaded one after another by the same threads, so the buffer is allocated only once
+    // per thread and the saved data is decoded straight from it
+    thread_local std::vector<unsigned char> savedData;
+    if (!mChunkPrefetcher->readChunk(chunkCoordinate, savedData) || savedData.empty())
+    {
+        return;
+    }
+
+    const auto* data = savedData.data() + 1;
+    const auto size = savedData.size() - 1;
+    try
+    {
+        switch (static_cast<SavedChunkFormat>(savedData.front()))
+        {
+            case SavedChunkFormat::EncodedBlockEdits:
+                applyBlockEdits(ChunkBlockEdits(ChunkCodec::decode(data, size)));
+                break;
+            case SavedChunkFormat::BlockEdits:
+                loadSerializedBlockEdits(data, size);
+                mIsSavedDataToBeRewritten = true;
+                break;
+            case SavedChunkFormat::AllBlocks:
+                loadAllBlocks(data, size);
+                mIsSavedDataToBeRewritten = true;
+                break;
+            default: throw std::runtime_error("Unsupported format of the saved chunk");
+        }
+    }
+    catch (const std::exception& exception)
+    {
+        // Saved data is decoded completely before anything is applied, so the chunk is left exactly
+        // as it was generated. The damaged data is replaced by it on the next save.
+        std::cout << "[Chunk] Dropping damaged saved data of the chunk (" << chunkCoordinate.x
+                  << ", " << chunkCoordinate.y << ", " << chunkCoordinate.z
+                  << "): " << exception.what() << std::endl;
+        mIsSavedDataToBeRewritten = true;
+    }
+}
+
+void Chunk::applyRecoveredBlockEdits()
+{
+    const auto chunkCoordinate = ChunkContainer::Coordinate::blockToChunkMetric(mChunkPosition);
+    const auto recoveredEdits = mBlockEditJournal->takeRecoveredEdits(chunkCoordinate);
+
+    std::scoped_lock guard(mChunkAccessMutex);
+    for (const auto& recoveredEdit: recoveredEdits)
     {
-        ChunkArray1D chunkToRead;
-        mSerializer.readSerialized(file, chunkToRead);
-        overwriteChunk(chunkToRead);
+        const auto localCoordinates = globalToLocalCoordinates(recoveredEdit.worldCoordinate);
+        if (localBlock(localCoordinates).id() == recoveredEdit.oldBlockId)
+        {
+            setLocalBlockType(localCoordinates, recoveredEdit.newBlockId);
+            mBlockEdits.set(localCoordinatesToIndex(localCoordinates), recoveredEdit.newBlockId);
+            ++mModificationGeneration;
+        }
     }
 }
 
-bool Chunk::doesChunkHaveSavedFile() const
+void Chunk::applyBlockEdits(ChunkBlockEdits blockEdits)
 {
-    return std::filesystem::exists(chunkSaveFilePath());
+    std::scoped_lock guard(mChunkAccessMutex);
+    blockEdits.forEach([this](int index, BlockId blockId)
+                       { setLocalBlockType(indexToLocalCoordinates(index), blockId); });
+
+    // Nothing is recorded before the saved data is loaded, so the edits are taken over as they are
+    mBlockEdits = std::move(blockEdits);
+}
+
+void Chunk::loadSerializedBlockEdits(const unsigned char* data, std::size_t size)
+{
+    SerializableBlockEdits serializedBlockEdits;
+    mSerializer.readSerialized(data, size, serializedBlockEdits);
+
+    ChunkBlockEdits blockEdits;
+    for (const auto& blockEdit: serializedBlockEdits)
+    {
+        blockEdits.set(blockEdit.index, blockEdit.blockId);
+    }
+    applyBlockEdits(std::move(blockEdits));
+}
+
+void Chunk::loadAllBlocks(const unsigned char* data, std::size_t size)
+{
+    auto chunkToRead = std::make_unique<ChunkArray1D>();
+    mSerializer.readSerialized(data, size, *chunkToRead);
+
+    std::scoped_lock guard(mChunkAccessMutex);
+    for (auto index = 0; index < BLOCKS_IN_CHUNK; ++index)
+    {
+        const auto localCoordinates = indexToLocalCoordinates(index);
+        if (localBlock(localCoordinates).id() != (*chunkToRead)[index])
+        {
+            setLocalBlockType(localCoordinates, (*chunkToRead)[index]);
+            mBlockEdits.set(index, (*chunkToRead)[index]);
+        }
+    }
 }
 
 Block::Coordinate Chunk::highestSetBlock(const Block::Coordinate& blockPos)
@@ -514,5 +634,5 @@ Block::Coordinate Chunk::highestSetBlock(const Block::Coordinate& blockPos)
 
 Chunk::~Chunk()
 {
-    saveChunkDataToFile();
+    handOverToSaveQueue(NO_SAVE_BATCH);
 }
\ No newline at end of file
@@ -1,12 +1,17 @@
 #pragma once
 
-#include "Renderer3D/Meshes/Builders/BlockMeshBuilder.h"
+#include "Renderer3D/Meshes/Builders/ChunkMeshBuilder.h"
 #include "Renderer3D/Model3D.h"
 #include "Utils/Serializer.h"
+#include "World/Chunks/ChunkBlockEdits.h"
 #include "World/Chunks/ChunkInterface.h"
+#include "World/Chunks/ChunkOccupancy.h"
 
+class BlockEditJournal;
 class ChunkContainer;
 class ChunkManager;
+class ChunkPrefetcher;
+class ChunkSaveQueue;
 class TerrainGenerator;
 class AABB;
 
@@ -18,10 +23,12 @@ class Chunk : public ChunkInterface
 {
 public:
     Chunk(sf::Vector3i pixelPosition, const TexturePack& texturePack, ChunkContainer& parent,
-          ChunkManager& manager, const std::string& savedWorldPath, const int& worldSeed);
+          ChunkManager& manager, ChunkPrefetcher& chunkPrefetcher, ChunkSaveQueue& chunkSaveQueue,
+          BlockEditJournal& blockEditJournal, const int& worldSeed);
 
     Chunk(Block::Coordinate blockPosition, const TexturePack& texturePack, ChunkContainer& parent,
-          ChunkManager& manager, const std::string& savedWorldPath, const int& worldSeed);
+          ChunkManager& manager, ChunkPrefetcher& chunkPrefetcher, ChunkSaveQueue& chunkSaveQueue,
+          BlockEditJournal& blockEditJournal, const int& worldSeed);
 
     Chunk(Chunk&& rhs) noexcept;
     ~Chunk() override;
@@ -84,10 +91,13 @@ public:
      * cannot be overwritten.
      * \param rebuildOperation An operation that determines whether and how quickly a chunk should
      * be rebuilt after a block is placed.
+     * \param placementOrigin What places the block. Blocks generated by this chunk which land in a
+     * neighbouring chunk are placed there as generated by a neighbour.
      */
     void tryToPlaceBlock(const BlockId& blockId, const Block::Coordinate& localCoordinates,
                          std::vector<BlockId> blocksThatMightBeOverplaced,
-                         const RebuildOperation& rebuildOperation) final;
+                         const RebuildOperation& rebuildOperation,
+                         const PlacementOrigin& placementOrigin) final;
 
     /**
      * \brief Returns the block according to the coordinates given relative to the chunk position.
@@ -189,6 +199,23 @@ public:
      */
     const Block::Coordinate& positionInBlocks() const final;
 
+    /**
+     * @brief Copies the properties of the blocks of this chunk that lie inside the region to it.
+     * @param region Region to which the properties of the blocks are copied.
+     */
+    void copyBlocksTo(BlockRegion& region) const final;
+
+    /**
+     * @brief Checks whether any block of this chunk that lies inside the box has the property.
+     * @param min World coordinates of the block of the box with the lowest coordinates.
+     * @param max World coordinates of the block of the box with the highest coordinates.
+     * @param property Sought property.
+     * @return True if any such block has the property, false otherwise.
+     */
+    [[nodiscard]] bool isAnyBlockWithProperty(const Block::Coordinate& min,
+                                              const Block::Coordinate& max,
+                                              BlockProperty property) const final;
+
     /**
      * @brief Finds a neighboring block located in the indicated direction
      * @param blockPos Position of the block for which the neighbor is sought
@@ -205,6 +232,13 @@ public:
      */
     Block::Coordinate highestSetBlock(const Block::Coordinate& blockPos) final;
 
+    /**
+     * @brief Hands over a snapshot of the blocks that differ from the generated terrain to be saved
+     * in the background.
+     * @param batch Batch of saves to which the save of the chunk belongs.
+     */
+    void saveChunkData(SaveBatch batch) final;
+
 private:
     using ChunkArray1D = std::array<BlockId, ChunkInterface::BLOCKS_IN_CHUNK>;
 
@@ -218,34 +252,21 @@ private:
 
 
     /**
-     * It checks whether a given block face has an "air" or other transparent face next to it
-     * through which it can be seen at all.
-     *
-     * @param blockFace The face of the block to check
-     * @param blockPos Local position of the block to be checked
-     * @return Yes if the face next to the face of the indicated block is transparent by which it is
-     * visible, false in the real case
-     */
-    [[nodiscard]] bool doesBlockFaceHasTransparentNeighbor(const Block::Face& blockFace,
-                                                           const Block::Coordinate& blockPos);
-
-
-    /**
-     * @brief Checks whether a given block face is in contact with a block of the specified type
-     * @param blockFace Face of the block to be checked
-     * @param blockPos Block position to be checked
-     * @param blockId Block id
-     * @return
+     * @brief Reads the properties of the block next to the face of the given block. Inside this
+     * chunk they are read from its occupancy bitsets.
+     * @param blockFace Face of the block next to which the neighbour is located
+     * @param blockPos Local position of the block
+     * @return Properties of the neighbouring block, or nullopt if its chunk is not loaded.
      */
-    [[nodiscard]] bool doesBlockFaceHasGivenBlockNeighbour(const Block::Face& blockFace,
-                                                           const Block::Coordinate& blockPos,
-                                                           const BlockId& blockId);
+    [[nodiscard]] std::optional<ChunkOccupancy::Properties> neighbourProperties(
+        const Block::Face& blockFace, const Block::Coordinate& blockPos) const;
 
     /**
-     * Creates a block mesh on the indicated local coordinates
-     * @param pos The indicated position of the block on which the mesh should be created
+     * @brief Changes the type of the block and the occupancy bitsets with it.
+     * @param localCoordinates Coordinates relative to the position of the chunk
+     * @param blockId The id of the new type of the block.
      */
-    void createBlockMesh(const Block::Coordinate& pos);
+    void setLocalBlockType(const Block::Coordinate& localCoordinates, const BlockId& blockId);
 
     /**
      * @brief Checks whether a block can be overwritten depending on the list of blocks that can be
@@ -266,47 +287,111 @@ private:
      * @param blocksThatMightBeOverplaced List of blocks that can be overwritten.
      * @param rebuildOperation Optional rebuilding operation that should happen after inserting the
      * block.
+     * @param placementOrigin What places the block, which decides whether it is saved.
      */
     void tryToPlaceBlockInsideThisChunk(const BlockId& blockId,
                                         const Block::Coordinate& localCoordinates,
                                         std::vector<BlockId>& blocksThatMightBeOverplaced,
-                                        const RebuildOperation& rebuildOperation);
+                                        const RebuildOperation& rebuildOperation,
+                                        const PlacementOrigin& placementOrigin);
+
+    /**
+     * @brief Converts local coordinates of the block to its index in the one-dimensional
+     * representation of the chunk.
+     * @param localCoordinates Coordinates relative to the position of the chunk
+     * @return Index of the block in the one-dimensional representation of the chunk.
+     */
+    static int localCoordinatesToIndex(const Block::Coordinate& localCoordinates);
 
     /**
-     * @brief Creates a chunk representation in the form of a one-dimensional array
-     * @return 1D array representation of the chunk.
+     * @brief Converts the index of the block in the one-dimensional representation of the chunk to
+     * its local coordinates.
+     * @param index Index of the block in the one-dimensional representation of the chunk.
+     * @return Coordinates relative to the position of the chunk
      */
-    ChunkArray1D oneDimensionalChunkRepresentation();
+    static Block::Coordinate indexToLocalCoordinates(int index);
 
     /**
-     * @brief Path to the file where the chunk status is saved
-     * @return Character string representing the chunk's path to the file
+     * @brief Remembers that the block differs from the generated terrain and appends the change to
+     * the block edit journal. Changes made while the terrain of this chunk is being generated are
+     * not recorded.
+     * @param localCoordinates Coordinates relative to the position of the chunk
+     * @param oldBlockId The id of the block that was at the given place before.
+     * @param newBlockId The id of the block that is now at the given place.
      */
-    std::string chunkSaveFilePath() const;
+    void recordBlockEdit(const Block::Coordinate& localCoordinates, const BlockId& oldBlockId,
+                         const BlockId& newBlockId);
 
     /**
-     * @brief Overwrites the actual chunk with data from a one-dimensional array representing the
-     * chunk
-     * @param chunk One-dimensional array that is a representation of a chunk
+     * @brief Remembers that the block differs from the generated terrain so that it is saved, and
+     * marks the chunk as modified. Changes made while the terrain of this chunk is being generated
+     * are not remembered.
+     * @param localCoordinates Coordinates relative to the position of the chunk
+     * @param newBlockId The id of the block that is now at the given place.
      */
-    void overwriteChunk(const ChunkArray1D& chunk) const;
+    void rememberBlockEdit(const Block::Coordinate& localCoordinates, const BlockId& newBlockId);
 
     /**
-     * @brief Saves the state of the chunk data to a file
+     * @brief Hands over the blocks that differ from the generated terrain to the chunk save queue.
+     * Nothing is handed over if the chunk has not changed since it was last loaded or saved.
+     * @param batch Batch of saves to which the save of the chunk belongs.
      */
-    void saveChunkDataToFile();
+    void handOverToSaveQueue(SaveBatch batch);
 
     /**
-     * @brief Reads chunk data from a file
-     * @warning Nothing happens when the save file is not there
+     * @brief Reads the saved state of the chunk and places it on the already generated chunk. The
+     * state still waiting in the chunk save queue is newer than the saved one. Saved data that
+     * cannot be decoded is reported and dropped, leaving the chunk as it was generated.
+     * @warning Nothing happens when the chunk has not been saved
      */
     void loadSavedChunkData();
 
     /**
-     * @brief Checks if the chunk has a save file from which its state can be read
-     * @return True if the chunk has a save file, false otherwise
+     * @brief Places the edits of this chunk, found in the block edit journal when the world was
+     * opened, on the already loaded chunk. An edit is skipped if the block is no longer the one it
+     * changed, as the saved chunk already contains this or a newer edit.
      */
-    bool doesChunkHaveSavedFile() const;
+    void applyRecoveredBlockEdits();
+
+    /**
+     * @brief Places blocks that differ from the generated terrain on the already generated chunk.
+     * @param blockEdits Blocks that differ from the generated terrain.
+     */
+    void applyBlockEdits(ChunkBlockEdits blockEdits);
+
+    /**
+     * @brief Reads the list of blocks that differ from the generated terrain, as saved before the
+     * chunk codec was introduced, and places them on the already generated chunk.
+     * @param data Pointer to the serialized list of blocks that differ from the generated terrain.
+     * @param size Size of the serialized data in bytes.
+     */
+    void loadSerializedBlockEdits(const unsigned char* data, std::size_t size);
+
+    /**
+     * @brief Reads every block of the chunk, as saved by older versions of the game, and remembers
+     * these that differ from the already generated terrain.
+     * @param data Pointer to the serialized blocks of the chunk.
+     * @param size Size of the serialized data in bytes.
+     */
+    void loadAllBlocks(const unsigned char* data, std::size_t size);
+
+    /**
+     * @brief A single block of the chunk which differs from the generated terrain, in the form
+     * saved before the chunk codec was introduced.
+     */
+    struct SerializableBlockEdit
+    {
+        template<typename Archive, typename Self>
+        static void serialize(Archive& archive, Self& self)
+        {
+            archive(self.index, self.blockId);
+        }
+
+        int index = 0;
+        BlockId blockId;
+    };
+
+    using SerializableBlockEdits = std::vector<SerializableBlockEdit>;
 
 
 private:
@@ -323,14 +408,37 @@ private:
 
 
     // TODO: This system should be changed to a better one. Consider distance.
-    BlockMeshBuilder mTerrainMeshBuilder;
-    BlockMeshBuilder mFluidMeshBuilder;
-    BlockMeshBuilder mFloralMeshBuilder;
+    ChunkMeshBuilder mMeshBuilder;
 
     std::unique_ptr<Model3D> mTerrainModel;
     std::unique_ptr<Model3D> mFluidModel;
     std::unique_ptr<Model3D> mFloralModel;
 
     std::shared_ptr<ChunkBlocks> mChunkOfBlocks;
-    std::string mSavedWorldPath;
+
+    /**
+     * Properties of the blocks packed into bitsets, changed together with the blocks. The physics
+     * and the building of the mesh read them instead of the types of the blocks.
+     */
+    ChunkOccupancy mOccupancy;
+    ChunkPrefetcher* mChunkPrefetcher = nullptr;
+    ChunkSaveQueue* mChunkSaveQueue = nullptr;
+    BlockEditJournal* mBlockEditJournal = nullptr;
+
+    /**
+     * Blocks that differ from the generated terrain, indexed the same as ChunkArray1D. Only they
+     * are saved, the rest of the chunk is generated again from the world seed. It is changed and
+     * copied only under the chunk access mutex. Snapshots handed over to be saved share its
+     * sections and are read without the mutex, as shared sections are never changed.
+     */
+    ChunkBlockEdits mBlockEdits;
+    bool mAreBlockEditsTracked = false;
+    bool mIsSavedDataToBeRewritten = false;
+
+    /**
+     * Increased with every change of the blocks. The chunk has to be saved only if it differs from
+     * the generation of the last load or save.
+     */
+    std::uint64_t mModificationGeneration = 0;
+    std::uint64_t mSavedModificationGeneration = 0;
 };
@@ -0,0 +1,106 @@
+#include "ChunkBlockEdits.h"
+#include "pch.h"
+
+ChunkBlockEdits::ChunkBlockEdits(const ChunkCodec::BlockEdits& blockEdits)
+{
+    for (const auto& [index, blockId]: blockEdits)
+    {
+        set(index, blockId);
+    }
+}
+
+ChunkBlockEdits::ChunkBlockEdits(const ChunkBlockEdits& rhs)
+    : mSections(rhs.mSections)
+    , mSize(rhs.mSize)
+    , mOwnedSections(rhs.mOwnedSections)
+{
+    // Sections owned by rhs may still be changed by it, so they cannot be shared
+    for (auto sectionIndex = 0; sectionIndex < NUMBER_OF_SECTIONS; ++sectionIndex)
+    {
+        if (mOwnedSections.test(sectionIndex))
+        {
+            mSections[sectionIndex] = std::make_shared<Section>(*mSections[sectionIndex]);
+        }
+    }
+}
+
+ChunkBlockEdits::ChunkBlockEdits(ChunkBlockEdits&& rhs) noexcept
+    : mSections(std::move(rhs.mSections))
+    , mSize(std::exchange(rhs.mSize, 0))
+    , mOwnedSections(std::exchange(rhs.mOwnedSections, {}))
+{
+}
+
+ChunkBlockEdits& ChunkBlockEdits::operator=(const ChunkBlockEdits& rhs)
+{
+    if (this != &rhs)
+    {
+        *this = ChunkBlockEdits(rhs);
+    }
+    return *this;
+}
+
+ChunkBlockEdits& ChunkBlockEdits::operator=(ChunkBlockEdits&& rhs) noexcept
+{
+    mSections = std::move(rhs.mSections);
+    mSize = std::exchange(rhs.mSize, 0);
+    mOwnedSections = std::exchange(rhs.mOwnedSections, {});
+    return *this;
+}
+
+void ChunkBlockEdits::set(int index, BlockId blockId)
+{
+    const auto sectionIndex = sectionOf(index);
+    auto& section = mSections[sectionIndex];
+    if (!section)
+    {
+        section = std::make_shared<Section>();
+        mOwnedSections.set(sectionIndex);
+    }
+    else if (!mOwnedSections.test(sectionIndex))
+    {
+        section = std::make_shared<Section>(*section);
+        mOwnedSections.set(sectionIndex);
+    }
+
+    const auto sizeBefore = section->size();
+    (*section)[index] = blockId;
+    mSize += section->size() - sizeBefore;
+}
+
+ChunkBlockEdits ChunkBlockEdits::snapshot()
+{
+    mOwnedSections.reset();
+    return *this;
+}
+
+bool ChunkBlockEdits::contains(int index) const
+{
+    const auto& section = mSections[sectionOf(index)];
+    return section && section->contains(index);
+}
+
+std::size_t ChunkBlockEdits::size() const
+{
+    return mSize;
+}
+
+bool ChunkBlockEdits::empty() const
+{
+    return mSize == 0;
+}
+
+ChunkCodec::BlockEdits ChunkBlockEdits::merged() const
+{
+    ChunkCodec::BlockEdits blockEdits;
+    blockEdits.reserve(mSize);
+    forEach([&blockEdits](int index, BlockId blockId) { blockEdits.emplace(index, blockId); });
+    return blockEdits;
+}
+
+int ChunkBlockEdits::sectionOf(int index)
+{
+    const auto y = (index / ChunkInterface::BLOCKS_PER_X_DIMENSION) %
+                   ChunkInterface::BLOCKS_PER_Y_DIMENSION;
+    return y / BLOCKS_PER_SECTION_Y_DIMENSION;
+}
@@ -0,0 +1,135 @@
+#pragma once
+#include <array>
+#include <bitset>
+#include <memory>
+
+#include "World/Chunks/ChunkCodec.h"
+#include "World/Chunks/ChunkInterface.h"
+
+/**
+ * @brief Blocks of the chunk which differ from the generated terrain, divided into horizontal
+ * sections that are shared between copies.
+ *
+ * Taking a snapshot only copies the pointers to the sections, so it is cheap regardless of how
+ * many blocks were changed. A section is changed in place only by the object which owns it, that
+ * is the one which created it and has not taken a snapshot since. Taking a snapshot gives up the
+ * ownership of every section, so the first change of a section afterwards copies that section
+ * alone. Snapshots own nothing, so sections are never changed once they are shared, and a snapshot
+ * can be read and copied from any thread without holding the lock of the chunk.
+ *
+ * Blocks of the chunk themselves are not covered. The mesh builders still read them under the lock
+ * of the chunk.
+ *
+ * @warning A single object is not thread-safe. Copying never changes the copied object, so the
+ * sections it owns are copied along with it; only snapshot() shares them.
+ */
+class ChunkBlockEdits
+{
+public:
+    /**
+     * @brief Number of block layers along the Y axis in a single section.
+     */
+    static constexpr int BLOCKS_PER_SECTION_Y_DIMENSION = 16;
+    static constexpr int NUMBER_OF_SECTIONS =
+        (ChunkInterface::BLOCKS_PER_Y_DIMENSION + BLOCKS_PER_SECTION_Y_DIMENSION - 1) /
+        BLOCKS_PER_SECTION_Y_DIMENSION;
+
+    ChunkBlockEdits() = default;
+
+    /**
+     * @brief Shares the sections which the given edits do not own and copies the ones they own.
+     * @param rhs Edits to copy.
+     */
+    ChunkBlockEdits(const ChunkBlockEdits& rhs);
+    ChunkBlockEdits(ChunkBlockEdits&& rhs) noexcept;
+    ChunkBlockEdits& operator=(const ChunkBlockEdits& rhs);
+    ChunkBlockEdits& operator=(ChunkBlockEdits&& rhs) noexcept;
+    ~ChunkBlockEdits() = default;
+
+    /**
+     * @brief Divides the blocks which differ from the generated terrain into sections.
+     * @param blockEdits Blocks indexed by their index in the one-dimensional representation of
+     * the chunk.
+     */
+    explicit ChunkBlockEdits(const ChunkCodec::BlockEdits& blockEdits);
+
+    /**
+     * @brief Remembers the block which differs from the generated terrain. The section of the
+     * block is copied first if this object does not own it.
+     * @param index Index of the block in the one-dimensional representation of the chunk.
+     * @param blockId The id of the block.
+     */
+    void set(int index, BlockId blockId);
+
+    /**
+     * @brief Gives up the ownership of all sections and shares them with the returned snapshot.
+     * @return Edits owning no section, which can be handed over to other threads.
+     */
+    [[nodiscard]] ChunkBlockEdits snapshot();
+
+    /**
+     * @brief Checks whether the block differs from the generated terrain.
+     * @param index Index of the block in the one-dimensional representation of the chunk.
+     * @return True if the block is remembered, false otherwise.
+     */
+    [[nodiscard]] bool contains(int index) const;
+
+    /**
+     * @brief Returns the number of remembered blocks.
+     * @return Number of blocks which differ from the generated terrain.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Checks whether no block differs from the generated terrain.
+     * @return True if no block is remembered, false otherwise.
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Collects the blocks of all sections, for example to encode them.
+     * @return Blocks indexed by their index in the one-dimensional representation of the chunk.
+     */
+    [[nodiscard]] ChunkCodec::BlockEdits merged() const;
+
+    /**
+     * @brief Calls the function for every remembered block.
+     * @param function Function taking the index of the block and its id.
+     */
+    template<typename Function>
+    void forEach(Function&& function) const;
+
+private:
+    using Section = ChunkCodec::BlockEdits;
+
+    /**
+     * @brief Returns the section in which the block lies.
+     * @param index Index of the block in the one-dimensional representation of the chunk.
+     * @return Index of the section.
+     */
+    static int sectionOf(int index);
+
+private:
+    std::array<std::shared_ptr<Section>, NUMBER_OF_SECTIONS> mSections;
+    std::size_t mSize = 0;
+
+    /**
+     * Sections which have not been shared with any other object, so they can be changed in place.
+     */
+    std::bitset<NUMBER_OF_SECTIONS> mOwnedSections;
+};
+
+template<typename Function>
+void ChunkBlockEdits::forEach(Function&& function) const
+{
+    for (const auto& section: mSections)
+    {
+        if (section)
+        {
+            for (const auto& [index, blockId]: *section)
+            {
+                function(index, blockId);
+            }
+        }
+    }
+}
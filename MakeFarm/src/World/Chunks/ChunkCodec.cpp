@@ -0,0 +1,189 @@
+#include "ChunkCodec.h"
+#include "pch.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "World/Chunks/ChunkInterface.h"
+
+namespace
+{
+
+constexpr auto BLOCKS_PER_X_DIMENSION = ChunkInterface::BLOCKS_PER_X_DIMENSION;
+constexpr auto BLOCKS_PER_Y_DIMENSION = ChunkInterface::BLOCKS_PER_Y_DIMENSION;
+constexpr auto BLOCKS_IN_CHUNK = ChunkInterface::BLOCKS_IN_CHUNK;
+
+/**
+ * @brief A run of identical blocks lying one after another in the column order.
+ */
+struct Run
+{
+    int start;
+    int length;
+    std::uint32_t paletteIndex;
+};
+
+int chunkIndexToColumnOrder(int index)
+{
+    const auto x = index % BLOCKS_PER_X_DIMENSION;
+    const auto y = (index / BLOCKS_PER_X_DIMENSION) % BLOCKS_PER_Y_DIMENSION;
+    const auto z = index / (BLOCKS_PER_X_DIMENSION * BLOCKS_PER_Y_DIMENSION);
+    return y + BLOCKS_PER_Y_DIMENSION * (x + BLOCKS_PER_X_DIMENSION * z);
+}
+
+int columnOrderToChunkIndex(int position)
+{
+    const auto y = position % BLOCKS_PER_Y_DIMENSION;
+    const auto x = (position / BLOCKS_PER_Y_DIMENSION) % BLOCKS_PER_X_DIMENSION;
+    const auto z = position / (BLOCKS_PER_Y_DIMENSION * BLOCKS_PER_X_DIMENSION);
+    return x + BLOCKS_PER_X_DIMENSION * (y + BLOCKS_PER_Y_DIMENSION * z);
+}
+
+void writeVarint(std::vector<unsigned char>& output, std::uint32_t value)
+{
+    while (value >= 0x80)
+    {
+        output.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    output.push_back(static_cast<unsigned char>(value));
+}
+
+std::uint32_t readVarint(const unsigned char*& position, const unsigned char* end)
+{
+    std::uint32_t value = 0;
+    for (auto shift = 0; shift < 32; shift += 7)
+    {
+        if (position == end)
+        {
+            throw std::runtime_error("The encoded chunk is truncated");
+        }
+
+        const auto byte = *position++;
+        value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return value;
+        }
+    }
+    throw std::runtime_error("The encoded chunk contains a malformed number");
+}
+
+}// namespace
+
+std::vector<unsigned char> ChunkCodec::encode(const BlockEdits& blockEdits)
+{
+    std::vector<std::pair<int, BlockId>> editsInColumnOrder;
+    editsInColumnOrder.reserve(blockEdits.size());
+    for (const auto& [index, blockId]: blockEdits)
+    {
+        editsInColumnOrder.emplace_back(chunkIndexToColumnOrder(index), blockId);
+    }
+    std::sort(editsInColumnOrder.begin(), editsInColumnOrder.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    std::vector<BlockId> palette;
+    std::vector<Run> runs;
+    for (const auto& [position, blockId]: editsInColumnOrder)
+    {
+        auto paletteEntry = std::find(palette.begin(), palette.end(), blockId);
+        if (paletteEntry == palette.end())
+        {
+            paletteEntry = palette.insert(palette.end(), blockId);
+        }
+        const auto paletteIndex = static_cast<std::uint32_t>(paletteEntry - palette.begin());
+
+        if (!runs.empty() && runs.back().start + runs.back().length == position &&
+            runs.back().paletteIndex == paletteIndex)
+        {
+            ++runs.back().length;
+        }
+        else
+        {
+            runs.push_back({position, 1, paletteIndex});
+        }
+    }
+
+    std::vector<unsigned char> output;
+    output.reserve(8 + palette.size() + 3 * runs.size());
+    output.push_back(FORMAT_VERSION);
+    writeVarint(output, static_cast<std::uint32_t>(palette.size()));
+    for (const auto& blockId: palette)
+    {
+        writeVarint(output, static_cast<std::uint32_t>(blockId));
+    }
+
+    writeVarint(output, static_cast<std::uint32_t>(runs.size()));
+    auto endOfPreviousRun = 0;
+    for (const auto& run: runs)
+    {
+        writeVarint(output, static_cast<std::uint32_t>(run.start - endOfPreviousRun));
+        writeVarint(output, static_cast<std::uint32_t>(run.length));
+        writeVarint(output, run.paletteIndex);
+        endOfPreviousRun = run.start + run.length;
+    }
+    return output;
+}
+
+ChunkCodec::BlockEdits ChunkCodec::decode(const unsigned char* data, std::size_t size)
+{
+    if (size == 0 || data[0] != FORMAT_VERSION)
+    {
+        throw std::runtime_error("Unsupported version of the encoded chunk");
+    }
+    const auto* position = data + 1;
+    const auto* end = data + size;
+
+    // Every entry of the palette takes at least one byte
+    const auto paletteSize = readVarint(position, end);
+    if (paletteSize > static_cast<std::size_t>(end - position))
+    {
+        throw std::runtime_error("The encoded chunk is damaged");
+    }
+
+    std::vector<BlockId> palette(paletteSize);
+    for (auto& blockId: palette)
+    {
+        const auto id = readVarint(position, end);
+        if (id >= static_cast<std::uint32_t>(BlockId::Counter))
+        {
+            throw std::runtime_error("The encoded chunk is damaged");
+        }
+        blockId = static_cast<BlockId>(id);
+    }
+
+    const auto numberOfRuns = readVarint(position, end);
+    if (numberOfRuns > static_cast<std::size_t>(end - position))
+    {
+        throw std::runtime_error("The encoded chunk is damaged");
+    }
+
+    std::vector<Run> runs;
+    runs.reserve(numberOfRuns);
+    std::uint64_t positionInChunk = 0;
+    for (std::uint32_t run = 0; run < numberOfRuns; ++run)
+    {
+        positionInChunk += readVarint(position, end);
+        const auto length = readVarint(position, end);
+        const auto paletteIndex = readVarint(position, end);
+        if (paletteIndex >= palette.size() || positionInChunk + length > BLOCKS_IN_CHUNK)
+        {
+            throw std::runtime_error("The encoded chunk is damaged");
+        }
+        runs.push_back({static_cast<int>(positionInChunk), static_cast<int>(length), paletteIndex});
+        positionInChunk += length;
+    }
+
+    // Every block ends up in the map, so it is allocated only once
+    BlockEdits blockEdits;
+    blockEdits.reserve(static_cast<std::size_t>(positionInChunk));
+    for (const auto& run: runs)
+    {
+        const auto blockId = palette[run.paletteIndex];
+        for (auto block = run.start; block < run.start + run.length; ++block)
+        {
+            blockEdits.emplace(columnOrderToChunkIndex(block), blockId);
+        }
+    }
+    return blockEdits;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "World/Block/BlockId.h"
+
+/**
+ * @brief Compact binary encoding of the blocks of a chunk which differ from the generated terrain.
+ *
+ * Blocks are visited column by column, from the bottom to the top of each column, because that is
+ * where the longest runs of identical blocks are. The encoded data starts with the version of the
+ * format and a palette of the block ids it contains, followed by runs of identical blocks. Each
+ * run is written as the number of unchanged blocks before it, its length and its palette index.
+ * All numbers are stored as variable-length integers, so short runs take a single byte.
+ */
+class ChunkCodec
+{
+public:
+    static constexpr std::uint8_t FORMAT_VERSION = 1;
+
+    /**
+     * @brief Blocks which differ from the generated terrain, indexed by their index in the
+     * one-dimensional representation of the chunk.
+     */
+    using BlockEdits = std::unordered_map<int, BlockId>;
+
+    /**
+     * @brief Encodes blocks which differ from the generated terrain.
+     * @param blockEdits Blocks which differ from the generated terrain.
+     * @return Encoded blocks.
+     */
+    static std::vector<unsigned char> encode(const BlockEdits& blockEdits);
+
+    /**
+     * @brief Decodes blocks which differ from the generated terrain.
+     * @param data Pointer to the encoded blocks.
+     * @param size Size of the encoded data in bytes.
+     * @return Decoded blocks.
+     * @throw std::runtime_error When the data is damaged or has an unsupported version.
+     */
+    static BlockEdits decode(const unsigned char* data, std::size_t size);
+};
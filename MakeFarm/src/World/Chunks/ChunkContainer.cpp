@@ -1,13 +1,10 @@
 #include "ChunkContainer.h"
 #include "CoordinatesAroundOriginGetter.h"
+#include "Renderer3D/OverlayRenderer.h"
 #include "Utils/IteratorRanges.h"
 #include "World/Block/BlockMap.h"
 #include "pch.h"
 
-#ifdef DRAW_DEBUG_COLLISIONS
-    #include "Renderer3D/Meshes/Builders/WireframeBlockMeshBuilder.h"
-#endif
-
 
 void ChunkContainer::drawTerrain(const Renderer3D& renderer3D, const sf::Shader& shader) const
 {
@@ -36,21 +33,28 @@ void ChunkContainer::drawFlorals(const Renderer3D& renderer3D, const sf::Shader&
     }
 }
 
+void ChunkContainer::drawChunkBorders(OverlayRenderer& overlayRenderer) const
+{
+    static const auto CHUNK_SIZE =
+        sf::Vector3f{ChunkInterface::BLOCKS_PER_X_DIMENSION * Block::BLOCK_SIZE,
+                     ChunkInterface::BLOCKS_PER_Y_DIMENSION * Block::BLOCK_SIZE,
+                     ChunkInterface::BLOCKS_PER_Z_DIMENSION * Block::BLOCK_SIZE};
+
+    std::unique_lock guard(mChunksAccessMutex);
+    for (auto& [coordinate, chunk]: data())
+    {
+        const auto min = static_cast<sf::Vector3f>(chunk->positionInBlocks().nonBlockMetric());
+        overlayRenderer.addBox(min, min + CHUNK_SIZE, sf::Color::Yellow);
+    }
+}
+
 #if DRAW_DEBUG_COLLISIONS
-void ChunkContainer::drawOccuredCollisions(const Renderer3D& renderer3D,
-                                           const sf::Shader& wireframeShader) const
+void ChunkContainer::drawOccuredCollisions(OverlayRenderer& overlayRenderer) const
 {
-    WireframeBlockMeshBuilder collisionsMeshBuilder;
     for (auto collisionAABB: mOccuredCollisions)
     {
-        collisionsMeshBuilder.addWireframeBlock(collisionAABB.collisionBox());
+        overlayRenderer.addBox(collisionAABB.collisionBox(), sf::Color::Red);
     }
-    Model3D collisionModel;
-    collisionModel.setMesh(collisionsMeshBuilder.mesh3D());
-
-    glDisable(GL_DEPTH_TEST);
-    collisionModel.draw(renderer3D, wireframeShader);
-    glEnable(GL_DEPTH_TEST);
 }
 #endif
 
@@ -82,7 +86,7 @@ void ChunkContainer::tryToPlaceScheduledBlocksForPresentChunks()
 
             chunk->tryToPlaceBlock(blockToBePlaced.blockid, blockLocalCoordinates,
                                    blockToBePlaced.blocksThatMightBeOverplaced,
-                                   blockToBePlaced.rebuild);
+                                   blockToBePlaced.rebuild, blockToBePlaced.placementOrigin);
 
             begIter = mBlockMightBePlacedInFutureChunks.erase(begIter);
         }
@@ -146,10 +150,15 @@ bool ChunkContainer::doesWorldBlockExist(const Block::Coordinate& worldBlockCoor
 
 std::shared_ptr<const ChunkInterface> ChunkContainer::blockPositionToChunk(
     const Block::Coordinate& worldBlockCoordinates) const
+{
+    return chunkAt(ChunkContainer::Coordinate::blockToChunkMetric(worldBlockCoordinates));
+}
+
+std::shared_ptr<const ChunkInterface> ChunkContainer::chunkAt(
+    const ChunkContainer::Coordinate& chunkCoordinates) const
 {
     std::unique_lock guard(mChunksAccessMutex);
-    const auto foundChunk =
-        data().find(ChunkContainer::Coordinate::blockToChunkMetric(worldBlockCoordinates));
+    const auto foundChunk = data().find(chunkCoordinates);
     if (foundChunk != data().cend())
     {
         return foundChunk->second;
@@ -281,13 +290,14 @@ bool ChunkContainer::isPresent(const ChunkContainer::Coordinate& chunkPosition)
 
 void ChunkContainer::tryToPlaceBlock(const BlockId& id, Block::Coordinate worldCoordinate,
                                      std::vector<BlockId> blocksThatMightBeOverplaced,
-                                     RebuildOperation postPlaceRebuild)
+                                     RebuildOperation postPlaceRebuild,
+                                     PlacementOrigin placementOrigin)
 {
     if (const auto chunk = blockPositionToChunk(worldCoordinate))
     {
         auto localChunkCoordinates = chunk->globalToLocalCoordinates(worldCoordinate);
         chunk->tryToPlaceBlock(id, localChunkCoordinates, blocksThatMightBeOverplaced,
-                               postPlaceRebuild);
+                               postPlaceRebuild, placementOrigin);
     }
     else
     {
@@ -295,35 +305,35 @@ void ChunkContainer::tryToPlaceBlock(const BlockId& id, Block::Coordinate worldC
             ChunkContainer::Coordinate::blockToChunkMetric(worldCoordinate);
 
         std::scoped_lock guard(mBlockMightBePlacedAccessMutex);
-        mBlockMightBePlacedInFutureChunks.push_back(BlockToBePlaced{
-            chunkCoordinates, id, worldCoordinate, postPlaceRebuild, blocksThatMightBeOverplaced});
+        mBlockMightBePlacedInFutureChunks.push_back(
+            BlockToBePlaced{chunkCoordinates, id, worldCoordinate, postPlaceRebuild,
+                            blocksThatMightBeOverplaced, placementOrigin});
     }
 }
 
 bool ChunkContainer::doesItCollide(const AABB& aabb) const
 {
+    // Every block between the corners of the box intersects it, so it is enough to ask the chunks
+    // whether any of these blocks is collidable
     auto [minPoint, maxPoint] = aabb.collisionBox();
-
-    auto incrementPoint = [](float& point, float& dimension)
+    const auto minBlock = Block::Coordinate::nonBlockToBlockMetric(minPoint);
+    const auto maxBlock = Block::Coordinate::nonBlockToBlockMetric(maxPoint);
+    const auto minChunk = Coordinate::blockToChunkMetric(minBlock);
+    const auto maxChunk = Coordinate::blockToChunkMetric(maxBlock);
+    for (auto x = minChunk.x; x <= maxChunk.x; ++x)
     {
-        if (dimension < point)
+        for (auto y = minChunk.y; y <= maxChunk.y; ++y)
         {
-            dimension = point;
-        }
-        else
-        {
-            dimension += Block::BLOCK_SIZE;
-        }
-    };
-
-    for (auto x = minPoint.x; x <= maxPoint.x; incrementPoint(maxPoint.x, x))
-    {
-        for (auto y = minPoint.y; y <= maxPoint.y; incrementPoint(maxPoint.y, y))
-        {
-            for (auto z = minPoint.z; z <= maxPoint.z; incrementPoint(maxPoint.z, z))
+            for (auto z = minChunk.z; z <= maxChunk.z; ++z)
             {
-                if (isThereCollisionBetweenBlockAtGivenPoint(aabb, sf::Vector3f(x, y, z)))
+                const auto chunk = chunkAt(Coordinate(x, y, z));
+                if (chunk &&
+                    chunk->isAnyBlockWithProperty(minBlock, maxBlock, BlockProperty::Collidable))
                 {
+#if DRAW_DEBUG_COLLISIONS
+                    addCollisionToDebugDraw(aabb);
+                    limitDrawnCollisions();
+#endif
                     return true;
                 }
             }
@@ -333,77 +343,28 @@ bool ChunkContainer::doesItCollide(const AABB& aabb) const
     return false;
 }
 
-bool ChunkContainer::isThereCollisionBetweenBlockAtGivenPoint(
-    const AABB& aabb, sf::Vector3f nonBlockMetricPoint) const
+BlockRegion ChunkContainer::blockRegion(const Block::Coordinate& min,
+                                        const Block::Coordinate& max) const
 {
-    auto blockCoordinates = Block::Coordinate::nonBlockToBlockMetric(nonBlockMetricPoint);
-    auto block = worldBlock(blockCoordinates);
-    if (block && block->isCollidable())
+    auto region = BlockRegion(min, max);
+    const auto minChunk = Coordinate::blockToChunkMetric(min);
+    const auto maxChunk = Coordinate::blockToChunkMetric(max);
+    for (auto x = minChunk.x; x <= maxChunk.x; ++x)
     {
-        auto blockAABB = AABB({Block::BLOCK_SIZE, Block::BLOCK_SIZE, Block::BLOCK_SIZE});
-
-        auto blockCoordinatesNonBlockMetric = blockCoordinates.nonBlockMetric();
-        blockAABB.updatePosition(blockCoordinatesNonBlockMetric, AABB::RelativeTo::LeftBottomBack);
-
-        if (aabb.intersect(blockAABB))
-        {
-#if DRAW_DEBUG_COLLISIONS
-            addCollisionToDebugDraw(aabb);
-            addCollisionToDebugDraw(blockAABB);
-            limitDrawnCollisions();
-#endif
-            return true;
-        }
-    }
-    return false;
-}
-
-std::vector<Block> ChunkContainer::nonAirBlocksItTouches(const AABB& aabb) const
-{
-    auto blocksThatCollide = std::vector<Block>{};
-    auto [minPoint, maxPoint] = aabb.collisionBox();
-
-    auto incrementPoint = [](float& point, float& dimension)
-    {
-        if (dimension < point)
-        {
-            dimension = point;
-        }
-        else
+        for (auto y = minChunk.y; y <= maxChunk.y; ++y)
         {
-            dimension += Block::BLOCK_SIZE;
-        }
-    };
-
-    for (auto x = minPoint.x; x <= maxPoint.x; incrementPoint(maxPoint.x, x))
-    {
-        for (auto y = minPoint.y; y <= maxPoint.y; incrementPoint(maxPoint.y, y))
-        {
-            for (auto z = minPoint.z; z <= maxPoint.z; incrementPoint(maxPoint.z, z))
+            for (auto z = minChunk.z; z <= maxChunk.z; ++z)
             {
-                auto blockCoordinates =
-                    Block::Coordinate::nonBlockToBlockMetric(sf::Vector3f(x, y, z));
-                auto block = worldBlock(blockCoordinates);
-
-                if (block && block->id() != BlockId::Air)
+                // The container is not locked while the blocks are copied, since the chunks may
+                // look into the container while they are locked
+                if (const auto chunk = chunkAt(Coordinate(x, y, z)))
                 {
-                    auto blockAABB =
-                        AABB({Block::BLOCK_SIZE, Block::BLOCK_SIZE, Block::BLOCK_SIZE});
-
-                    auto blockCoordinatesNonBlockMetric = blockCoordinates.nonBlockMetric();
-                    blockAABB.updatePosition(blockCoordinatesNonBlockMetric,
-                                             AABB::RelativeTo::LeftBottomBack);
-
-                    if (aabb.intersect(blockAABB))
-                    {
-                        blocksThatCollide.emplace_back(block->id());
-                    }
+                    chunk->copyBlocksTo(region);
                 }
             }
         }
     }
-
-    return blocksThatCollide;
+    return region;
 }
 
 bool ChunkContainer::isEmpty() const
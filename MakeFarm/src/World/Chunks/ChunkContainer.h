@@ -5,11 +5,14 @@
 #include "Physics/AABB.h"
 #include "Renderer3D/Renderer3D.h"
 #include "World/Camera.h"
+#include "World/Chunks/BlockRegion.h"
 #include "World/Chunks/ChunkInterface.h"
 
 
 #define DRAW_DEBUG_COLLISIONS false
 
+class OverlayRenderer;
+
 #if DRAW_DEBUG_COLLISIONS
     #include <Physics/AABB.h>
     #include <deque>
@@ -74,14 +77,18 @@ public:
      */
     void drawFlorals(const Renderer3D& renderer3D, const sf::Shader& shader) const;
 
+    /**
+     * @brief Draws the edges of every chunk in the container on top of the game world
+     * @param overlayRenderer Renderer drawing the overlay in the current frame
+     */
+    void drawChunkBorders(OverlayRenderer& overlayRenderer) const;
+
 #if DRAW_DEBUG_COLLISIONS
     /**
      * @brief Draws the collisions that have occurred
-     * @param renderer3D Renderer3D responsible for drawing collisions to the screen
-     * @param wireframeShader Shader displaying collisions
+     * @param overlayRenderer Renderer drawing the overlay in the current frame
      */
-    void drawOccuredCollisions(const Renderer3D& renderer3D,
-                               const sf::Shader& wireframeShader) const;
+    void drawOccuredCollisions(OverlayRenderer& overlayRenderer) const;
 #endif
 
     /**
@@ -208,25 +215,31 @@ public:
      * @param worldCoordinate World coordinates of the block to place
      * @param postPlaceRebuild Optional rebuilding operation that should happen after inserting the
      * block.
+     * @param placementOrigin What places the block, which decides whether it is saved.
      */
     void tryToPlaceBlock(const BlockId& id, Block::Coordinate worldCoordinate,
                          std::vector<BlockId> blocksThatMightBeOverplaced,
-                         RebuildOperation postPlaceRebuild);
+                         RebuildOperation postPlaceRebuild, PlacementOrigin placementOrigin);
 
     /**
      * @brief Checks if a given collision box collides with a block in any chunk contained in the
-     * container.
+     * container. The chunks answer it from their bitsets of collidable blocks.
      * @param aabb Collision box to check if it collides with any block
      * @return True if it collides, false otherwise
      */
     bool doesItCollide(const AABB& aabb) const;
 
     /**
-     * @brief Blocks that the collision box touches and that are not airborne
-     * @param aabb Collision box to check if it collides with blocks
-     * @return A vector of non-air blocks touched by a collision box.
+     * @brief Gathers the properties of the blocks in the given box of the world, locking every
+     * chunk involved only once. Blocks of chunks which are not loaded have no properties.
+     * @param min Coordinates of the block of the box with the lowest coordinates.
+     * @param max Coordinates of the block of the box with the highest coordinates.
+     * @return Region holding the properties of the blocks in the box.
+     * @warning If the box holds more than BlockRegion::MAX_NUMBER_OF_BLOCKS blocks it throws a
+     * runtime_error.
      */
-    std::vector<Block> nonAirBlocksItTouches(const AABB& aabb) const;
+    [[nodiscard]] BlockRegion blockRegion(const Block::Coordinate& min,
+                                          const Block::Coordinate& max) const;
 
     /**
      * @brief Returns information about whether the container is empty, that is, whether it does not
@@ -263,13 +276,12 @@ private:
     void tryToPlaceScheduledBlocksForNewAppearingChunks();
 
     /**
-     * @brief Checks if there is a collision between the collision block and the specified point
-     * @param aabb A collision box that is checked to see if the point lies in it
-     * @param nonBlockMetricPoint Point given in non-metric coordinates
-     * @return True if there was a collision, false otherwise.
+     * @brief Returns the chunk at the given chunk coordinates.
+     * @param chunkCoordinates Coordinates of the chunk
+     * @return Chunk at these coordinates, or nullptr if it is not loaded.
      */
-    bool isThereCollisionBetweenBlockAtGivenPoint(const AABB& aabb,
-                                                  sf::Vector3f nonBlockMetricPoint) const;
+    [[nodiscard]] std::shared_ptr<const ChunkInterface> chunkAt(
+        const ChunkContainer::Coordinate& chunkCoordinates) const;
 
 private:
     /**
@@ -289,6 +301,7 @@ private:
         Block::Coordinate worldBlockCoordinates;
         RebuildOperation rebuild;
         std::vector<BlockId> blocksThatMightBeOverplaced;
+        PlacementOrigin placementOrigin;
     };
 
     /**
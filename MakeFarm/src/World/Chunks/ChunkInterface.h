@@ -2,9 +2,14 @@
 #include "Renderer3D/Renderer3D.h"
 #include "Utils/MultiDimensionalArray.h"
 #include "World/Block/Block.h"
+#include "World/Block/BlockProperty.h"
+#include "World/Chunks/PlacementOrigin.h"
 #include "World/Chunks/RebuildOperation.h"
+#include "World/Chunks/SaveBatch.h"
 #include <memory>
 
+class BlockRegion;
+
 /**
  * Chunk interface through which it is possible to mock chunk.
  */
@@ -80,11 +85,13 @@ public:
      * cannot be overwritten.
      * \param rebuildOperation An operation that determines whether and how quickly a chunk should
      * be rebuilt after a block is placed.
+     * \param placementOrigin What places the block, which decides whether it is saved as a change
+     * of the chunk it lands in.
      */
-    virtual void tryToPlaceBlock(
-        const BlockId& blockId, const Block::Coordinate& localCoordinates,
-        std::vector<BlockId> blocksThatMightBeOverplaced = {BlockId::Air},
-        const RebuildOperation& rebuildOperation = RebuildOperation::None) = 0;
+    virtual void tryToPlaceBlock(const BlockId& blockId, const Block::Coordinate& localCoordinates,
+                                 std::vector<BlockId> blocksThatMightBeOverplaced,
+                                 const RebuildOperation& rebuildOperation,
+                                 const PlacementOrigin& placementOrigin) = 0;
 
     /**
      * \brief Returns the block according to the coordinates given relative to the chunk position.
@@ -179,6 +186,23 @@ public:
      */
     virtual const Block::Coordinate& positionInBlocks() const = 0;
 
+    /**
+     * @brief Copies the properties of the blocks of this chunk that lie inside the region to it.
+     * @param region Region to which the properties of the blocks are copied.
+     */
+    virtual void copyBlocksTo(BlockRegion& region) const = 0;
+
+    /**
+     * @brief Checks whether any block of this chunk that lies inside the box has the property.
+     * @param min World coordinates of the block of the box with the lowest coordinates.
+     * @param max World coordinates of the block of the box with the highest coordinates.
+     * @param property Sought property.
+     * @return True if any such block has the property, false otherwise.
+     */
+    [[nodiscard]] virtual bool isAnyBlockWithProperty(const Block::Coordinate& min,
+                                                      const Block::Coordinate& max,
+                                                      BlockProperty property) const = 0;
+
     /**
      * @brief Finds a neighboring block located in the indicated direction
      * @param blockPos Position of the block for which the neighbor is sought
@@ -194,4 +218,10 @@ public:
      * @return The highest located block in a given column of blocks.
      */
     virtual Block::Coordinate highestSetBlock(const Block::Coordinate& blockPos) = 0;
+
+    /**
+     * @brief Saves the blocks of the chunk that differ from the generated terrain.
+     * @param batch Batch of saves to which the save of the chunk belongs.
+     */
+    virtual void saveChunkData(SaveBatch batch) = 0;
 };
@@ -7,14 +7,12 @@
 ChunkManager::ChunkManager(const TexturePack& texturePack, const std::string& savedWorldPath,
                            const int& worldSeed)
     : mTexturePack(texturePack)
-    , mSavedWorldPath(savedWorldPath)
     , mWorldSeed(worldSeed)
+    , mChunkStorage(savedWorldPath)
+    , mBlockEditJournal(savedWorldPath)
+    , mChunkSaveQueue(mChunkStorage)
+    , mChunkPrefetcher(mChunkStorage, mChunkSaveQueue)
 {
-#if DRAW_DEBUG_COLLISIONS
-    mWireframeShader.loadFromFile("resources/shaders/WireframeRenderer/VertexShader.shader",
-                                  "resources/shaders/WireframeRenderer/GeometryShader.shader",
-                                  "resources/shaders/WireframeRenderer/FragmentShader.shader");
-#endif
 }
 
 void ChunkManager::draw(const Renderer3D& renderer3D, const sf::Shader& worldRendererShader) const
@@ -23,18 +21,29 @@ void ChunkManager::draw(const Renderer3D& renderer3D, const sf::Shader& worldRen
     mChunkContainer.drawTerrain(renderer3D, worldRendererShader);
     mChunkContainer.drawLiquids(renderer3D, worldRendererShader);
     mChunkContainer.drawFlorals(renderer3D, worldRendererShader);
-#if DRAW_DEBUG_COLLISIONS
-    mChunkContainer.drawOccuredCollisions(renderer3D, mWireframeShader);
-#endif
 }
 
-void ChunkManager::update(const float& deltaTime, const Camera& camera)
+void ChunkManager::drawOverlay(OverlayRenderer& overlayRenderer) const
 {
+    if (mAreChunkBordersDrawn)
+    {
+        mChunkContainer.drawChunkBorders(overlayRenderer);
+    }
 #if DRAW_DEBUG_COLLISIONS
-    camera.updateViewProjection(mWireframeShader);
+    mChunkContainer.drawOccuredCollisions(overlayRenderer);
 #endif
+}
+
+void ChunkManager::toggleChunkBorders()
+{
+    mAreChunkBordersDrawn = !mAreChunkBordersDrawn;
+}
+
+void ChunkManager::update(const float& deltaTime)
+{
     mChunkContainer.update(deltaTime);
     rebuildChunks();
+    compactBlockEditJournalWhenTooLarge();
 }
 
 void ChunkManager::rebuildImportantChunks()
@@ -126,7 +135,12 @@ void ChunkManager::generateChunksAround(const glm::vec3& position)
     const auto chunkInThatPosition = ChunkContainer::Coordinate::blockToChunkMetric(
         Block::Coordinate::nonBlockToBlockMetric(sf::Vector3i(position.x, position.y, position.z)));
 
-    createThreadsGeneratingNewChunks(chunkInThatPosition);
+    // Removed chunks only leave their edits in the save queue, so they are still removed while it
+    // is full. It is the generation that waits for the saves to catch up.
+    if (!mChunkSaveQueue.isFull())
+    {
+        createThreadsGeneratingNewChunks(chunkInThatPosition);
+    }
     processFinishedThreadsGeneratingNewChunks();
 }
 
@@ -232,7 +246,8 @@ void ChunkManager::generateChunk(ChunkContainer::Coordinate chunkPosition)
 {
     auto newChunk =
         std::make_shared<Chunk>(sf::Vector3i(chunkPosition.nonChunkMetric()), mTexturePack,
-                                mChunkContainer, *this, mSavedWorldPath, mWorldSeed);
+                                mChunkContainer, *this, mChunkPrefetcher, mChunkSaveQueue,
+                                mBlockEditJournal, mWorldSeed);
     auto chunkCoordinates =
         ChunkContainer::Coordinate::blockToChunkMetric(newChunk->positionInBlocks());
 
@@ -245,14 +260,18 @@ void ChunkManager::generateChunk(ChunkContainer::Coordinate chunkPosition)
 std::list<ChunkContainer::Coordinate> ChunkManager::generatesNewChunksAtAndAroundOrigin(
     const ChunkContainer::Coordinate& origin)
 {
+    prefetchChunksAround(origin);
+
     auto chunkPositionGetter = CoordinatesAroundOriginGetter(origin);
     auto newlyAddedChunks = std::list<ChunkContainer::Coordinate>();
 
-    constexpr auto SQUARE_PLANE_WITH_SIDE_OF_2_TIMES_WORLD_GENERATION_CHUNK_DISTANCE =
-        2 * WORLD_GENERATION_CHUNK_DISTANCE * 2 * WORLD_GENERATION_CHUNK_DISTANCE;
-
     for (auto i = 0; i < SQUARE_PLANE_WITH_SIDE_OF_2_TIMES_WORLD_GENERATION_CHUNK_DISTANCE; ++i)
     {
+        if (mIsClosing)
+        {
+            return newlyAddedChunks;
+        }
+
         auto nextChunkPosition = chunkPositionGetter.nextValue();
         const auto hasTheNewChunkBeenAdded =
             generateChunkIfNotExist({nextChunkPosition.x, 0, nextChunkPosition.z});
@@ -275,6 +294,25 @@ std::list<ChunkContainer::Coordinate> ChunkManager::generatesNewChunksAtAndAroun
     return newlyAddedChunks;
 }
 
+void ChunkManager::prefetchChunksAround(const ChunkContainer::Coordinate& origin)
+{
+    auto chunkPositionGetter = CoordinatesAroundOriginGetter(origin);
+    std::vector<ChunkContainer::Coordinate> chunksToPrefetch;
+    for (auto i = 0; i < SQUARE_PLANE_WITH_SIDE_OF_2_TIMES_WORLD_GENERATION_CHUNK_DISTANCE &&
+                     chunksToPrefetch.size() < ChunkPrefetcher::MAX_PREFETCHED_CHUNKS;
+         ++i)
+    {
+        const auto nextChunkPosition = chunkPositionGetter.nextValue();
+        const auto chunkCoordinates =
+            ChunkContainer::Coordinate(nextChunkPosition.x, 0, nextChunkPosition.z);
+        if (!isChunkPresentInContainer(chunkCoordinates))
+        {
+            chunksToPrefetch.push_back(chunkCoordinates);
+        }
+    }
+    mChunkPrefetcher.prefetch(chunksToPrefetch);
+}
+
 bool ChunkManager::generateChunkIfNotExist(const ChunkContainer::Coordinate& chunkCoordinates)
 {
     std::unique_lock guard(mCurrentlyProcessedChunks.objectsToBeProcessedMutex);
@@ -375,13 +413,156 @@ ChunkManager::Chunks ChunkManager::rebuildNotProcessedChunks(
 
 void ChunkManager::forceFinishingAllProcesses()
 {
-    while (mChunkToRebuildFast.isAnyProcessRunning() && mChunkToRebuildSlow.isAnyProcessRunning() &&
-           mCurrentlyProcessedChunks.isAnyProcessRunning())
+    // Generating chunks request their neighbours to be rebuilt, so the generation finishes first
+    mCurrentlyProcessedChunks.finishEveryProcess();
+    mChunkToRebuildFast.finishEveryProcess();
+    mChunkToRebuildSlow.finishEveryProcess();
+}
+
+void ChunkManager::saveAllChunks(SaveBatch batch)
+{
+    std::scoped_lock guard(mChunksAccessMutex);
+    for (auto& [coordinate, chunk]: mChunkContainer.data())
     {
-        processFinishedThreadsGeneratingNewChunks();
+        chunk->saveChunkData(batch);
     }
 }
 
+void ChunkManager::waitUntilChunksAreSaved(const ChunkSaveQueue::ProgressCallback& onProgress)
+{
+    mChunkSaveQueue.flush(onProgress);
+}
+
+void ChunkManager::saveFileInBackground(const std::string& pathToFile,
+                                        std::vector<unsigned char> data, SaveBatch batch)
+{
+    mChunkSaveQueue.pushFile(pathToFile, std::move(data), batch);
+}
+
+SaveBatch ChunkManager::beginSaveBatch(bool isBandwidthLimited)
+{
+    return mChunkSaveQueue.beginBatch(isBandwidthLimited);
+}
+
+std::uint64_t ChunkManager::waitUntilSaveBatchIsWritten(SaveBatch batch)
+{
+    return mChunkSaveQueue.waitForBatch(batch);
+}
+
+void ChunkManager::limitSaveBandwidth(std::size_t bytesPerSecond)
+{
+    mChunkSaveQueue.limitBandwidth(bytesPerSecond);
+}
+
+ChunkSaveQueue::Statistics ChunkManager::saveStatistics() const
+{
+    return mChunkSaveQueue.statistics();
+}
+
+void ChunkManager::saveBeforeClosing(const ChunkSaveQueue::ProgressCallback& onProgress)
+{
+    mIsClosing = true;
+    // Nothing competes for the disk anymore and the player waits for the saving to finish
+    mChunkSaveQueue.limitBandwidth(0);
+    {
+        std::scoped_lock guard(mChunkToRebuildFast.objectsToBeProcessedMutex,
+                               mChunkToRebuildSlow.objectsToBeProcessedMutex);
+        mChunkToRebuildFast.objectsToBeProcessed.clear();
+        mChunkToRebuildSlow.objectsToBeProcessed.clear();
+    }
+    mChunkPrefetcher.prefetch({});
+    forceFinishingAllProcesses();
+    if (mBlockEditJournalCompaction.valid())
+    {
+        // An unfinished compaction is taken over by the one begun below
+        mBlockEditJournalCompaction.wait();
+    }
+
+    const auto hasCompactionBegun = mBlockEditJournal.beginCompaction();
+    saveAllChunks();
+    try
+    {
+        mChunkSaveQueue.close(onProgress);
+        mChunkStorage.synchronize();
+        if (hasCompactionBegun)
+        {
+            mBlockEditJournal.finishCompaction();
+        }
+    }
+    catch (const std::exception& exception)
+    {
+        // The journal is kept, so the edits of the chunks which were not saved are recovered when
+        // the world is opened again
+        std::cout << "[ChunkManager] Unable to save the world: " << exception.what() << std::endl;
+    }
+}
+
+void ChunkManager::compactBlockEditJournalWhenTooLarge()
+{
+    if (mBlockEditJournalCompaction.valid())
+    {
+        if (mBlockEditJournalCompaction.wait_for(std::chrono::seconds(0)) !=
+            std::future_status::ready)
+        {
+            return;
+        }
+        if (!mBlockEditJournalCompaction.get())
+        {
+            // The replaced journal is kept and merged into the compaction begun next time
+            mBlockEditJournalCompactionRetryTime =
+                std::chrono::steady_clock::now() + BLOCK_EDIT_JOURNAL_COMPACTION_RETRY_DELAY;
+        }
+    }
+
+    if (mBlockEditJournalCompactionRetryTime)
+    {
+        if (std::chrono::steady_clock::now() < *mBlockEditJournalCompactionRetryTime)
+        {
+            return;
+        }
+    }
+    else if (!mBlockEditJournal.shouldBeCompacted())
+    {
+        return;
+    }
+
+    // Edits made from now on go to the new journal, so the chunks must be handed over after the
+    // compaction began
+    if (!mBlockEditJournal.beginCompaction())
+    {
+        mBlockEditJournalCompactionRetryTime =
+            std::chrono::steady_clock::now() + BLOCK_EDIT_JOURNAL_COMPACTION_RETRY_DELAY;
+        return;
+    }
+    mBlockEditJournalCompactionRetryTime.reset();
+    saveAllChunks();
+    mBlockEditJournalCompaction = std::async(
+        std::launch::async, [this] { return tryToFinishBlockEditJournalCompaction(); });
+}
+
+bool ChunkManager::tryToFinishBlockEditJournalCompaction()
+{
+    try
+    {
+        finishBlockEditJournalCompaction();
+        return true;
+    }
+    catch (const std::exception& exception)
+    {
+        std::cout << "[ChunkManager] Unable to compact the block edit journal: "
+                  << exception.what() << std::endl;
+        return false;
+    }
+}
+
+void ChunkManager::finishBlockEditJournalCompaction(
+    const ChunkSaveQueue::ProgressCallback& onProgress)
+{
+    waitUntilChunksAreSaved(onProgress);
+    mChunkStorage.synchronize();
+    mBlockEditJournal.finishCompaction();
+}
+
 ChunkManager::~ChunkManager()
 {
     forceFinishingAllProcesses();
@@ -1,8 +1,12 @@
 #pragma once
 #include "World/Camera.h"
 #include "World/Chunks/AsyncProcessedObjects.h"
+#include "World/Chunks/BlockEditJournal.h"
 #include "World/Chunks/ChunkContainer.h"
 #include "World/Chunks/ChunkInterface.h"
+#include "World/Chunks/ChunkPrefetcher.h"
+#include "World/Chunks/ChunkSaveQueue.h"
+#include "World/Chunks/ChunkStorage.h"
 
 class ChunkManager
 {
@@ -29,8 +33,19 @@ public:
      */
     static constexpr int NUMBER_OF_THREADS_GENERATING_NEW_CHUNKS = 1;
 
+    /**
+     * @brief Time after which a compaction of the block edit journal which failed is tried again.
+     */
+    static constexpr std::chrono::seconds BLOCK_EDIT_JOURNAL_COMPACTION_RETRY_DELAY{30};
+
     using Chunks = std::list<std::shared_ptr<ChunkInterface>>;
 
+    /**
+     * @brief Number of chunk positions around the origin which are checked for missing chunks.
+     */
+    static constexpr int SQUARE_PLANE_WITH_SIDE_OF_2_TIMES_WORLD_GENERATION_CHUNK_DISTANCE =
+        2 * WORLD_GENERATION_CHUNK_DISTANCE * 2 * WORLD_GENERATION_CHUNK_DISTANCE;
+
     ChunkManager(const TexturePack& texturePack, const std::string& savedWorldPath,
                  const int& worldSeed);
 
@@ -40,24 +55,37 @@ public:
      * Draws this chunk container to the game screen
      * @param renderer3d Renderer drawing the 3D game world onto the 2D screen
      * @param worldRendererShader Shader with the help of which the object should be drawn
-     * @param collisionRendererShader Shader responsible for rendering collisions
      */
     void draw(const Renderer3D& renderer3D, const sf::Shader& worldRendererShader) const;
 
+    /**
+     * @brief Adds the borders of the chunks, if they are switched on, and the occurred collisions
+     * in debug builds to the overlay drawn on top of the world
+     * @param overlayRenderer Renderer drawing the overlay in the current frame
+     */
+    void drawOverlay(OverlayRenderer& overlayRenderer) const;
+
+    /**
+     * @brief Switches drawing the borders of the chunks on or off
+     */
+    void toggleChunkBorders();
+
     /**
      * \brief Updates the chunkcontainer logic dependent, or independent of time, every rendered
      * frame. \param deltaTime the time that has passed since the game was last updated.
      */
-    void update(const float& deltaTime, const Camera& camera);
+    void update(const float& deltaTime);
 
     /**
-     * \brief Generates new chunks around the given position (origin)
+     * \brief Generates new chunks around the given position (origin). While too many chunks are
+     * waiting to be saved, no new generation is started, so that chunks are removed faster than
+     * they are created until the saves catch up.
      * \param position The position around which the chunks are to be generated
      */
     void generateChunksAround(const glm::vec3& position);
 
     /**
-     * \brief Removes chunks too far from the camera
+     * \brief Removes chunks too far from the camera.
      * \param position Position (origin) based on which chunks will be removed
      */
     void clearFarAwayChunks(const glm::vec3& position);
@@ -85,10 +113,76 @@ public:
     ChunkContainer& chunks();
 
     /**
-     * @brief Forces the termination of all processes before the function returns
+     * @brief Waits until every generating and rebuilding process finishes before the function
+     * returns. The meshes they have prepared are not applied, so it is meant for closing the world.
      */
     void forceFinishingAllProcesses();
 
+    /**
+     * @brief Hands over every present chunk to be saved in the background.
+     * @param batch Batch of saves to which the saves of the chunks belong.
+     */
+    void saveAllChunks(SaveBatch batch = NO_SAVE_BATCH);
+
+    /**
+     * @brief Waits until every chunk handed over to be saved so far is written.
+     * @param onProgress Called on this thread from time to time with the number of chunks saved so
+     * far and the number of all chunks to save.
+     */
+    void waitUntilChunksAreSaved(const ChunkSaveQueue::ProgressCallback& onProgress = {});
+
+    /**
+     * @brief Hands over the data to be written to the file in the background, on the same threads
+     * which save the chunks.
+     * @param pathToFile The file to which the data should be written.
+     * @param data Data to be written.
+     * @param batch Batch of saves to which the save of the file belongs.
+     */
+    void saveFileInBackground(const std::string& pathToFile, std::vector<unsigned char> data,
+                              SaveBatch batch = NO_SAVE_BATCH);
+
+    /**
+     * @brief Begins a new batch of saves, which can be waited for apart from the other saves.
+     * @param isBandwidthLimited Whether the writes of the batch are limited by
+     * limitSaveBandwidth().
+     * @return The batch, to be given to the saves handed over as its part.
+     */
+    SaveBatch beginSaveBatch(bool isBandwidthLimited);
+
+    /**
+     * @brief Waits until every save of the batch is written, and ends the batch.
+     * @param batch The batch to wait for.
+     * @return Number of bytes written by the saves of the batch.
+     * @throw std::runtime_error If any save of the batch could not be written.
+     */
+    std::uint64_t waitUntilSaveBatchIsWritten(SaveBatch batch);
+
+    /**
+     * @brief Limits how many bytes the chunks and files of the batches limited by bandwidth are
+     * written with per second, so that saving does not compete with the game for the disk.
+     * @param bytesPerSecond Maximum number of bytes written per second, or 0 for no limit.
+     */
+    void limitSaveBandwidth(std::size_t bytesPerSecond);
+
+    /**
+     * @brief Returns how many chunk saves were performed and how many were skipped, because the
+     * chunks did not change since they were last loaded or saved.
+     * @return Statistics of the chunk saves.
+     */
+    ChunkSaveQueue::Statistics saveStatistics() const;
+
+    /**
+     * @brief Saves the world before it is closed. No more chunks are generated or rebuilt, the
+     * processes still running are waited for, every chunk is handed over to the saving threads, and
+     * the saved chunks are stored on the disk with a single synchronization at the end. The save
+     * queue accepts nothing afterwards. The block edits journaled so far are dropped, as they are
+     * no longer needed. Errors are reported rather than thrown, as it is called while the game is
+     * being closed, and the journal is kept if any chunk could not be saved.
+     * @param onProgress Called on this thread from time to time with the number of chunks saved so
+     * far and the number of all chunks to save.
+     */
+    void saveBeforeClosing(const ChunkSaveQueue::ProgressCallback& onProgress = {});
+
     /**
      * @brief Calculates a player's spawn point
      * @return Spawn point of the player in non-block coordinates.
@@ -132,6 +226,13 @@ private:
      */
     void generateChunk(ChunkContainer::Coordinate chunkPosition);
 
+    /**
+     * \brief Requests the chunks which are missing around the origin to be read ahead. The ones
+     * closest to the origin come first, as they will be generated first.
+     * \param origin A reference point around which new chunks will be generated
+     */
+    void prefetchChunksAround(const ChunkContainer::Coordinate& origin);
+
     /**
      * \brief Generates new chunks in and around the specified origin
      * \param origin A reference point in and around which new chunks will be generated
@@ -255,12 +356,39 @@ private:
                                          const RebuildPriority& rebuildSpeed,
                                          const ChunkContainer::Coordinate& chunkCoordinates);
 
+    /**
+     * @brief Starts compacting the block edit journal in the background once it has grown too
+     * much. The present chunks are handed over to be saved right away, and the rest waits for the
+     * disk on another thread. A compaction which failed keeps the replaced journal and is begun
+     * again once BLOCK_EDIT_JOURNAL_COMPACTION_RETRY_DELAY has passed.
+     */
+    void compactBlockEditJournalWhenTooLarge();
+
+    /**
+     * @brief Finishes the compaction of the block edit journal and reports its error instead of
+     * throwing it, as it runs in the background of the game loop.
+     * @return True if the compaction finished, false if the replaced journal had to be kept.
+     */
+    bool tryToFinishBlockEditJournalCompaction();
+
+    /**
+     * @brief Waits until the chunks handed over to be saved are stored on the disk and drops the
+     * journal replaced when the compaction began.
+     * @param onProgress Called from time to time with the number of chunks saved so far and the
+     * number of all chunks to save.
+     */
+    void finishBlockEditJournalCompaction(const ChunkSaveQueue::ProgressCallback& onProgress = {});
+
     /** == Members == */
     const TexturePack& mTexturePack;
-    const std::string& mSavedWorldPath;
     const int& mWorldSeed;
 
     /** Chunks */
+    // Chunks save themselves when destroyed, so the storage must be destroyed after them
+    ChunkStorage mChunkStorage;
+    BlockEditJournal mBlockEditJournal;
+    ChunkSaveQueue mChunkSaveQueue;
+    ChunkPrefetcher mChunkPrefetcher;
     ChunkContainer mChunkContainer;
     mutable std::recursive_mutex mChunksAccessMutex;
 
@@ -268,10 +396,10 @@ private:
     AsyncProcessedObjects<std::shared_ptr<ChunkInterface>> mChunkToRebuildFast;
     AsyncProcessedObjects<std::shared_ptr<ChunkInterface>> mChunkToRebuildSlow;
     AsyncProcessedObjects<ChunkContainer::Coordinate> mCurrentlyProcessedChunks;
-
-#if DRAW_DEBUG_COLLISIONS
-    sf::Shader mWireframeShader;
-#endif
+    std::future<bool> mBlockEditJournalCompaction;
+    std::optional<std::chrono::steady_clock::time_point> mBlockEditJournalCompactionRetryTime;
+    std::atomic<bool> mIsClosing = false;
+    bool mAreChunkBordersDrawn = false;
 };
 
 template<typename T>
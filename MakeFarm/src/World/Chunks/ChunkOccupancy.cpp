@@ -0,0 +1,165 @@
+#include "ChunkOccupancy.h"
+#include "pch.h"
+
+#include <algorithm>
+
+#include "World/Block/BlockType.h"
+#include "World/Chunks/BlockRegion.h"
+
+ChunkOccupancy::Properties ChunkOccupancy::properties(const BlockType& blockType)
+{
+    auto properties = Properties{0};
+    auto addProperty = [&properties](BlockProperty property)
+    { properties |= Properties{1} << static_cast<int>(property); };
+
+    if (blockType.collidable)
+    {
+        addProperty(BlockProperty::Collidable);
+    }
+    if (!blockType.transparent)
+    {
+        addProperty(BlockProperty::Opaque);
+    }
+    if (blockType.id == BlockId::Water)
+    {
+        addProperty(BlockProperty::Fluid);
+    }
+    if (blockType.id != BlockId::Air)
+    {
+        addProperty(BlockProperty::NonAir);
+    }
+    return properties;
+}
+
+bool ChunkOccupancy::hasProperty(Properties properties, BlockProperty property)
+{
+    return (properties >> static_cast<int>(property)) & 1;
+}
+
+std::pair<Block::Coordinate, Block::Coordinate> ChunkOccupancy::localPartOfBox(
+    const Block::Coordinate& min, const Block::Coordinate& max,
+    const Block::Coordinate& chunkPosition)
+{
+    return {Block::Coordinate(std::max(min.x - chunkPosition.x, 0),
+                              std::max(min.y - chunkPosition.y, 0),
+                              std::max(min.z - chunkPosition.z, 0)),
+            Block::Coordinate(
+                std::min(max.x - chunkPosition.x, ChunkInterface::BLOCKS_PER_X_DIMENSION - 1),
+                std::min(max.y - chunkPosition.y, ChunkInterface::BLOCKS_PER_Y_DIMENSION - 1),
+                std::min(max.z - chunkPosition.z, ChunkInterface::BLOCKS_PER_Z_DIMENSION - 1))};
+}
+
+void ChunkOccupancy::rebuild(const ChunkInterface::ChunkBlocks& chunkBlocks)
+{
+    mSections = {};
+    for (auto x = 0; x < ChunkInterface::BLOCKS_PER_X_DIMENSION; ++x)
+    {
+        for (auto y = 0; y < ChunkInterface::BLOCKS_PER_Y_DIMENSION; ++y)
+        {
+            for (auto z = 0; z < ChunkInterface::BLOCKS_PER_Z_DIMENSION; ++z)
+            {
+                update({x, y, z}, chunkBlocks[x][y][z]->type());
+            }
+        }
+    }
+}
+
+void ChunkOccupancy::update(const Block::Coordinate& localCoordinates, const BlockType& blockType)
+{
+    const auto blockProperties = properties(blockType);
+    const auto bit = bitIndex(localCoordinates);
+    const auto mask = std::uint64_t{1} << (bit % BITS_PER_WORD);
+
+    auto& section = mSections[localCoordinates.y / BLOCKS_PER_SECTION_Y_DIMENSION];
+    for (auto property = 0; property < static_cast<int>(BlockProperty::Counter); ++property)
+    {
+        auto& word = section[property][bit / BITS_PER_WORD];
+        if (hasProperty(blockProperties, static_cast<BlockProperty>(property)))
+        {
+            word |= mask;
+        }
+        else
+        {
+            word &= ~mask;
+        }
+    }
+}
+
+ChunkOccupancy::Properties ChunkOccupancy::properties(
+    const Block::Coordinate& localCoordinates) const
+{
+    const auto bit = bitIndex(localCoordinates);
+    const auto& section = mSections[localCoordinates.y / BLOCKS_PER_SECTION_Y_DIMENSION];
+
+    auto blockProperties = Properties{0};
+    for (auto property = 0; property < static_cast<int>(BlockProperty::Counter); ++property)
+    {
+        const auto isSet = (section[property][bit / BITS_PER_WORD] >> (bit % BITS_PER_WORD)) & 1;
+        blockProperties |= static_cast<Properties>(isSet << property);
+    }
+    return blockProperties;
+}
+
+bool ChunkOccupancy::hasProperty(const Block::Coordinate& localCoordinates,
+                                 BlockProperty property) const
+{
+    const auto bit = bitIndex(localCoordinates);
+    const auto& bits =
+        mSections[localCoordinates.y / BLOCKS_PER_SECTION_Y_DIMENSION][static_cast<int>(property)];
+    return (bits[bit / BITS_PER_WORD] >> (bit % BITS_PER_WORD)) & 1;
+}
+
+bool ChunkOccupancy::isAnyBlockWithProperty(const Block::Coordinate& localMin,
+                                            const Block::Coordinate& localMax,
+                                            BlockProperty property) const
+{
+    // Mask of the blocks of the box in a single row along the X axis
+    const auto rowWidth = localMax.x - localMin.x + 1;
+    const auto rowMask = ((std::uint64_t{1} << rowWidth) - 1) << localMin.x;
+
+    for (auto y = localMin.y; y <= localMax.y; ++y)
+    {
+        const auto& bits =
+            mSections[y / BLOCKS_PER_SECTION_Y_DIMENSION][static_cast<int>(property)];
+        for (auto z = localMin.z; z <= localMax.z; ++z)
+        {
+            const auto rowBit = bitIndex({0, y, z});
+            if ((bits[rowBit / BITS_PER_WORD] >> (rowBit % BITS_PER_WORD)) & rowMask)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void ChunkOccupancy::copyTo(BlockRegion& region, const Block::Coordinate& chunkPosition) const
+{
+    const auto [localMin, localMax] = localPartOfBox(region.min(), region.max(), chunkPosition);
+    for (auto x = localMin.x; x <= localMax.x; ++x)
+    {
+        for (auto y = localMin.y; y <= localMax.y; ++y)
+        {
+            for (auto z = localMin.z; z <= localMax.z; ++z)
+            {
+                region.setProperties(Block::Coordinate(x + chunkPosition.x, y + chunkPosition.y,
+                                                       z + chunkPosition.z),
+                                     properties({x, y, z}));
+            }
+        }
+    }
+}
+
+bool ChunkOccupancy::isSectionOnlyAir(int section) const
+{
+    const auto& bits = mSections[section][static_cast<int>(BlockProperty::NonAir)];
+    return std::all_of(bits.cbegin(), bits.cend(), [](std::uint64_t word) { return word == 0; });
+}
+
+int ChunkOccupancy::bitIndex(const Block::Coordinate& localCoordinates)
+{
+    const auto layer = localCoordinates.y % BLOCKS_PER_SECTION_Y_DIMENSION;
+    return (layer * ChunkInterface::BLOCKS_PER_Z_DIMENSION + localCoordinates.z) *
+               ChunkInterface::BLOCKS_PER_X_DIMENSION +
+           localCoordinates.x;
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include "World/Block/BlockProperty.h"
+#include "World/Chunks/ChunkInterface.h"
+
+class BlockRegion;
+struct BlockType;
+
+/**
+ * @brief Packed bitsets telling which blocks of the chunk have each of the block properties.
+ *
+ * The chunk is divided into sections of BLOCKS_PER_SECTION_Y_DIMENSION block layers, and every
+ * section keeps a bit per block for every property. A row of blocks along the X axis lies inside a
+ * single word, so checking a box of blocks takes a single operation per row, and a section
+ * without any solid blocks can be skipped at once.
+ *
+ * @warning It is not thread-safe, it is guarded by the lock of the chunk that owns it.
+ */
+class ChunkOccupancy
+{
+public:
+    /**
+     * @brief Number of block layers along the Y axis in a single section.
+     */
+    static constexpr int BLOCKS_PER_SECTION_Y_DIMENSION = 16;
+    static constexpr int NUMBER_OF_SECTIONS =
+        (ChunkInterface::BLOCKS_PER_Y_DIMENSION + BLOCKS_PER_SECTION_Y_DIMENSION - 1) /
+        BLOCKS_PER_SECTION_Y_DIMENSION;
+
+    /**
+     * @brief Properties of a single block, the property is present if the bit at its index is set.
+     */
+    using Properties = std::uint8_t;
+
+    /**
+     * @brief Returns the properties that the blocks of the given type have.
+     * @param blockType Type of the block.
+     * @return Properties of the blocks of this type.
+     */
+    [[nodiscard]] static Properties properties(const BlockType& blockType);
+
+    /**
+     * @brief Checks whether the property is among the given properties.
+     * @param properties Properties of the block.
+     * @param property Sought property.
+     * @return True if the property is present, false otherwise.
+     */
+    [[nodiscard]] static bool hasProperty(Properties properties, BlockProperty property);
+
+    /**
+     * @brief Returns the part of the box of world coordinates which lies inside the chunk.
+     * @param min World coordinates of the block of the box with the lowest coordinates.
+     * @param max World coordinates of the block of the box with the highest coordinates.
+     * @param chunkPosition Position of the chunk in blocks.
+     * @return Local coordinates of the lowest and the highest block of that part. The part is
+     * empty if the box does not reach into the chunk.
+     */
+    [[nodiscard]] static std::pair<Block::Coordinate, Block::Coordinate> localPartOfBox(
+        const Block::Coordinate& min, const Block::Coordinate& max,
+        const Block::Coordinate& chunkPosition);
+
+    /**
+     * @brief Sets the properties of all blocks of the chunk anew.
+     * @param chunkBlocks All blocks of the chunk.
+     */
+    void rebuild(const ChunkInterface::ChunkBlocks& chunkBlocks);
+
+    /**
+     * @brief Sets the properties of the block which has just been changed.
+     * @param localCoordinates Coordinates relative to the position of the chunk
+     * @param blockType New type of the block.
+     */
+    void update(const Block::Coordinate& localCoordinates, const BlockType& blockType);
+
+    /**
+     * @brief Returns the properties of the block.
+     * @param localCoordinates Coordinates relative to the position of the chunk
+     * @return Properties of the block.
+     */
+    [[nodiscard]] Properties properties(const Block::Coordinate& localCoordinates) const;
+
+    /**
+     * @brief Checks whether the block has the given property.
+     * @param localCoordinates Coordinates relative to the position of the chunk
+     * @param property Sought property.
+     * @return True if the block has the property, false otherwise.
+     */
+    [[nodiscard]] bool hasProperty(const Block::Coordinate& localCoordinates,
+                                   BlockProperty property) const;
+
+    /**
+     * @brief Checks whether any block inside the box has the given property.
+     * @param localMin Local coordinates of the block of the box with the lowest coordinates.
+     * @param localMax Local coordinates of the block of the box with the highest coordinates.
+     * @param property Sought property.
+     * @return True if any block of the box has the property, false otherwise.
+     * @warning The box must lie inside the chunk.
+     */
+    [[nodiscard]] bool isAnyBlockWithProperty(const Block::Coordinate& localMin,
+                                              const Block::Coordinate& localMax,
+                                              BlockProperty property) const;
+
+    /**
+     * @brief Copies the properties of the blocks of the chunk which lie inside the region into it.
+     * @param region Region to which the properties are copied.
+     * @param chunkPosition Position of the chunk in blocks.
+     */
+    void copyTo(BlockRegion& region, const Block::Coordinate& chunkPosition) const;
+
+    /**
+     * @brief Checks whether the section consists of air only.
+     * @param section Index of the section, counting from the bottom of the chunk.
+     * @return True if there are only air blocks in the section, false otherwise.
+     */
+    [[nodiscard]] bool isSectionOnlyAir(int section) const;
+
+private:
+    static constexpr int BITS_PER_WORD = 64;
+    static constexpr int BLOCKS_IN_SECTION = ChunkInterface::BLOCKS_PER_X_DIMENSION *
+                                             BLOCKS_PER_SECTION_Y_DIMENSION *
+                                             ChunkInterface::BLOCKS_PER_Z_DIMENSION;
+    static constexpr int WORDS_IN_SECTION = BLOCKS_IN_SECTION / BITS_PER_WORD;
+    static_assert(BITS_PER_WORD % ChunkInterface::BLOCKS_PER_X_DIMENSION == 0 &&
+                      ChunkInterface::BLOCKS_PER_X_DIMENSION < BITS_PER_WORD,
+                  "A row of blocks along the X axis must fit inside a single word");
+
+    using Bits = std::array<std::uint64_t, WORDS_IN_SECTION>;
+    using Section = std::array<Bits, static_cast<int>(BlockProperty::Counter)>;
+
+    /**
+     * @brief Returns the position of the bit of the block inside its section.
+     * @param localCoordinates Coordinates relative to the position of the chunk
+     * @return Index of the bit of the block.
+     */
+    [[nodiscard]] static int bitIndex(const Block::Coordinate& localCoordinates);
+
+private:
+    std::array<Section, NUMBER_OF_SECTIONS> mSections{};
+};
@@ -0,0 +1,139 @@
+#include "ChunkPrefetcher.h"
+#include "pch.h"
+
+#include "World/Chunks/ChunkSaveQueue.h"
+#include "World/Chunks/ChunkStorage.h"
+
+ChunkPrefetcher::ChunkPrefetcher(ChunkStorage& chunkStorage, const ChunkSaveQueue& chunkSaveQueue)
+    : mChunkStorage(chunkStorage)
+    , mChunkSaveQueue(chunkSaveQueue)
+{
+    for (auto i = 0; i < NUMBER_OF_READING_THREADS; ++i)
+    {
+        mReadingThreads.emplace_back(&ChunkPrefetcher::processReads, this);
+    }
+}
+
+ChunkPrefetcher::~ChunkPrefetcher()
+{
+    {
+        std::scoped_lock guard(mPrefetchedChunksMutex);
+        mShouldStop = true;
+    }
+    mReadRequested.notify_all();
+    for (auto& readingThread: mReadingThreads)
+    {
+        readingThread.join();
+    }
+}
+
+void ChunkPrefetcher::prefetch(const std::vector<ChunkContainer::Coordinate>& chunkCoordinates)
+{
+    // Chunks which have never been saved are generated without reading anything. The storage is
+    // asked before locking, so the chunks being read are not waited for by the storage lock.
+    std::vector<ChunkContainer::Coordinate> savedChunks;
+    for (const auto& chunkCoordinate: chunkCoordinates)
+    {
+        if (mChunkStorage.doesChunkExist(chunkCoordinate))
+        {
+            savedChunks.push_back(chunkCoordinate);
+        }
+    }
+
+    {
+        std::scoped_lock guard(mPrefetchedChunksMutex);
+        const std::unordered_set<ChunkContainer::Coordinate, std::hash<CoordinateBase>>
+            requestedChunks(chunkCoordinates.begin(), chunkCoordinates.end());
+        std::erase_if(mPrefetchedChunks, [&requestedChunks](const auto& prefetchedChunk)
+                      { return !requestedChunks.contains(prefetchedChunk.first); });
+
+        mRequestedChunks.clear();
+        for (const auto& chunkCoordinate: savedChunks)
+        {
+            const auto numberOfPrefetchedChunks =
+                mRequestedChunks.size() + mChunksBeingRead.size() + mPrefetchedChunks.size();
+            if (numberOfPrefetchedChunks >= MAX_PREFETCHED_CHUNKS)
+            {
+                break;
+            }
+
+            if (!mPrefetchedChunks.contains(chunkCoordinate) &&
+                !mChunksBeingRead.contains(chunkCoordinate))
+            {
+                mRequestedChunks.push_back(chunkCoordinate);
+            }
+        }
+    }
+    mReadRequested.notify_all();
+}
+
+bool ChunkPrefetcher::readChunk(const ChunkContainer::Coordinate& chunkCoordinate,
+                                std::vector<unsigned char>& buffer)
+{
+    std::optional<std::uint64_t> prefetchedSaveGeneration;
+    {
+        std::scoped_lock guard(mPrefetchedChunksMutex);
+        if (auto prefetchedChunk = mPrefetchedChunks.find(chunkCoordinate);
+            prefetchedChunk != mPrefetchedChunks.end())
+        {
+            buffer.swap(prefetchedChunk->second.savedData);
+            prefetchedSaveGeneration = prefetchedChunk->second.saveGeneration;
+            mPrefetchedChunks.erase(prefetchedChunk);
+        }
+        else
+        {
+            // The chunk is read right now, so there is no need to read it ahead anymore
+            std::erase(mRequestedChunks, chunkCoordinate);
+        }
+    }
+
+    // The chunk may have been saved after it was read ahead, so then its data is outdated
+    if (prefetchedSaveGeneration &&
+        *prefetchedSaveGeneration == mChunkStorage.saveGeneration(chunkCoordinate))
+    {
+        return !buffer.empty();
+    }
+    return mChunkStorage.readChunk(chunkCoordinate, buffer);
+}
+
+void ChunkPrefetcher::processReads()
+{
+    std::unique_lock lock(mPrefetchedChunksMutex);
+    while (true)
+    {
+        mReadRequested.wait(lock, [this] { return mShouldStop || !mRequestedChunks.empty(); });
+        if (mShouldStop)
+        {
+            return;
+        }
+
+        const auto chunkCoordinate = mRequestedChunks.front();
+        mRequestedChunks.pop_front();
+        mChunksBeingRead.insert(chunkCoordinate);
+        lock.unlock();
+
+        // The generation is taken before reading, so a save finished during the read is noticed
+        const auto saveGeneration = mChunkStorage.saveGeneration(chunkCoordinate);
+        std::vector<unsigned char> savedData;
+        auto wasChunkRead = false;
+        if (!mChunkSaveQueue.pendingSnapshot(chunkCoordinate))
+        {
+            try
+            {
+                mChunkStorage.readChunk(chunkCoordinate, savedData);
+                wasChunkRead = true;
+            }
+            catch (const std::exception&)
+            {
+                // The chunk will read it by itself and find out about the problem then
+            }
+        }
+
+        lock.lock();
+        mChunksBeingRead.erase(chunkCoordinate);
+        if (wasChunkRead)
+        {
+            mPrefetchedChunks[chunkCoordinate] = {std::move(savedData), saveGeneration};
+        }
+    }
+}
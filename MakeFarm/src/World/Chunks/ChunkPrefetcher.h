@@ -0,0 +1,102 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "World/Chunks/ChunkContainer.h"
+
+class ChunkSaveQueue;
+class ChunkStorage;
+
+/**
+ * @brief Reads the saved data of chunks before they are created.
+ *
+ * Chunks that are expected to be created soon are read in batches by the threads of the
+ * prefetcher. A chunk created after its data has arrived does not wait for the disk. A chunk whose
+ * data has not arrived yet reads it by itself, as it would without the prefetcher. Read data is
+ * remembered together with the save generation of the chunk it was read at, and it is not used
+ * if the chunk has been saved again since then.
+ */
+class ChunkPrefetcher
+{
+public:
+    /**
+     * @brief Number of threads reading the chunks.
+     */
+    static constexpr int NUMBER_OF_READING_THREADS = 2;
+
+    /**
+     * @brief Maximum number of chunks which are read ahead or wait to be taken.
+     */
+    static constexpr std::size_t MAX_PREFETCHED_CHUNKS = 64;
+
+    /**
+     * @brief Creates the prefetcher and starts its reading threads.
+     * @param chunkStorage Storage from which the chunks are read.
+     * @param chunkSaveQueue Queue of chunks waiting to be saved. Chunks waiting in it are not read,
+     * as the storage does not have their newest state yet.
+     */
+    ChunkPrefetcher(ChunkStorage& chunkStorage, const ChunkSaveQueue& chunkSaveQueue);
+    ChunkPrefetcher(const ChunkPrefetcher&) = delete;
+    ChunkPrefetcher& operator=(const ChunkPrefetcher&) = delete;
+
+    /**
+     * @brief Stops the reading threads. Chunks being read are finished first.
+     */
+    ~ChunkPrefetcher();
+
+    /**
+     * @brief Requests the saved chunks to be read ahead. It replaces the previous batch of
+     * requested chunks that have not started to be read, and forgets the read chunks not present in
+     * the new batch, as the player has probably gone elsewhere.
+     * @param chunkCoordinates Coordinates of the chunks, starting from the most needed one.
+     */
+    void prefetch(const std::vector<ChunkContainer::Coordinate>& chunkCoordinates);
+
+    /**
+     * @brief Reads the saved data of the chunk. It is taken from the already read chunks if it has
+     * arrived, otherwise it is read from the storage.
+     * @param chunkCoordinate Coordinates of the chunk.
+     * @param buffer Buffer which holds exactly the saved data of the chunk after a successful read.
+     * @return True if the data was read, false if the chunk has not been saved.
+     */
+    bool readChunk(const ChunkContainer::Coordinate& chunkCoordinate,
+                   std::vector<unsigned char>& buffer);
+
+private:
+    /**
+     * @brief Loop of the reading threads. Reads requested chunks until the prefetcher is destroyed.
+     */
+    void processReads();
+
+private:
+    ChunkStorage& mChunkStorage;
+    const ChunkSaveQueue& mChunkSaveQueue;
+
+    std::mutex mPrefetchedChunksMutex;
+    std::condition_variable mReadRequested;
+    std::deque<ChunkContainer::Coordinate> mRequestedChunks;
+    std::unordered_set<ChunkContainer::Coordinate, std::hash<CoordinateBase>> mChunksBeingRead;
+
+    /**
+     * @brief Saved data of the chunk which has already been read.
+     */
+    struct PrefetchedChunk
+    {
+        /** Empty data means that the chunk has not been saved */
+        std::vector<unsigned char> savedData;
+
+        /** Save generation of the chunk in the storage before the data was read */
+        std::uint64_t saveGeneration;
+    };
+
+    std::unordered_map<ChunkContainer::Coordinate, PrefetchedChunk, std::hash<CoordinateBase>>
+        mPrefetchedChunks;
+    bool mShouldStop = false;
+
+    std::vector<std::thread> mReadingThreads;
+};
@@ -0,0 +1,508 @@
+#include "ChunkSaveQueue.h"
+#include "pch.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "World/Chunks/ChunkStorage.h"
+
+ChunkSaveQueue::ChunkSaveQueue(ChunkStorage& chunkStorage)
+    : mChunkStorage(chunkStorage)
+{
+    for (auto i = 0; i < NUMBER_OF_SAVING_THREADS; ++i)
+    {
+        mSavingThreads.emplace_back(&ChunkSaveQueue::processSaves, this);
+    }
+}
+
+ChunkSaveQueue::~ChunkSaveQueue()
+{
+    {
+        std::scoped_lock guard(mPendingSavesMutex);
+        // The failed writes are tried once more before the threads stop
+        mChunksWaitingForRetry.clear();
+        mFilesWaitingForRetry.clear();
+        mShouldStop = true;
+    }
+    limitBandwidth(0);
+    mSaveRequested.notify_all();
+    for (auto& savingThread: mSavingThreads)
+    {
+        savingThread.join();
+    }
+
+    if (const auto failedSaves = numberOfFailedSaves())
+    {
+        std::cout << "[ChunkSaveQueue] Dropping " << failedSaves
+                  << " chunks and files which could not be written" << std::endl;
+    }
+}
+
+void ChunkSaveQueue::push(const ChunkContainer::Coordinate& chunkCoordinate, Snapshot snapshot,
+                          SaveBatch batch)
+{
+    {
+        std::scoped_lock guard(mPendingSavesMutex);
+        if (mIsClosed)
+        {
+            std::cout << "[ChunkSaveQueue] Dropping the chunk handed over after closing: "
+                      << chunkCoordinate.x << " " << chunkCoordinate.y << " " << chunkCoordinate.z
+                      << std::endl;
+            return;
+        }
+
+        auto& pendingSave = mPendingSaves[chunkCoordinate];
+        if (pendingSave.snapshot)
+        {
+            mPendingBlockEdits -= pendingSave.snapshot->size();
+            finishSaveOfBatch(pendingSave.batch);
+        }
+        mPendingBlockEdits += snapshot->size();
+        pendingSave = {std::move(snapshot), mNextSequenceNumber++, addSaveToBatch(batch),
+                       pendingSave.failedWrites};
+    }
+    mSaveRequested.notify_one();
+}
+
+void ChunkSaveQueue::pushFile(const std::string& pathToFile, std::vector<unsigned char> data,
+                              SaveBatch batch)
+{
+    {
+        std::scoped_lock guard(mPendingSavesMutex);
+        if (mIsClosed)
+        {
+            std::cout << "[ChunkSaveQueue] Dropping the file handed over after closing: "
+                      << pathToFile << std::endl;
+            return;
+        }
+
+        auto& pendingFile = mPendingFiles[pathToFile];
+        if (pendingFile.data)
+        {
+            finishSaveOfBatch(pendingFile.batch);
+        }
+        pendingFile = {std::make_shared<const std::vector<unsigned char>>(std::move(data)),
+                       mNextSequenceNumber++, addSaveToBatch(batch), pendingFile.failedWrites};
+    }
+    mSaveRequested.notify_one();
+}
+
+void ChunkSaveQueue::countSkippedSave()
+{
+    std::scoped_lock guard(mPendingSavesMutex);
+    ++mStatistics.skippedSaves;
+}
+
+ChunkSaveQueue::Snapshot ChunkSaveQueue::pendingSnapshot(
+    const ChunkContainer::Coordinate& chunkCoordinate) const
+{
+    std::scoped_lock guard(mPendingSavesMutex);
+    if (const auto pendingSave = mPendingSaves.find(chunkCoordinate);
+        pendingSave != mPendingSaves.end())
+    {
+        return pendingSave->second.snapshot;
+    }
+    return nullptr;
+}
+
+void ChunkSaveQueue::flush(const ProgressCallback& onProgress)
+{
+    std::unique_lock lock(mPendingSavesMutex);
+    if (numberOfFailedSaves() > 0)
+    {
+        mChunksWaitingForRetry.clear();
+        mFilesWaitingForRetry.clear();
+        mSaveRequested.notify_all();
+    }
+
+    // Saves failing during the flush wait for their next write, so they do not hold it up
+    const auto allSaves = mPendingSaves.size() + mPendingFiles.size();
+    const auto isEverythingWritten = [this]
+    { return mPendingSaves.size() + mPendingFiles.size() == numberOfFailedSaves(); };
+    while (!mSaveFinished.wait_for(lock, PROGRESS_REPORT_INTERVAL, isEverythingWritten))
+    {
+        if (onProgress)
+        {
+            // Saves handed over during the flush may make more of them wait than at its start
+            const auto pendingSaves = mPendingSaves.size() + mPendingFiles.size();
+            const auto writtenSaves = allSaves - std::min(allSaves, pendingSaves);
+            lock.unlock();
+            onProgress(writtenSaves, allSaves);
+            lock.lock();
+        }
+    }
+    if (const auto failedSaves = numberOfFailedSaves())
+    {
+        throw std::runtime_error("Unable to write " + std::to_string(failedSaves) +
+                                 " chunks and files, they are written again later");
+    }
+}
+
+SaveBatch ChunkSaveQueue::beginBatch(bool isBandwidthLimited)
+{
+    std::scoped_lock guard(mPendingSavesMutex);
+    const auto batch = ++mLastBatch;
+    mBatches[batch].isBandwidthLimited = isBandwidthLimited;
+    return batch;
+}
+
+std::uint64_t ChunkSaveQueue::waitForBatch(SaveBatch batch)
+{
+    std::unique_lock lock(mPendingSavesMutex);
+    if (!mBatches.contains(batch))
+    {
+        return 0;
+    }
+    mSaveFinished.wait(lock, [this, batch] { return mBatches.at(batch).pendingSaves == 0; });
+
+    const auto finishedBatch = mBatches.extract(batch);
+    if (finishedBatch.mapped().savingError)
+    {
+        std::rethrow_exception(finishedBatch.mapped().savingError);
+    }
+    return finishedBatch.mapped().writtenBytes;
+}
+
+void ChunkSaveQueue::close(const ProgressCallback& onProgress)
+{
+    {
+        std::scoped_lock guard(mPendingSavesMutex);
+        mIsClosed = true;
+    }
+    flush(onProgress);
+}
+
+bool ChunkSaveQueue::isFull() const
+{
+    std::scoped_lock guard(mPendingSavesMutex);
+    return mPendingBlockEdits > MAX_PENDING_BLOCK_EDITS;
+}
+
+ChunkSaveQueue::Statistics ChunkSaveQueue::statistics() const
+{
+    std::scoped_lock guard(mPendingSavesMutex);
+    return mStatistics;
+}
+
+void ChunkSaveQueue::limitBandwidth(std::size_t bytesPerSecond)
+{
+    {
+        std::scoped_lock guard(mBandwidthMutex);
+        mBandwidthLimit = bytesPerSecond;
+        mNextWriteTime = {};
+    }
+    mBandwidthLimitChanged.notify_all();
+}
+
+void ChunkSaveQueue::processSaves()
+{
+    std::unique_lock lock(mPendingSavesMutex);
+    const auto isWorkWaiting = [this] { return mShouldStop || isAnySaveWaiting(); };
+    while (true)
+    {
+        if (const auto nextRetryTime = releaseDueRetries())
+        {
+            mSaveRequested.wait_until(lock, *nextRetryTime, isWorkWaiting);
+        }
+        else
+        {
+            mSaveRequested.wait(lock, isWorkWaiting);
+        }
+
+        // Files are few and small, and the player would lose more if they were not written
+        if (!saveWaitingFile(lock) && !saveWaitingChunk(lock) && mShouldStop)
+        {
+            // The queue is being destroyed and the rest is written by the threads writing it now
+            return;
+        }
+    }
+}
+
+bool ChunkSaveQueue::isAnySaveWaiting() const
+{
+    return mPendingSaves.size() > mChunksBeingSaved.size() + mChunksWaitingForRetry.size() ||
+           mPendingFiles.size() > mFilesBeingWritten.size() + mFilesWaitingForRetry.size();
+}
+
+std::size_t ChunkSaveQueue::numberOfFailedSaves() const
+{
+    return mChunksWaitingForRetry.size() + mFilesWaitingForRetry.size();
+}
+
+std::optional<std::chrono::steady_clock::time_point> ChunkSaveQueue::releaseDueRetries()
+{
+    const auto now = std::chrono::steady_clock::now();
+    std::optional<std::chrono::steady_clock::time_point> nextRetryTime;
+    const auto isDue = [&now, &nextRetryTime](const auto& saveWaitingForRetry)
+    {
+        const auto retryTime = saveWaitingForRetry.second;
+        if (retryTime > now)
+        {
+            nextRetryTime = std::min(nextRetryTime.value_or(retryTime), retryTime);
+            return false;
+        }
+        return true;
+    };
+    std::erase_if(mChunksWaitingForRetry, isDue);
+    std::erase_if(mFilesWaitingForRetry, isDue);
+    return nextRetryTime;
+}
+
+std::chrono::milliseconds ChunkSaveQueue::retryDelay(int failedWrites)
+{
+    const auto doublings = std::clamp(failedWrites - 1, 0, 16);
+    return std::min(FIRST_RETRY_DELAY * (1 << doublings), MAX_RETRY_DELAY);
+}
+
+bool ChunkSaveQueue::saveWaitingChunk(std::unique_lock<std::mutex>& lock)
+{
+    // Another thread writing the same chunk would race with this one, so such chunks wait
+    const auto pendingSaveToWrite = std::find_if(
+        mPendingSaves.begin(), mPendingSaves.end(),
+        [this](const auto& pendingSave)
+        {
+            return !mChunksBeingSaved.contains(pendingSave.first) &&
+                   !mChunksWaitingForRetry.contains(pendingSave.first);
+        });
+    if (pendingSaveToWrite == mPendingSaves.end())
+    {
+        return false;
+    }
+
+    // The snapshot stays in the queue while it is written, so it can still be read from there
+    const auto chunkCoordinate = pendingSaveToWrite->first;
+    const auto snapshot = pendingSaveToWrite->second.snapshot;
+    const auto sequenceNumber = pendingSaveToWrite->second.sequenceNumber;
+    const auto batch = pendingSaveToWrite->second.batch;
+    const auto shouldWaitForBandwidth = isBandwidthLimited(batch);
+    mChunksBeingSaved.insert(chunkCoordinate);
+    lock.unlock();
+
+    std::exception_ptr savingError;
+    std::size_t writtenBytes = 0;
+    try
+    {
+        writtenBytes = writeSnapshot(chunkCoordinate, *snapshot, shouldWaitForBandwidth);
+    }
+    catch (const std::exception& exception)
+    {
+        std::cout << "[ChunkSaveQueue] Unable to save the chunk " << chunkCoordinate.x << " "
+                  << chunkCoordinate.y << " " << chunkCoordinate.z << ": " << exception.what()
+                  << std::endl;
+        savingError = std::current_exception();
+    }
+
+    lock.lock();
+    mChunksBeingSaved.erase(chunkCoordinate);
+    if (!savingError)
+    {
+        ++mStatistics.performedSaves;
+    }
+    recordWriteResult(savingError, writtenBytes, batch);
+
+    auto& pendingSave = mPendingSaves.at(chunkCoordinate);
+    const auto isSnapshotReplaced = pendingSave.sequenceNumber != sequenceNumber;
+    if (savingError)
+    {
+        // The chunk was already told it is saved, so the snapshot is kept to be written again.
+        // Its batch has got the error and does not wait for it anymore.
+        mChunksWaitingForRetry[chunkCoordinate] =
+            std::chrono::steady_clock::now() + retryDelay(++pendingSave.failedWrites);
+        if (!isSnapshotReplaced)
+        {
+            finishSaveOfBatch(batch);
+            pendingSave.batch = NO_SAVE_BATCH;
+        }
+        mSaveFinished.notify_all();
+    }
+    else if (!isSnapshotReplaced)
+    {
+        mPendingBlockEdits -= snapshot->size();
+        mPendingSaves.erase(chunkCoordinate);
+        finishSaveOfBatch(batch);
+        mSaveFinished.notify_all();
+    }
+    else
+    {
+        // A newer snapshot was handed over in the meantime and any thread may write it now
+        pendingSave.failedWrites = 0;
+        mSaveRequested.notify_one();
+    }
+    return true;
+}
+
+bool ChunkSaveQueue::saveWaitingFile(std::unique_lock<std::mutex>& lock)
+{
+    const auto pendingFileToWrite = std::find_if(
+        mPendingFiles.begin(), mPendingFiles.end(),
+        [this](const auto& pendingFile)
+        {
+            return !mFilesBeingWritten.contains(pendingFile.first) &&
+                   !mFilesWaitingForRetry.contains(pendingFile.first);
+        });
+    if (pendingFileToWrite == mPendingFiles.end())
+    {
+        return false;
+    }
+
+    const auto pathToFile = pendingFileToWrite->first;
+    const auto data = pendingFileToWrite->second.data;
+    const auto sequenceNumber = pendingFileToWrite->second.sequenceNumber;
+    const auto batch = pendingFileToWrite->second.batch;
+    const auto shouldWaitForBandwidth = isBandwidthLimited(batch);
+    mFilesBeingWritten.insert(pathToFile);
+    lock.unlock();
+
+    std::exception_ptr savingError;
+    try
+    {
+        writeFile(pathToFile, *data, shouldWaitForBandwidth);
+    }
+    catch (const std::exception& exception)
+    {
+        std::cout << "[ChunkSaveQueue] Unable to write the file " << pathToFile << ": "
+                  << exception.what() << std::endl;
+        savingError = std::current_exception();
+    }
+
+    lock.lock();
+    mFilesBeingWritten.erase(pathToFile);
+    recordWriteResult(savingError, data->size(), batch);
+
+    auto& pendingFile = mPendingFiles.at(pathToFile);
+    const auto isFileReplaced = pendingFile.sequenceNumber != sequenceNumber;
+    if (savingError)
+    {
+        mFilesWaitingForRetry[pathToFile] =
+            std::chrono::steady_clock::now() + retryDelay(++pendingFile.failedWrites);
+        if (!isFileReplaced)
+        {
+            finishSaveOfBatch(batch);
+            pendingFile.batch = NO_SAVE_BATCH;
+        }
+        mSaveFinished.notify_all();
+    }
+    else if (!isFileReplaced)
+    {
+        mPendingFiles.erase(pathToFile);
+        finishSaveOfBatch(batch);
+        mSaveFinished.notify_all();
+    }
+    else
+    {
+        pendingFile.failedWrites = 0;
+        mSaveRequested.notify_one();
+    }
+    return true;
+}
+
+void ChunkSaveQueue::recordWriteResult(const std::exception_ptr& savingError,
+                                       std::size_t writtenBytes, SaveBatch batch)
+{
+    // A batch which has already ended does not take the results of its replaced saves anymore
+    const auto foundBatch = mBatches.find(batch);
+    if (!savingError)
+    {
+        mStatistics.writtenBytes += writtenBytes;
+        if (foundBatch != mBatches.end())
+        {
+            foundBatch->second.writtenBytes += writtenBytes;
+        }
+    }
+    else if (foundBatch != mBatches.end() && !foundBatch->second.savingError)
+    {
+        foundBatch->second.savingError = savingError;
+    }
+}
+
+SaveBatch ChunkSaveQueue::addSaveToBatch(SaveBatch batch)
+{
+    const auto foundBatch = mBatches.find(batch);
+    if (foundBatch == mBatches.end())
+    {
+        return NO_SAVE_BATCH;
+    }
+    ++foundBatch->second.pendingSaves;
+    return batch;
+}
+
+void ChunkSaveQueue::finishSaveOfBatch(SaveBatch batch)
+{
+    if (const auto foundBatch = mBatches.find(batch); foundBatch != mBatches.end())
+    {
+        --foundBatch->second.pendingSaves;
+        mSaveFinished.notify_all();
+    }
+}
+
+bool ChunkSaveQueue::isBandwidthLimited(SaveBatch batch) const
+{
+    const auto foundBatch = mBatches.find(batch);
+    return foundBatch != mBatches.end() && foundBatch->second.isBandwidthLimited;
+}
+
+std::size_t ChunkSaveQueue::writeSnapshot(const ChunkContainer::Coordinate& chunkCoordinate,
+                                          const ChunkBlockEdits& snapshot, bool isBandwidthLimited)
+{
+    if (snapshot.empty())
+    {
+        mChunkStorage.writeChunk(chunkCoordinate, {});
+        return 0;
+    }
+
+    auto data = ChunkCodec::encode(snapshot.merged());
+    data.insert(data.begin(), static_cast<unsigned char>(SavedChunkFormat::EncodedBlockEdits));
+    if (isBandwidthLimited)
+    {
+        waitForBandwidth(data.size());
+    }
+    mChunkStorage.writeChunk(chunkCoordinate, data);
+    return data.size();
+}
+
+void ChunkSaveQueue::writeFile(const std::string& pathToFile,
+                               const std::vector<unsigned char>& data, bool isBandwidthLimited)
+{
+    if (isBandwidthLimited)
+    {
+        waitForBandwidth(data.size());
+    }
+
+    const auto pathWithoutFile = std::filesystem::path(pathToFile).parent_path();
+    if (!pathWithoutFile.empty())
+    {
+        std::filesystem::create_directories(pathWithoutFile);
+    }
+
+    // A crash while writing leaves the previous version of the file untouched
+    const auto temporaryPath = pathToFile + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(data.data()),
+                   static_cast<std::streamsize>(data.size()));
+        if (!file)
+        {
+            throw std::runtime_error("Unable to write the file: " + temporaryPath);
+        }
+    }
+    std::filesystem::rename(temporaryPath, pathToFile);
+}
+
+void ChunkSaveQueue::waitForBandwidth(std::size_t bytes)
+{
+    std::unique_lock lock(mBandwidthMutex);
+    if (mBandwidthLimit == 0)
+    {
+        return;
+    }
+
+    // Every write reserves its share of time after the writes reserved before it
+    const auto writeTime = std::max(mNextWriteTime, std::chrono::steady_clock::now());
+    const std::chrono::duration<double> writeDuration(static_cast<double>(bytes) /
+                                                      static_cast<double>(mBandwidthLimit));
+    mNextWriteTime =
+        writeTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(writeDuration);
+    mBandwidthLimitChanged.wait_until(lock, writeTime, [this] { return mBandwidthLimit == 0; });
+}
@@ -0,0 +1,372 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "World/Chunks/ChunkBlockEdits.h"
+#include "World/Chunks/ChunkContainer.h"
+#include "World/Chunks/SaveBatch.h"
+
+class ChunkStorage;
+
+/**
+ * @brief Saves chunks to the chunk storage, and other files of the saved world, on its own
+ * background threads.
+ *
+ * Chunks hand over a copy-on-write snapshot of their blocks which differ from the generated
+ * terrain, so handing over never waits for the disk, and the snapshot is encoded here without
+ * holding the lock of the chunk. If a chunk is handed over again before its previous snapshot has
+ * been written, only the newest snapshot is written. Until then the snapshot is the most recent
+ * state of the chunk, so chunks created in the meantime should be read from it.
+ *
+ * Different chunks are encoded and written by several threads at once, but snapshots of the same
+ * chunk are always written one after another.
+ *
+ * A snapshot or file which could not be written stays in the queue, so that it can still be read
+ * from there, and it is written again after a delay which grows with every failed write.
+ *
+ * Saves may be handed over in a batch, which is waited for and measured apart from the others. A
+ * save replaced by a newer one before it was written counts as finished for its batch. Writes of
+ * the batches begun as limited by bandwidth share a given number of bytes written per second, so
+ * that saving in the background does not compete with the game for the disk. Other saves, such as
+ * the ones of the chunks being unloaded, are written as soon as possible.
+ */
+class ChunkSaveQueue
+{
+public:
+    /**
+     * @brief Blocks of the chunk which differ from the generated terrain. An empty snapshot removes
+     * the chunk from the storage.
+     */
+    using Snapshot = std::shared_ptr<const ChunkBlockEdits>;
+
+    /**
+     * @brief Function told how many of the chunks and files waiting to be saved have already been
+     * written. The first argument is the number of written ones, the second is the number of all.
+     */
+    using ProgressCallback = std::function<void(std::size_t, std::size_t)>;
+
+    /**
+     * @brief Number of threads saving the chunks.
+     */
+    static constexpr int NUMBER_OF_SAVING_THREADS = 4;
+
+    /**
+     * @brief Time between consecutive calls of the progress callback while waiting for the saves.
+     */
+    static constexpr std::chrono::milliseconds PROGRESS_REPORT_INTERVAL{50};
+
+    /**
+     * @brief Number of blocks waiting to be saved, above which the queue is considered full.
+     */
+    static constexpr std::size_t MAX_PENDING_BLOCK_EDITS = 1 << 20;
+
+    /**
+     * @brief Delay after the first failed write of a snapshot or file. It doubles with every
+     * following failure up to MAX_RETRY_DELAY.
+     */
+    static constexpr std::chrono::milliseconds FIRST_RETRY_DELAY{500};
+    static constexpr std::chrono::milliseconds MAX_RETRY_DELAY{30000};
+
+    /**
+     * @brief Counts how many times chunks were saved, how many times saving was skipped because
+     * nothing changed since the chunk was last loaded or saved, and how many bytes of chunks and
+     * files were written.
+     */
+    struct Statistics
+    {
+        std::size_t performedSaves = 0;
+        std::size_t skippedSaves = 0;
+        std::uint64_t writtenBytes = 0;
+    };
+
+    /**
+     * @brief Creates the queue and starts its saving threads.
+     * @param chunkStorage Storage to which the chunks are saved.
+     */
+    explicit ChunkSaveQueue(ChunkStorage& chunkStorage);
+    ChunkSaveQueue(const ChunkSaveQueue&) = delete;
+    ChunkSaveQueue& operator=(const ChunkSaveQueue&) = delete;
+
+    /**
+     * @brief Saves everything which is still waiting and stops the saving threads. Snapshots and
+     * files which still could not be written are reported and dropped.
+     */
+    ~ChunkSaveQueue();
+
+    /**
+     * @brief Hands over the snapshot of the chunk to be saved in the background. Never waits for
+     * the disk. Snapshots handed over after the queue was closed are reported and dropped.
+     * @param chunkCoordinate Coordinates of the chunk.
+     * @param snapshot Blocks of the chunk which differ from the generated terrain.
+     * @param batch Batch to which the save belongs.
+     */
+    void push(const ChunkContainer::Coordinate& chunkCoordinate, Snapshot snapshot,
+              SaveBatch batch = NO_SAVE_BATCH);
+
+    /**
+     * @brief Hands over the data to be written to the file in the background. If the file is handed
+     * over again before the data has been written, only the newest data is written. Data handed
+     * over after the queue was closed is reported and dropped.
+     * @param pathToFile The file to which the data should be written. It is replaced only once all
+     * the data is written.
+     * @param data Data to be written.
+     * @param batch Batch to which the save belongs.
+     */
+    void pushFile(const std::string& pathToFile, std::vector<unsigned char> data,
+                  SaveBatch batch = NO_SAVE_BATCH);
+
+    /**
+     * @brief Counts a save which was skipped, as nothing changed since the chunk was last loaded or
+     * saved.
+     */
+    void countSkippedSave();
+
+    /**
+     * @brief Returns the snapshot of the chunk which has not been written yet.
+     * @param chunkCoordinate Coordinates of the chunk.
+     * @return Snapshot of the chunk, or nullptr if nothing is waiting to be saved for this chunk.
+     */
+    [[nodiscard]] Snapshot pendingSnapshot(const ChunkContainer::Coordinate& chunkCoordinate) const;
+
+    /**
+     * @brief Waits until every snapshot and file handed over so far is written. The ones whose
+     * writes failed before are tried again right away.
+     * @param onProgress Called on the waiting thread every PROGRESS_REPORT_INTERVAL with the number
+     * of chunks and files written so far and the number of those which were waiting when the flush
+     * started.
+     * @throw std::runtime_error If any snapshot or file could not be written during the flush. It
+     * stays in the queue and is written again later.
+     */
+    void flush(const ProgressCallback& onProgress = {});
+
+    /**
+     * @brief Begins a new batch of saves.
+     * @param isBandwidthLimited Whether the writes of the batch are limited by limitBandwidth().
+     * @return The batch, to be given to the saves handed over as its part.
+     */
+    SaveBatch beginBatch(bool isBandwidthLimited);
+
+    /**
+     * @brief Waits until every save of the batch is written or replaced by a newer one, and ends
+     * the batch. Saves handed over to the batch afterwards do not belong to any batch.
+     * @param batch The batch to wait for.
+     * @return Number of bytes written by the saves of the batch.
+     * @throw std::runtime_error If any save of the batch could not be written.
+     */
+    std::uint64_t waitForBatch(SaveBatch batch);
+
+    /**
+     * @brief Stops accepting new snapshots and files, and waits until the ones handed over so far
+     * are written. The world is saved for the last time, so the saving threads do not have to
+     * catch up with later changes.
+     * @param onProgress Called as by flush().
+     * @throw std::runtime_error If any snapshot or file could not be written.
+     */
+    void close(const ProgressCallback& onProgress = {});
+
+    /**
+     * @brief Limits how many bytes the saving threads write per second together for the batches
+     * limited by bandwidth. A write which would exceed the limit waits until enough time has passed
+     * since the previous writes.
+     * @param bytesPerSecond Maximum number of bytes written per second, or 0 for no limit.
+     */
+    void limitBandwidth(std::size_t bytesPerSecond);
+
+    /**
+     * @brief Checks whether so many blocks are waiting to be saved that no new chunks should be
+     * generated for now. Chunks can still be handed over, as that only frees memory.
+     * @return True if the queue is full, false otherwise.
+     */
+    [[nodiscard]] bool isFull() const;
+
+    /**
+     * @brief Returns how many saves were performed and how many were skipped so far.
+     * @return Statistics of the saves.
+     */
+    [[nodiscard]] Statistics statistics() const;
+
+private:
+    /**
+     * @brief A snapshot waiting to be written. The sequence number tells whether the snapshot was
+     * replaced by a newer one while it was being written.
+     */
+    struct PendingSave
+    {
+        Snapshot snapshot;
+        std::uint64_t sequenceNumber;
+        SaveBatch batch;
+        int failedWrites = 0;
+    };
+
+    /**
+     * @brief Data of the file waiting to be written, replaced in the same way as the snapshots.
+     */
+    struct PendingFile
+    {
+        std::shared_ptr<const std::vector<unsigned char>> data;
+        std::uint64_t sequenceNumber;
+        SaveBatch batch;
+        int failedWrites = 0;
+    };
+
+    /**
+     * @brief Saves of the batch which are still waiting, and the results of the written ones.
+     */
+    struct Batch
+    {
+        std::size_t pendingSaves = 0;
+        std::uint64_t writtenBytes = 0;
+        std::exception_ptr savingError;
+        bool isBandwidthLimited = false;
+    };
+
+    /**
+     * @brief Loop of the saving threads. Writes snapshots and files until the queue is destroyed.
+     */
+    void processSaves();
+
+    /**
+     * @brief Checks whether any snapshot or file is waiting which no thread is writing right now,
+     * and which is not waiting to be written again after a failed write.
+     * @warning Must be called with the pending saves mutex locked.
+     * @return True if there is something a saving thread could write, false otherwise.
+     */
+    [[nodiscard]] bool isAnySaveWaiting() const;
+
+    /**
+     * @brief Returns the number of snapshots and files waiting to be written again after a failed
+     * write.
+     * @warning Must be called with the pending saves mutex locked.
+     * @return Number of snapshots and files whose last write failed.
+     */
+    [[nodiscard]] std::size_t numberOfFailedSaves() const;
+
+    /**
+     * @brief Lets the saving threads write again the snapshots and files whose delay after a failed
+     * write has passed.
+     * @warning Must be called with the pending saves mutex locked.
+     * @return Time at which the next of the remaining ones should be written again, or nothing if
+     * none remains.
+     */
+    std::optional<std::chrono::steady_clock::time_point> releaseDueRetries();
+
+    /**
+     * @brief Returns the delay before a snapshot or file is written again.
+     * @param failedWrites Number of its writes which failed one after another.
+     * @return Delay before the next write.
+     */
+    static std::chrono::milliseconds retryDelay(int failedWrites);
+
+    /**
+     * @brief Writes the snapshot of a chunk which no other thread is writing, if there is one.
+     * @param lock Lock of the pending saves mutex, released while the snapshot is written.
+     * @return True if a snapshot was written, false if there was none to write.
+     */
+    bool saveWaitingChunk(std::unique_lock<std::mutex>& lock);
+
+    /**
+     * @brief Writes the file which no other thread is writing, if there is one.
+     * @param lock Lock of the pending saves mutex, released while the file is written.
+     * @return True if a file was written, false if there was none to write.
+     */
+    bool saveWaitingFile(std::unique_lock<std::mutex>& lock);
+
+    /**
+     * @brief Adds the result of the write to the statistics and to the batch of the write, so that
+     * its error is thrown by waiting for the batch.
+     * @warning Must be called with the pending saves mutex locked.
+     * @param savingError The error that occurred, or nullptr if the write succeeded.
+     * @param writtenBytes Number of bytes written if the write succeeded.
+     * @param batch Batch of the write.
+     */
+    void recordWriteResult(const std::exception_ptr& savingError, std::size_t writtenBytes,
+                           SaveBatch batch);
+
+    /**
+     * @brief Counts a new save of the batch.
+     * @warning Must be called with the pending saves mutex locked.
+     * @param batch The batch given with the save.
+     * @return The batch, or NO_SAVE_BATCH if it has already ended or it has never begun.
+     */
+    SaveBatch addSaveToBatch(SaveBatch batch);
+
+    /**
+     * @brief Counts a save of the batch which is written or replaced by a newer one.
+     * @warning Must be called with the pending saves mutex locked.
+     * @param batch Batch of the save.
+     */
+    void finishSaveOfBatch(SaveBatch batch);
+
+    /**
+     * @brief Checks whether the writes of the batch are limited by bandwidth.
+     * @warning Must be called with the pending saves mutex locked.
+     * @param batch Batch of the write.
+     * @return True if the writes should wait for the bandwidth, false otherwise.
+     */
+    [[nodiscard]] bool isBandwidthLimited(SaveBatch batch) const;
+
+    /**
+     * @brief Encodes the snapshot and writes it to the chunk storage.
+     * @param chunkCoordinate Coordinates of the chunk.
+     * @param snapshot Blocks of the chunk which differ from the generated terrain.
+     * @param isBandwidthLimited Whether the write waits for the bandwidth.
+     * @return Number of written bytes.
+     */
+    std::size_t writeSnapshot(const ChunkContainer::Coordinate& chunkCoordinate,
+                              const ChunkBlockEdits& snapshot, bool isBandwidthLimited);
+
+    /**
+     * @brief Writes the data to a temporary file and replaces the file with it.
+     * @param pathToFile The file to which the data should be written.
+     * @param data Data to be written.
+     * @param isBandwidthLimited Whether the write waits for the bandwidth.
+     */
+    void writeFile(const std::string& pathToFile, const std::vector<unsigned char>& data,
+                   bool isBandwidthLimited);
+
+    /**
+     * @brief Waits until writing the given number of bytes does not exceed the bandwidth limit.
+     * @param bytes Number of bytes that are going to be written.
+     */
+    void waitForBandwidth(std::size_t bytes);
+
+private:
+    ChunkStorage& mChunkStorage;
+
+    mutable std::mutex mPendingSavesMutex;
+    std::condition_variable mSaveRequested;
+    std::condition_variable mSaveFinished;
+    std::unordered_map<ChunkContainer::Coordinate, PendingSave, std::hash<CoordinateBase>>
+        mPendingSaves;
+    std::unordered_set<ChunkContainer::Coordinate, std::hash<CoordinateBase>> mChunksBeingSaved;
+    std::unordered_map<std::string, PendingFile> mPendingFiles;
+    std::unordered_set<std::string> mFilesBeingWritten;
+    std::unordered_map<ChunkContainer::Coordinate, std::chrono::steady_clock::time_point,
+                       std::hash<CoordinateBase>>
+        mChunksWaitingForRetry;
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> mFilesWaitingForRetry;
+    std::size_t mPendingBlockEdits = 0;
+    std::uint64_t mNextSequenceNumber = 0;
+    std::unordered_map<SaveBatch, Batch> mBatches;
+    SaveBatch mLastBatch = NO_SAVE_BATCH;
+    Statistics mStatistics;
+    bool mIsClosed = false;
+    bool mShouldStop = false;
+
+    std::mutex mBandwidthMutex;
+    std::condition_variable mBandwidthLimitChanged;
+    std::size_t mBandwidthLimit = 0;
+    std::chrono::steady_clock::time_point mNextWriteTime;
+
+    std::vector<std::thread> mSavingThreads;
+};
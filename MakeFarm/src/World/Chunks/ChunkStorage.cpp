@@ -0,0 +1,270 @@
+#include "ChunkStorage.h"
+#include "pch.h"
+
+#include <charconv>
+#include <filesystem>
+#include <regex>
+
+namespace
+{
+
+int floorDivision(int dividend, int divisor)
+{
+    const auto quotient = dividend / divisor;
+    return (dividend % divisor != 0 && (dividend < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+}
+
+/**
+ * @brief Reads the coordinates written in the name of a chunk or region file.
+ * @param match The file name matched against a pattern whose first three groups are the numbers.
+ * @return Coordinates, or nothing if any of the numbers does not fit into int.
+ */
+std::optional<ChunkContainer::Coordinate> coordinateFromFileName(const std::smatch& match)
+{
+    std::array<int, 3> coordinates{};
+    for (auto i = 0; i < 3; ++i)
+    {
+        const auto number = match[i + 1].str();
+        const auto* numberEnd = number.data() + number.size();
+        const auto [parsedEnd, error] = std::from_chars(number.data(), numberEnd, coordinates[i]);
+        if (error != std::errc() || parsedEnd != numberEnd)
+        {
+            return std::nullopt;
+        }
+    }
+    return ChunkContainer::Coordinate(coordinates[0], coordinates[1], coordinates[2]);
+}
+
+}// namespace
+
+ChunkStorage::ChunkStorage(std::string savedWorldPath)
+    : mSavedWorldPath(std::move(savedWorldPath))
+{
+    openRegionFiles();
+    convertChunkFilesToRegionFiles();
+}
+
+bool ChunkStorage::doesChunkExist(const ChunkContainer::Coordinate& chunkCoordinate)
+{
+    std::scoped_lock guard(mRegionFilesAccessMutex);
+    return mSavedChunks.contains(chunkCoordinate);
+}
+
+std::optional<std::vector<unsigned char>> ChunkStorage::readChunk(
+    const ChunkContainer::Coordinate& chunkCoordinate)
+{
+    std::vector<unsigned char> data;
+    if (!readChunk(chunkCoordinate, data))
+    {
+        return std::nullopt;
+    }
+    return data;
+}
+
+bool ChunkStorage::readChunk(const ChunkContainer::Coordinate& chunkCoordinate,
+                             std::vector<unsigned char>& buffer)
+{
+    RegionFile* regionFile;
+    {
+        std::scoped_lock guard(mRegionFilesAccessMutex);
+        if (!mSavedChunks.contains(chunkCoordinate))
+        {
+            return false;
+        }
+        regionFile = regionFileOfChunk(chunkCoordinate, false);
+    }
+
+    // Region files are never closed before the storage, so the file is read without blocking the
+    // other regions
+    const auto localCoordinate = chunkToLocalRegionMetric(chunkCoordinate);
+    return regionFile->readChunk(localCoordinate.x, localCoordinate.z, buffer);
+}
+
+void ChunkStorage::writeChunk(const ChunkContainer::Coordinate& chunkCoordinate,
+                              const std::vector<unsigned char>& data)
+{
+    RegionFile* regionFile;
+    {
+        std::scoped_lock guard(mRegionFilesAccessMutex);
+        regionFile = regionFileOfChunk(chunkCoordinate, true);
+    }
+
+    const auto localCoordinate = chunkToLocalRegionMetric(chunkCoordinate);
+    regionFile->writeChunk(localCoordinate.x, localCoordinate.z, data);
+
+    std::scoped_lock guard(mRegionFilesAccessMutex);
+    if (data.empty())
+    {
+        mSavedChunks.erase(chunkCoordinate);
+    }
+    else
+    {
+        mSavedChunks.insert(chunkCoordinate);
+    }
+    ++mSaveGenerations[chunkCoordinate];
+}
+
+std::uint64_t ChunkStorage::saveGeneration(const ChunkContainer::Coordinate& chunkCoordinate)
+{
+    std::scoped_lock guard(mRegionFilesAccessMutex);
+    const auto saveGeneration = mSaveGenerations.find(chunkCoordinate);
+    return saveGeneration != mSaveGenerations.end() ? saveGeneration->second : 0;
+}
+
+void ChunkStorage::synchronize()
+{
+    std::scoped_lock guard(mRegionFilesAccessMutex);
+    for (auto& [regionCoordinate, regionFile]: mRegionFiles)
+    {
+        regionFile->synchronize();
+    }
+}
+
+RegionFile* ChunkStorage::regionFileOfChunk(const ChunkContainer::Coordinate& chunkCoordinate,
+                                            bool shouldBeCreated)
+{
+    // Every existing region file was opened together with the storage
+    const auto regionCoordinate = chunkToRegionMetric(chunkCoordinate);
+    auto foundRegionFile = mRegionFiles.find(regionCoordinate);
+    if (foundRegionFile == mRegionFiles.end())
+    {
+        if (!shouldBeCreated)
+        {
+            return nullptr;
+        }
+        foundRegionFile =
+            mRegionFiles
+                .emplace(regionCoordinate,
+                         std::make_unique<RegionFile>(regionFilePath(regionCoordinate)))
+                .first;
+    }
+    return foundRegionFile->second.get();
+}
+
+void ChunkStorage::openRegionFiles()
+{
+    std::error_code errorCode;
+    if (!std::filesystem::is_directory(mSavedWorldPath, errorCode))
+    {
+        return;
+    }
+
+    const std::regex regionFileName(R"(region_(-?\d+)_(-?\d+)_(-?\d+)\.bin)");
+    for (const auto& entry: std::filesystem::directory_iterator(mSavedWorldPath, errorCode))
+    {
+        std::smatch match;
+        const auto fileName = entry.path().filename().string();
+        if (!entry.is_regular_file() || !std::regex_match(fileName, match, regionFileName))
+        {
+            continue;
+        }
+
+        const auto parsedRegionCoordinate = coordinateFromFileName(match);
+        if (!parsedRegionCoordinate)
+        {
+            continue;
+        }
+
+        const auto& regionCoordinate = *parsedRegionCoordinate;
+        std::unique_ptr<RegionFile> regionFile;
+        try
+        {
+            regionFile = std::make_unique<RegionFile>(regionFilePath(regionCoordinate));
+        }
+        catch (const std::exception& exception)
+        {
+            // The chunks of the region are generated again and the region is saved to a new file
+            std::cout << "[ChunkStorage] Moving aside damaged region file: " << exception.what()
+                      << std::endl;
+            std::filesystem::rename(entry.path(), entry.path().string() + ".damaged", errorCode);
+            continue;
+        }
+
+        for (auto x = 0; x < RegionFile::CHUNKS_PER_REGION_DIMENSION; ++x)
+        {
+            for (auto z = 0; z < RegionFile::CHUNKS_PER_REGION_DIMENSION; ++z)
+            {
+                if (regionFile->doesChunkExist(x, z))
+                {
+                    mSavedChunks.emplace(
+                        regionCoordinate.x * RegionFile::CHUNKS_PER_REGION_DIMENSION + x,
+                        regionCoordinate.y,
+                        regionCoordinate.z * RegionFile::CHUNKS_PER_REGION_DIMENSION + z);
+                }
+            }
+        }
+        mRegionFiles.emplace(regionCoordinate, std::move(regionFile));
+    }
+}
+
+ChunkContainer::Coordinate ChunkStorage::chunkToRegionMetric(
+    const ChunkContainer::Coordinate& chunkCoordinate)
+{
+    return {floorDivision(chunkCoordinate.x, RegionFile::CHUNKS_PER_REGION_DIMENSION),
+            chunkCoordinate.y,
+            floorDivision(chunkCoordinate.z, RegionFile::CHUNKS_PER_REGION_DIMENSION)};
+}
+
+ChunkContainer::Coordinate ChunkStorage::chunkToLocalRegionMetric(
+    const ChunkContainer::Coordinate& chunkCoordinate)
+{
+    const auto regionCoordinate = chunkToRegionMetric(chunkCoordinate);
+    return {chunkCoordinate.x - regionCoordinate.x * RegionFile::CHUNKS_PER_REGION_DIMENSION, 0,
+            chunkCoordinate.z - regionCoordinate.z * RegionFile::CHUNKS_PER_REGION_DIMENSION};
+}
+
+std::string ChunkStorage::regionFilePath(const ChunkContainer::Coordinate& regionCoordinate) const
+{
+    return mSavedWorldPath + "/region_" + std::to_string(regionCoordinate.x) + "_" +
+           std::to_string(regionCoordinate.y) + "_" + std::to_string(regionCoordinate.z) + ".bin";
+}
+
+void ChunkStorage::convertChunkFilesToRegionFiles()
+{
+    std::error_code errorCode;
+    if (!std::filesystem::is_directory(mSavedWorldPath, errorCode))
+    {
+        return;
+    }
+
+    struct ChunkFile
+    {
+        std::filesystem::path path;
+        ChunkContainer::Coordinate chunkCoordinate;
+    };
+
+    std::vector<ChunkFile> chunkFiles;
+    const std::regex chunkFileName(R"(chunk_(-?\d+)_(-?\d+)_(-?\d+)\.bin)");
+    for (const auto& entry: std::filesystem::directory_iterator(mSavedWorldPath, errorCode))
+    {
+        std::smatch match;
+        const auto fileName = entry.path().filename().string();
+        if (!entry.is_regular_file() || !std::regex_match(fileName, match, chunkFileName))
+        {
+            continue;
+        }
+
+        if (const auto chunkCoordinate = coordinateFromFileName(match))
+        {
+            chunkFiles.push_back({entry.path(), *chunkCoordinate});
+        }
+    }
+
+    for (const auto& chunkFile: chunkFiles)
+    {
+        std::ifstream file(chunkFile.path, std::ios::binary);
+        if (!file.is_open())
+        {
+            continue;
+        }
+
+        // These files always held every block of the chunk
+        std::vector<unsigned char> data = {static_cast<unsigned char>(SavedChunkFormat::AllBlocks)};
+        data.insert(data.end(), std::istreambuf_iterator<char>(file),
+                    std::istreambuf_iterator<char>());
+        file.close();
+
+        writeChunk(chunkFile.chunkCoordinate, data);
+        std::filesystem::remove(chunkFile.path, errorCode);
+    }
+}
@@ -0,0 +1,160 @@
+#pragma once
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "World/Chunks/ChunkContainer.h"
+#include "World/Chunks/RegionFile.h"
+
+/**
+ * @brief Describes what kind of data the chunk has saved. It is stored as the first byte of the
+ * saved data, followed by the serialized data itself.
+ */
+enum class SavedChunkFormat : std::uint8_t
+{
+    /** Only blocks that differ from the generated terrain, as a serialized list */
+    BlockEdits = 0,
+
+    /** Every block of the chunk, as saved by older versions of the game */
+    AllBlocks = 1,
+
+    /** Only blocks that differ from the generated terrain, encoded by the ChunkCodec */
+    EncodedBlockEdits = 2
+};
+
+/**
+ * @brief Place where the chunks of the world are saved and read from.
+ *
+ * Chunks are grouped into region files, each holding a square of chunks lying next to each other.
+ * All region files are opened together with the storage and kept open until it is destroyed. Their
+ * headers tell which chunks have been saved, so asking about any chunk never touches the disk. It
+ * is safe to use the storage from many threads at once. The storage is locked only to find the
+ * region file, so chunks of different regions are read and written at the same time.
+ */
+class ChunkStorage
+{
+public:
+    /**
+     * @brief Opens the storage of the world and every region file in it. Chunks saved by older
+     * versions of the game, each to its own file, are moved to region files.
+     * @param savedWorldPath Path to the directory of the saved world.
+     */
+    explicit ChunkStorage(std::string savedWorldPath);
+
+    /**
+     * @brief Checks if the chunk has been saved. It does not touch the disk.
+     * @param chunkCoordinate Coordinates of the chunk.
+     * @return True if the chunk has been saved, false otherwise.
+     */
+    bool doesChunkExist(const ChunkContainer::Coordinate& chunkCoordinate);
+
+    /**
+     * @brief Reads the saved data of the chunk.
+     * @param chunkCoordinate Coordinates of the chunk.
+     * @return Saved data of the chunk, or nothing if the chunk has not been saved.
+     */
+    std::optional<std::vector<unsigned char>> readChunk(
+        const ChunkContainer::Coordinate& chunkCoordinate);
+
+    /**
+     * @brief Reads the saved data of the chunk into the buffer, reusing its memory.
+     * @param chunkCoordinate Coordinates of the chunk.
+     * @param buffer Buffer which holds exactly the saved data of the chunk after a successful read.
+     * @return True if the data was read, false if the chunk has not been saved.
+     */
+    bool readChunk(const ChunkContainer::Coordinate& chunkCoordinate,
+                   std::vector<unsigned char>& buffer);
+
+    /**
+     * @brief Saves the data of the chunk, replacing the data saved before.
+     * @param chunkCoordinate Coordinates of the chunk.
+     * @param data Data of the chunk to save.
+     */
+    void writeChunk(const ChunkContainer::Coordinate& chunkCoordinate,
+                    const std::vector<unsigned char>& data);
+
+    /**
+     * @brief Tells how many times the chunk has been saved since the storage was opened. Data read
+     * before the number has changed may be outdated.
+     * @param chunkCoordinate Coordinates of the chunk.
+     * @return Number of finished saves of the chunk.
+     */
+    std::uint64_t saveGeneration(const ChunkContainer::Coordinate& chunkCoordinate);
+
+    /**
+     * @brief Waits until every saved chunk is stored on the disk, so that it survives a crash of
+     * the system.
+     */
+    void synchronize();
+
+private:
+    /**
+     * @brief Returns the region file which stores the given chunk.
+     * @param chunkCoordinate Coordinates of the chunk.
+     * @param shouldBeCreated Whether the region file should be created if it does not exist.
+     * @return The region file, or nullptr if it does not exist and it should not be created.
+     */
+    RegionFile* regionFileOfChunk(const ChunkContainer::Coordinate& chunkCoordinate,
+                                  bool shouldBeCreated);
+
+    /**
+     * @brief Opens every region file of the world and remembers which chunks they store. Region
+     * files that cannot be opened are reported and moved aside, so their chunks are generated
+     * again.
+     */
+    void openRegionFiles();
+
+    /**
+     * @brief Converts the chunk coordinates to the coordinates of the region it belongs to.
+     * @param chunkCoordinate Coordinates of the chunk.
+     * @return Coordinates of the region.
+     */
+    static ChunkContainer::Coordinate chunkToRegionMetric(
+        const ChunkContainer::Coordinate& chunkCoordinate);
+
+    /**
+     * @brief Converts the chunk coordinates to its coordinates inside the region.
+     * @param chunkCoordinate Coordinates of the chunk.
+     * @return Coordinates of the chunk inside the region. Y is always zero.
+     */
+    static ChunkContainer::Coordinate chunkToLocalRegionMetric(
+        const ChunkContainer::Coordinate& chunkCoordinate);
+
+    /**
+     * @brief Path to the region file.
+     * @param regionCoordinate Coordinates of the region.
+     * @return Character string representing the region's path to the file
+     */
+    std::string regionFilePath(const ChunkContainer::Coordinate& regionCoordinate) const;
+
+    /**
+     * @brief Moves chunks which were saved by older versions of the game, each to its own file,
+     * into region files. A file is removed only after its chunk has been saved to the region.
+     */
+    void convertChunkFilesToRegionFiles();
+
+private:
+    std::string mSavedWorldPath;
+    /**
+     * Guards the region files and saved chunks collections, but not the files themselves.
+     */
+    std::mutex mRegionFilesAccessMutex;
+    std::unordered_map<ChunkContainer::Coordinate, std::unique_ptr<RegionFile>,
+                       std::hash<CoordinateBase>>
+        mRegionFiles;
+
+    /**
+     * Coordinates of every chunk stored by the region files.
+     */
+    std::unordered_set<ChunkContainer::Coordinate, std::hash<CoordinateBase>> mSavedChunks;
+
+    /**
+     * Number of finished saves of every chunk saved since the storage was opened.
+     */
+    std::unordered_map<ChunkContainer::Coordinate, std::uint64_t, std::hash<CoordinateBase>>
+        mSaveGenerations;
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+/**
+ * @brief Determines what placed a block, which decides whether it is saved as a change of the chunk
+ */
+enum class PlacementOrigin
+{
+    /**
+     * Placed by a change of the world, such as the player placing a block. It is saved and
+     * journaled.
+     */
+    Edit,
+
+    /**
+     * Placed by the generation of the chunk itself. It is generated again whenever the chunk is
+     * loaded, so it is not saved.
+     */
+    Generation,
+
+    /**
+     * Placed by the generation of a neighbouring chunk, for example leaves of a tree growing next
+     * to the chunk. The neighbour may stay loaded while this chunk is reloaded, so it is saved as
+     * a change of this chunk. It is not journaled, as after a crash the neighbour is generated
+     * again and places it anew.
+     */
+    NeighbourGeneration
+};
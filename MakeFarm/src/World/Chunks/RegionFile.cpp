@@ -0,0 +1,321 @@
+#include "RegionFile.h"
+#include "pch.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+
+#if REGION_FILE_USES_PREAD
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace
+{
+
+void writeUint32(unsigned char* destination, std::uint32_t value)
+{
+    // Always little-endian, so the saved world can be moved between machines
+    for (auto byte = 0; byte < 4; ++byte)
+    {
+        destination[byte] = static_cast<unsigned char>(value >> (8 * byte));
+    }
+}
+
+std::uint32_t readUint32(const unsigned char* source)
+{
+    std::uint32_t value = 0;
+    for (auto byte = 0; byte < 4; ++byte)
+    {
+        value |= static_cast<std::uint32_t>(source[byte]) << (8 * byte);
+    }
+    return value;
+}
+
+}// namespace
+
+RegionFile::RegionFile(std::string pathToFile)
+    : mPathToFile(std::move(pathToFile))
+{
+    if (!std::filesystem::exists(mPathToFile))
+    {
+        createEmptyFile();
+    }
+
+    mFile.open(mPathToFile, std::ios::in | std::ios::out | std::ios::binary);
+    if (!mFile.is_open())
+    {
+        throw std::runtime_error("Unable to open the region file: " + mPathToFile);
+    }
+    readHeader();
+
+#if REGION_FILE_USES_PREAD
+    mFileDescriptor = ::open(mPathToFile.c_str(), O_RDWR);
+    if (mFileDescriptor < 0)
+    {
+        throw std::runtime_error("Unable to open the region file: " + mPathToFile);
+    }
+#endif
+}
+
+RegionFile::~RegionFile()
+{
+#if REGION_FILE_USES_PREAD
+    ::close(mFileDescriptor);
+#endif
+}
+
+bool RegionFile::doesChunkExist(int localChunkX, int localChunkZ) const
+{
+    std::shared_lock guard(mFileAccessMutex);
+    return mChunkLocations[chunkIndex(localChunkX, localChunkZ)].sizeInBytes > 0;
+}
+
+std::optional<std::vector<unsigned char>> RegionFile::readChunk(int localChunkX, int localChunkZ)
+{
+    std::vector<unsigned char> data;
+    if (!readChunk(localChunkX, localChunkZ, data))
+    {
+        return std::nullopt;
+    }
+    return data;
+}
+
+bool RegionFile::readChunk(int localChunkX, int localChunkZ, std::vector<unsigned char>& buffer)
+{
+#if REGION_FILE_USES_PREAD
+    std::shared_lock guard(mFileAccessMutex);
+#else
+    // Reading moves the position of the only stream
+    std::unique_lock guard(mFileAccessMutex);
+#endif
+    const auto& location = mChunkLocations[chunkIndex(localChunkX, localChunkZ)];
+    if (location.sizeInBytes == 0)
+    {
+        return false;
+    }
+
+    buffer.resize(location.sizeInBytes);
+    return readBytes(static_cast<std::uint64_t>(location.firstSector) * SECTOR_SIZE, buffer.data(),
+                     buffer.size());
+}
+
+void RegionFile::writeChunk(int localChunkX, int localChunkZ,
+                            const std::vector<unsigned char>& data)
+{
+    std::unique_lock guard(mFileAccessMutex);
+    const auto index = chunkIndex(localChunkX, localChunkZ);
+    const auto previousLocation = mChunkLocations[index];
+
+    ChunkLocation newLocation;
+    if (!data.empty())
+    {
+        const auto sizeInBytes = static_cast<std::uint32_t>(data.size());
+        const auto numberOfSectors = sectorsNeededFor(sizeInBytes);
+
+        // The previous sectors are still marked as used, so the new data never overwrites them
+        newLocation = {allocateSectors(numberOfSectors), sizeInBytes};
+
+        std::vector<unsigned char> paddedData(numberOfSectors * SECTOR_SIZE, 0);
+        std::copy(data.begin(), data.end(), paddedData.begin());
+        mFile.seekp(static_cast<std::streamoff>(newLocation.firstSector) * SECTOR_SIZE);
+        mFile.write(reinterpret_cast<const char*>(paddedData.data()),
+                    static_cast<std::streamsize>(paddedData.size()));
+        mFile.flush();
+    }
+
+    mChunkLocations[index] = newLocation;
+    writeHeaderEntry(index);
+    mFile.flush();
+    if (!mFile)
+    {
+        mFile.clear();
+        throw std::runtime_error("Unable to save the chunk to the region file: " + mPathToFile);
+    }
+
+    if (previousLocation.sizeInBytes > 0)
+    {
+        markSectors(previousLocation.firstSector, sectorsNeededFor(previousLocation.sizeInBytes),
+                    false);
+    }
+}
+
+void RegionFile::synchronize()
+{
+    std::unique_lock guard(mFileAccessMutex);
+    mFile.flush();
+#if REGION_FILE_USES_PREAD
+    if (::fsync(mFileDescriptor) != 0)
+    {
+        throw std::runtime_error("Unable to store the region file on the disk: " + mPathToFile);
+    }
+#endif
+}
+
+std::uint32_t RegionFile::numberOfSectors() const
+{
+    std::shared_lock guard(mFileAccessMutex);
+    return static_cast<std::uint32_t>(mUsedSectors.size());
+}
+
+void RegionFile::createEmptyFile() const
+{
+    const auto pathWithoutFile = std::filesystem::path(mPathToFile).parent_path();
+    if (!pathWithoutFile.empty())
+    {
+        std::filesystem::create_directories(pathWithoutFile);
+    }
+
+    std::vector<unsigned char> header(HEADER_SECTORS * SECTOR_SIZE, 0);
+    std::copy(MAGIC_NUMBER.begin(), MAGIC_NUMBER.end(), header.begin());
+    writeUint32(header.data() + sizeof(MAGIC_NUMBER), FORMAT_VERSION);
+
+    std::ofstream file(mPathToFile, std::ios::out | std::ios::binary);
+    file.write(reinterpret_cast<const char*>(header.data()),
+               static_cast<std::streamsize>(header.size()));
+}
+
+void RegionFile::readHeader()
+{
+    std::vector<unsigned char> header(HEADER_SIZE);
+    mFile.seekg(0);
+    mFile.read(reinterpret_cast<char*>(header.data()), static_cast<std::streamsize>(HEADER_SIZE));
+    if (!mFile || !std::equal(MAGIC_NUMBER.begin(), MAGIC_NUMBER.end(), header.begin()))
+    {
+        throw std::runtime_error("The file is not a valid region file: " + mPathToFile);
+    }
+    if (readUint32(header.data() + sizeof(MAGIC_NUMBER)) != FORMAT_VERSION)
+    {
+        throw std::runtime_error("Unsupported version of the region file: " + mPathToFile);
+    }
+
+    mFile.seekg(0, std::ios::end);
+    const auto fileSize = static_cast<std::uint64_t>(mFile.tellg());
+    const auto sectorsInFile =
+        static_cast<std::uint32_t>((fileSize + SECTOR_SIZE - 1) / SECTOR_SIZE);
+
+    mUsedSectors.assign(std::max(sectorsInFile, HEADER_SECTORS), false);
+    markSectors(0, HEADER_SECTORS, true);
+
+    for (auto index = 0; index < CHUNKS_IN_REGION; ++index)
+    {
+        const auto* entry = header.data() + HEADER_ENTRIES_OFFSET + index * BYTES_PER_HEADER_ENTRY;
+        ChunkLocation location = {readUint32(entry), readUint32(entry + sizeof(std::uint32_t))};
+        if (location.sizeInBytes == 0)
+        {
+            continue;
+        }
+
+        const auto numberOfSectors = sectorsNeededFor(location.sizeInBytes);
+        const auto isLocationInsideFile =
+            location.firstSector >= HEADER_SECTORS &&
+            static_cast<std::uint64_t>(location.firstSector) + numberOfSectors <= sectorsInFile;
+        if (!isLocationInsideFile)
+        {
+            // A damaged entry is ignored, so the chunk is generated again instead
+            continue;
+        }
+
+        // Of two damaged entries claiming the same sectors only the first one is kept, otherwise
+        // freeing the sectors of one of them would let the other chunk be overwritten
+        const auto firstUsedSector = mUsedSectors.cbegin() + location.firstSector;
+        if (std::none_of(firstUsedSector, firstUsedSector + numberOfSectors,
+                         [](bool isUsed) { return isUsed; }))
+        {
+            mChunkLocations[index] = location;
+            markSectors(location.firstSector, numberOfSectors, true);
+        }
+    }
+}
+
+bool RegionFile::readBytes(std::uint64_t offset, unsigned char* destination, std::size_t size)
+{
+#if REGION_FILE_USES_PREAD
+    // Unlike the stream, it does not copy the bytes through its own buffer
+    while (size > 0)
+    {
+        const auto bytesRead =
+            ::pread(mFileDescriptor, destination, size, static_cast<off_t>(offset));
+        if (bytesRead <= 0)
+        {
+            return false;
+        }
+        offset += bytesRead;
+        destination += bytesRead;
+        size -= bytesRead;
+    }
+    return true;
+#else
+    mFile.seekg(static_cast<std::streamoff>(offset));
+    mFile.read(reinterpret_cast<char*>(destination), static_cast<std::streamsize>(size));
+    if (!mFile)
+    {
+        mFile.clear();
+        return false;
+    }
+    return true;
+#endif
+}
+
+void RegionFile::writeHeaderEntry(int chunkIndex)
+{
+    std::array<unsigned char, BYTES_PER_HEADER_ENTRY> entry{};
+    writeUint32(entry.data(), mChunkLocations[chunkIndex].firstSector);
+    writeUint32(entry.data() + sizeof(std::uint32_t), mChunkLocations[chunkIndex].sizeInBytes);
+
+    mFile.seekp(HEADER_ENTRIES_OFFSET + chunkIndex * BYTES_PER_HEADER_ENTRY);
+    mFile.write(reinterpret_cast<const char*>(entry.data()), entry.size());
+}
+
+std::uint32_t RegionFile::allocateSectors(std::uint32_t numberOfSectors)
+{
+    std::uint32_t freeSectorsStart = 0;
+    std::uint32_t freeSectorsLength = 0;
+    for (auto sector = HEADER_SECTORS; sector < mUsedSectors.size(); ++sector)
+    {
+        if (mUsedSectors[sector])
+        {
+            freeSectorsLength = 0;
+            continue;
+        }
+
+        if (freeSectorsLength == 0)
+        {
+            freeSectorsStart = sector;
+        }
+        if (++freeSectorsLength == numberOfSectors)
+        {
+            markSectors(freeSectorsStart, numberOfSectors, true);
+            return freeSectorsStart;
+        }
+    }
+
+    // There is no free space big enough, so the file grows. Free sectors at its end are reused.
+    const auto firstSector = (freeSectorsLength > 0)
+                                 ? freeSectorsStart
+                                 : static_cast<std::uint32_t>(mUsedSectors.size());
+    mUsedSectors.resize(firstSector + numberOfSectors, false);
+    markSectors(firstSector, numberOfSectors, true);
+    return firstSector;
+}
+
+void RegionFile::markSectors(std::uint32_t firstSector, std::uint32_t numberOfSectors,
+                             bool isUsed)
+{
+    std::fill_n(mUsedSectors.begin() + firstSector, numberOfSectors, isUsed);
+}
+
+int RegionFile::chunkIndex(int localChunkX, int localChunkZ)
+{
+    if (localChunkX < 0 || localChunkX >= CHUNKS_PER_REGION_DIMENSION || localChunkZ < 0 ||
+        localChunkZ >= CHUNKS_PER_REGION_DIMENSION)
+    {
+        throw std::out_of_range("The chunk does not belong to the region");
+    }
+    return localChunkX + CHUNKS_PER_REGION_DIMENSION * localChunkZ;
+}
+
+std::uint32_t RegionFile::sectorsNeededFor(std::uint32_t sizeInBytes)
+{
+    return (sizeInBytes + SECTOR_SIZE - 1) / SECTOR_SIZE;
+}
@@ -0,0 +1,189 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Chunks are read with a single positioned read where the system supports it. Otherwise they are
+ * read through the same stream that writes them. The descriptor used for reading also allows the
+ * file to be synchronized with the disk.
+ */
+#if defined(__unix__) || defined(__APPLE__)
+    #define REGION_FILE_USES_PREAD true
+#else
+    #define REGION_FILE_USES_PREAD false
+#endif
+
+/**
+ * @brief A single file that stores the saved data of a square of chunks lying next to each other.
+ *
+ * The file starts with a header holding the location of the data of every chunk of the region. The
+ * rest of the file is divided into sectors of equal size and the data of a chunk occupies
+ * consecutive sectors. When a chunk is saved again, its new data is first written to free sectors
+ * and only then the header starts to point at it, so an interrupted save never damages the data
+ * saved before. Sectors that are no longer used are remembered and reused by later saves.
+ *
+ * Chunks of the region can be read by many threads at once where positioned reads are supported.
+ * Writing a chunk waits until the reads in progress end.
+ */
+class RegionFile
+{
+public:
+    /**
+     * @brief Number of chunks stored by the region along the X and Z axis.
+     */
+    static constexpr int CHUNKS_PER_REGION_DIMENSION = 32;
+    static constexpr int CHUNKS_IN_REGION =
+        CHUNKS_PER_REGION_DIMENSION * CHUNKS_PER_REGION_DIMENSION;
+
+    /**
+     * @brief The smallest part of the file that can be assigned to a chunk, in bytes.
+     */
+    static constexpr std::uint32_t SECTOR_SIZE = 256;
+
+    /**
+     * @brief Opens the region file or creates an empty one if it does not exist yet.
+     * @param pathToFile Path to the region file.
+     */
+    explicit RegionFile(std::string pathToFile);
+    RegionFile(const RegionFile&) = delete;
+    RegionFile& operator=(const RegionFile&) = delete;
+    ~RegionFile();
+
+    /**
+     * @brief Checks if the region stores data of the given chunk.
+     * @param localChunkX X coordinate of the chunk inside the region, in range [0, 32).
+     * @param localChunkZ Z coordinate of the chunk inside the region, in range [0, 32).
+     * @return True if the data of the chunk is stored, false otherwise.
+     */
+    [[nodiscard]] bool doesChunkExist(int localChunkX, int localChunkZ) const;
+
+    /**
+     * @brief Reads the data of the given chunk.
+     * @param localChunkX X coordinate of the chunk inside the region, in range [0, 32).
+     * @param localChunkZ Z coordinate of the chunk inside the region, in range [0, 32).
+     * @return Data of the chunk, or nothing if it is not stored or could not be read.
+     */
+    std::optional<std::vector<unsigned char>> readChunk(int localChunkX, int localChunkZ);
+
+    /**
+     * @brief Reads the data of the given chunk into the buffer. The memory of the buffer is reused,
+     * so reading many chunks into the same buffer does not allocate for each of them.
+     * @param localChunkX X coordinate of the chunk inside the region, in range [0, 32).
+     * @param localChunkZ Z coordinate of the chunk inside the region, in range [0, 32).
+     * @param buffer Buffer which holds exactly the data of the chunk after a successful read.
+     * @return True if the data was read, false if it is not stored or could not be read.
+     */
+    bool readChunk(int localChunkX, int localChunkZ, std::vector<unsigned char>& buffer);
+
+    /**
+     * @brief Saves the data of the given chunk, replacing data saved before. Saving empty data
+     * removes the chunk from the region.
+     * @param localChunkX X coordinate of the chunk inside the region, in range [0, 32).
+     * @param localChunkZ Z coordinate of the chunk inside the region, in range [0, 32).
+     * @param data Data of the chunk.
+     */
+    void writeChunk(int localChunkX, int localChunkZ, const std::vector<unsigned char>& data);
+
+    /**
+     * @brief Waits until the saved chunks are stored on the disk, where the system allows it.
+     * Otherwise they are only handed over to the system.
+     */
+    void synchronize();
+
+    /**
+     * @brief Returns the number of sectors the file consists of, including the header.
+     * @return Number of sectors the file consists of.
+     */
+    [[nodiscard]] std::uint32_t numberOfSectors() const;
+
+private:
+    /**
+     * @brief Place in the file where the data of a chunk is stored.
+     */
+    struct ChunkLocation
+    {
+        std::uint32_t firstSector = 0;
+        std::uint32_t sizeInBytes = 0;
+    };
+
+    static constexpr std::array<char, 4> MAGIC_NUMBER = {'M', 'F', 'R', 'G'};
+    static constexpr std::uint32_t FORMAT_VERSION = 1;
+    static constexpr std::uint32_t BYTES_PER_HEADER_ENTRY = 2 * sizeof(std::uint32_t);
+    static constexpr std::uint32_t HEADER_ENTRIES_OFFSET =
+        sizeof(MAGIC_NUMBER) + sizeof(FORMAT_VERSION);
+    static constexpr std::uint32_t HEADER_SIZE =
+        HEADER_ENTRIES_OFFSET + CHUNKS_IN_REGION * BYTES_PER_HEADER_ENTRY;
+    static constexpr std::uint32_t HEADER_SECTORS = (HEADER_SIZE + SECTOR_SIZE - 1) / SECTOR_SIZE;
+
+    /**
+     * @brief Creates a region file which does not store any chunk.
+     */
+    void createEmptyFile() const;
+
+    /**
+     * @brief Reads the header of the file and marks the sectors occupied by chunks as used.
+     */
+    void readHeader();
+
+    /**
+     * @brief Reads bytes from the given place in the file.
+     * @param offset Position in the file, in bytes, from which the reading starts.
+     * @param destination Place to which the bytes are read.
+     * @param size Number of bytes to read.
+     * @return True if all bytes were read, false otherwise.
+     */
+    bool readBytes(std::uint64_t offset, unsigned char* destination, std::size_t size);
+
+    /**
+     * @brief Writes to the file the header entry of the chunk with the given index.
+     * @param chunkIndex Index of the chunk inside the region.
+     */
+    void writeHeaderEntry(int chunkIndex);
+
+    /**
+     * @brief Finds consecutive free sectors, or adds them at the end of the file, and marks them
+     * as used.
+     * @param numberOfSectors Number of sectors needed.
+     * @return Index of the first of the found sectors.
+     */
+    std::uint32_t allocateSectors(std::uint32_t numberOfSectors);
+
+    /**
+     * @brief Marks consecutive sectors as used or free.
+     * @param firstSector Index of the first sector.
+     * @param numberOfSectors Number of sectors to mark.
+     * @param isUsed True if sectors should be marked as used, false if as free.
+     */
+    void markSectors(std::uint32_t firstSector, std::uint32_t numberOfSectors, bool isUsed);
+
+    /**
+     * @brief Calculates the index of the chunk inside the region.
+     * @param localChunkX X coordinate of the chunk inside the region.
+     * @param localChunkZ Z coordinate of the chunk inside the region.
+     * @return Index of the chunk inside the region.
+     */
+    static int chunkIndex(int localChunkX, int localChunkZ);
+
+    /**
+     * @brief Calculates how many sectors are needed to store the given number of bytes.
+     * @param sizeInBytes Number of bytes to store.
+     * @return Number of sectors needed.
+     */
+    static std::uint32_t sectorsNeededFor(std::uint32_t sizeInBytes);
+
+private:
+    std::string mPathToFile;
+    mutable std::shared_mutex mFileAccessMutex;
+    std::fstream mFile;
+#if REGION_FILE_USES_PREAD
+    int mFileDescriptor = -1;
+#endif
+    std::array<ChunkLocation, CHUNKS_IN_REGION> mChunkLocations;
+    std::vector<bool> mUsedSectors;
+};
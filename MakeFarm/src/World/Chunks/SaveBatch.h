@@ -0,0 +1,13 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief Identifies saves handed over together, for example by a single autosave, which can be
+ * waited for and measured apart from the other saves.
+ */
+using SaveBatch = std::uint64_t;
+
+/**
+ * @brief Saves which do not belong to any batch, such as the ones of the chunks being unloaded.
+ */
+constexpr SaveBatch NO_SAVE_BATCH = 0;
@@ -32,28 +32,31 @@ void TerrainGenerator::generateTerrain(ChunkInterface& chunk,
 {
     auto allBiomesInChunkPerCoordinate = biomePerLocalCoordinate(chunk);
     auto biomesToPostProcess = allBiomesInChunkAndOneBlockAroundIt(allBiomesInChunkPerCoordinate);
+    DecorationsPerBiome decorationsPerBiome;
     if (doesChunkContainOnlyOneBiome(allBiomesInChunkPerCoordinate))
     {
         auto& biome = **biomesToPostProcess.begin();
-        generateTerrainForChunkWithGivenBiome(chunk, chunkBlocks, biome);
+        generateTerrainForChunkWithGivenBiome(chunk, chunkBlocks, biome,
+                                              decorationsPerBiome[&biome]);
     }
     else
     {
         auto cornerNoises = calculateNoiseAtChunkCorners(chunk, allBiomesInChunkPerCoordinate);
-        generateTerrainForChunkWithDifferentBiomes(chunkBlocks, allBiomesInChunkPerCoordinate,
-                                                   cornerNoises);
+        generateTerrainForChunkWithDifferentBiomes(chunk, chunkBlocks,
+                                                   allBiomesInChunkPerCoordinate, cornerNoises,
+                                                   decorationsPerBiome);
     }
     for (auto biome: biomesToPostProcess)
     {
-        biome->postGenerationPlacements(chunk);
+        biome->postGenerationPlacements(chunk, decorationsPerBiome[biome]);
     }
-    biomesToPostProcess.clear();
 }
 
 void TerrainGenerator::generateTerrainForChunkWithDifferentBiomes(
-    ChunkInterface::ChunkBlocks& chunkBlocks,
+    const ChunkInterface& chunk, ChunkInterface::ChunkBlocks& chunkBlocks,
     const BiomesInsideChunkWithOneBlockAroundIt& allBiomesInChunkPerCoordinate,
-    const TerrainGenerator::RectangleCorners& cornerNoises)
+    const TerrainGenerator::RectangleCorners& cornerNoises,
+    DecorationsPerBiome& decorationsPerBiome)
 {
     Rectangle smallerChunk;
     smallerChunk.x = 0;
@@ -68,7 +71,9 @@ void TerrainGenerator::generateTerrainForChunkWithDifferentBiomes(
         {
             auto surfaceLevel = bilinearInterpolation(cornerNoises, smallerChunk, x, z);
             auto& biome = *allBiomesInChunkPerCoordinate[x][z];
-            biome.generateColumnOfBlocks(chunkBlocks, surfaceLevel, x, z);
+            auto globalCoord = chunk.localToGlobalCoordinates({x, 0, z});
+            biome.generateColumnOfBlocks(chunkBlocks, surfaceLevel, x, z, globalCoord,
+                                         decorationsPerBiome[&biome]);
         }
     }
 }
@@ -133,7 +138,8 @@ TerrainGenerator::RectangleCorners TerrainGenerator::calculateNoiseAtChunkCorner
 }
 
 void TerrainGenerator::generateTerrainForChunkWithGivenBiome(
-    const ChunkInterface& chunk, ChunkInterface::ChunkBlocks& chunkBlocks, Biome& biome) const
+    const ChunkInterface& chunk, ChunkInterface::ChunkBlocks& chunkBlocks, Biome& biome,
+    Biome::Decorations& decorations) const
 {
     for (auto x = 0; x < ChunkInterface::BLOCKS_PER_X_DIMENSION; ++x)
     {
@@ -141,7 +147,7 @@ void TerrainGenerator::generateTerrainForChunkWithGivenBiome(
         {
             auto globalCoord = chunk.localToGlobalCoordinates({x, 0, z});
             auto surfaceLevel = biome.surfaceLevelAtGivenPosition(globalCoord.x, globalCoord.z);
-            biome.generateColumnOfBlocks(chunkBlocks, surfaceLevel, x, z);
+            biome.generateColumnOfBlocks(chunkBlocks, surfaceLevel, x, z, globalCoord, decorations);
         }
     }
 }
@@ -6,6 +6,7 @@
 #include "World/Biomes/VeryDryForestBiome.h"
 #include "World/Block/Block.h"
 #include "World/Chunks/Chunk.h"
+#include <map>
 #include <set>
 
 class TerrainGenerator
@@ -35,6 +36,12 @@ private:
         MultiDimensionalArray<Biome*, ChunkInterface::BLOCKS_PER_X_DIMENSION + 2,
                               ChunkInterface::BLOCKS_PER_Z_DIMENSION + 2>;
 
+    /**
+     * @brief Decorations decided while generating a single chunk, grouped by the biome that placed
+     * them. It lives only as long as the generation of that chunk.
+     */
+    using DecorationsPerBiome = std::map<const Biome*, Biome::Decorations>;
+
     /**
      * @brief On the given global coordinates it determines what biome is located.
      * @param x Global coordinate at x on which the biome is checked
@@ -135,10 +142,11 @@ private:
      * @param chunk Chunk on which the site is to be created.
      * @param chunkBlocks Chunk blocks that are overwritten thus creating terrain.
      * @param biome Biome to be used to create terrain.
+     * @param decorations Decorations decided by the biome while generating the chunk.
      */
     void generateTerrainForChunkWithGivenBiome(const ChunkInterface& chunk,
                                                ChunkInterface::ChunkBlocks& chunkBlocks,
-                                               Biome& biome) const;
+                                               Biome& biome, Biome::Decorations& decorations) const;
 
     /**
      * @brief Calculate the noise on the corners of the chunk in the form of corners of a rectangle.
@@ -153,16 +161,18 @@ private:
 
     /**
      * @brief Generates terrain on the indicated chunk using the indicated biome.
+     * @param chunk Chunk on which the terrain is generated.
      * @param chunkBlocks Blocks of the chunk that are overwritten thus creating terrain.
      * @param allBiomesInChunkPerCoordinate 2D array structure that determines the biom per
      * coordinate taking into account the outside of the chunk, that is, 1 block beyond the chunk
      * inclusive.
      * @param cornerNoises Noise at the corners of the rectangle
+     * @param decorationsPerBiome Decorations decided by each biome while generating the chunk.
      */
     void generateTerrainForChunkWithDifferentBiomes(
-        ChunkInterface::ChunkBlocks& chunkBlocks,
+        const ChunkInterface& chunk, ChunkInterface::ChunkBlocks& chunkBlocks,
         const BiomesInsideChunkWithOneBlockAroundIt& allBiomesInChunkPerCoordinate,
-        const RectangleCorners& cornerNoises);
+        const RectangleCorners& cornerNoises, DecorationsPerBiome& decorationsPerBiome);
 
 
 private:
@@ -63,18 +63,12 @@ void Crafting::handleEvent(const sf::Event& event)
 
 void Crafting::updateLayoutCorrectness()
 {
-    auto doesAnyRecipeMatch = false;
-    for (auto& recipe: RecipeContainer::recipeContainer().recipes())
+    if (const auto* recipe = RecipeContainer::recipeContainer().findRecipe(craftingLayout()))
     {
-        if (isCraftingLayoutEqualToRecipe(recipe))
-        {
-            mResultItemSlot->item(recipe.finalItem);
-            mResultItemSlot->amount(recipe.finalAmount);
-            doesAnyRecipeMatch = true;
-            break;
-        }
+        mResultItemSlot->item(recipe->finalItem);
+        mResultItemSlot->amount(recipe->finalAmount);
     }
-    if (!doesAnyRecipeMatch)
+    else
     {
         mResultItemSlot->removeItem();
     }
@@ -88,26 +82,22 @@ void Crafting::updateIfResultItemOfFinilizedCraftingIsTaken()
     }
 }
 
-bool Crafting::isCraftingLayoutEqualToRecipe(const Recipe& recipe)
+RecipeIndex::Layout Crafting::craftingLayout()
 {
+    RecipeIndex::Layout layout;
     for (auto column = 0; column < NUMBER_OF_COLUMNS; ++column)
     {
         for (auto row = 0; row < NUMBER_OF_ROWS; ++row)
         {
             auto itemSlotInCrafting = mItemSlots.at(column * NUMBER_OF_COLUMNS + row);
-            auto itemInCrafting = ItemId::None;
+            layout[column][row] = ItemId::None;
             if (itemSlotInCrafting->doesContainItem())
             {
-                itemInCrafting = itemSlotInCrafting->item()->id();
-            }
-
-            if (recipe.layout[column][row] != itemInCrafting)
-            {
-                return false;
+                layout[column][row] = itemSlotInCrafting->item()->id();
             }
         }
     }
-    return true;
+    return layout;
 }
 
 void Crafting::draw(sf::RenderTarget& target, sf::RenderStates states) const
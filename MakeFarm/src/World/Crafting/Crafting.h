@@ -1,6 +1,7 @@
 #pragma once
 #include "Player/GUI/ItemSlots.h"
 #include <World/Crafting/Recipe.h>
+#include <World/Crafting/RecipeIndex.h>
 
 /**
  * @brief Crafting system used to create one new object from a 9x9 grid of objects.
@@ -86,11 +87,10 @@ private:
     void createItemSlot(const GameResources& gameResources, int column, int row);
 
     /**
-     * @brief Verifies that the crafting layout is consistent with the indicated recipe.
-     * @param recipe The recipe with which the crafting zone is to be compared
-     * @return True if the recipe follows the layout in the crafting zone, false otherwise.
+     * @brief Returns the items laid out in the crafting zone.
+     * @return Items in the crafting zone, in the same order as in the recipe layout.
      */
-    bool isCraftingLayoutEqualToRecipe(const Recipe& recipe);
+    RecipeIndex::Layout craftingLayout();
 
     /**
      * @brief Updates whether the transaction can again be considered non-finalized - i.e. whether
@@ -11,4 +11,7 @@ struct Recipe
     MultiDimensionalArray<ItemId, 3, 3> layout;
     ItemId finalItem;
     int finalAmount = 1;
+
+    /** The items of a shapeless recipe can be placed anywhere in the crafting grid */
+    bool shapeless = false;
 };
\ No newline at end of file
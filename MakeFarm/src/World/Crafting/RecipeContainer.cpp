@@ -1,4 +1,5 @@
 #include "RecipeContainer.h"
+#include "Resources/ResourceBundle.h"
 #include "World/Crafting/RecipeSettings.h"
 #include "pch.h"
 #include <filesystem>
@@ -12,15 +13,30 @@ const RecipeContainer& RecipeContainer::recipeContainer()
 
 const std::vector<Recipe>& RecipeContainer::recipes() const
 {
-    return mRecipes;
+    return mRecipeIndex.recipes();
+}
+
+const Recipe* RecipeContainer::findRecipe(const RecipeIndex::Layout& layout) const
+{
+    return mRecipeIndex.find(layout);
 }
 
 RecipeContainer::RecipeContainer()
 {
-    parseDirectory("resources/items");
+    std::vector<Recipe> recipes;
+    if (const auto& bundle = ResourceBundle::bundle())
+    {
+        recipes = bundle->recipes;
+    }
+    else
+    {
+        parseDirectory("resources/items", recipes);
+    }
+    mRecipeIndex = RecipeIndex(std::move(recipes));
 }
 
-void RecipeContainer::parseDirectory(const std::string& directoryName)
+void RecipeContainer::parseDirectory(const std::string& directoryName,
+                                     std::vector<Recipe>& recipes)
 {
     RecipeSettings settingsFile;
     for (const auto& file: std::filesystem::recursive_directory_iterator(directoryName))
@@ -34,8 +50,8 @@ void RecipeContainer::parseDirectory(const std::string& directoryName)
                 removeCfgExtension(fileName);
 
                 settingsFile.openFile(filePath);
-                auto recipes = settingsFile.getRecipes();
-                mRecipes.insert(mRecipes.end(), recipes.begin(), recipes.end());
+                auto recipesOfItem = settingsFile.getRecipes();
+                recipes.insert(recipes.end(), recipesOfItem.begin(), recipesOfItem.end());
                 settingsFile.closeFile();
             }
         }
@@ -1,6 +1,7 @@
 #pragma once
 #include "Utils/Settings.h"
 #include "World/Crafting/Recipe.h"
+#include "World/Crafting/RecipeIndex.h"
 #include <vector>
 
 /**
@@ -22,14 +23,22 @@ public:
      */
     [[nodiscard]] const std::vector<Recipe>& recipes() const;
 
+    /**
+     * @brief Finds the recipe which can be crafted from the items laid out in the crafting grid.
+     * @param layout Items in the crafting grid.
+     * @return The matching recipe, or nullptr if there is none.
+     */
+    [[nodiscard]] const Recipe* findRecipe(const RecipeIndex::Layout& layout) const;
+
 private:
     RecipeContainer();
 
     /**
      * It searches the folder for item settings.
      * @param directoryName Path to folder in search of items
+     * @param recipes Container to which the found recipes are added
      */
-    void parseDirectory(const std::string& directoryName);
+    void parseDirectory(const std::string& directoryName, std::vector<Recipe>& recipes);
 
     /**
      * @brief Checks if the file has a .cfg extension
@@ -45,5 +54,5 @@ private:
     void removeCfgExtension(std::string& fileName) const;
 
 private:
-    std::vector<Recipe> mRecipes;
+    RecipeIndex mRecipeIndex;
 };
@@ -0,0 +1,149 @@
+#include "RecipeIndex.h"
+#include "pch.h"
+
+#include <algorithm>
+
+RecipeIndex::RecipeIndex(std::vector<Recipe> recipes)
+    : mRecipes(std::move(recipes))
+{
+    // Mirrored patterns are added only after all the original ones, so that a recipe matching the
+    // grid exactly always wins over the mirror image of another recipe
+    for (auto recipeIndex = std::size_t{0}; recipeIndex < mRecipes.size(); ++recipeIndex)
+    {
+        const auto& recipe = mRecipes[recipeIndex];
+        const auto pattern =
+            recipe.shapeless ? shapelessPattern(recipe.layout) : shapedPattern(recipe.layout);
+        if (pattern.width > 0)
+        {
+            mRecipeIndices.try_emplace(pattern, recipeIndex);
+        }
+    }
+
+    for (auto recipeIndex = std::size_t{0}; recipeIndex < mRecipes.size(); ++recipeIndex)
+    {
+        const auto& recipe = mRecipes[recipeIndex];
+        if (recipe.shapeless)
+        {
+            continue;
+        }
+
+        const auto pattern = shapedPattern(recipe.layout);
+        if (pattern.width > 0)
+        {
+            mRecipeIndices.try_emplace(mirroredPattern(pattern), recipeIndex);
+        }
+    }
+}
+
+const std::vector<Recipe>& RecipeIndex::recipes() const
+{
+    return mRecipes;
+}
+
+const Recipe* RecipeIndex::find(const Layout& layout) const
+{
+    const auto pattern = shapedPattern(layout);
+    if (pattern.width == 0)
+    {
+        return nullptr;
+    }
+
+    auto foundRecipe = mRecipeIndices.find(pattern);
+    if (foundRecipe == mRecipeIndices.cend())
+    {
+        foundRecipe = mRecipeIndices.find(shapelessPattern(layout));
+    }
+    return foundRecipe != mRecipeIndices.cend() ? &mRecipes[foundRecipe->second] : nullptr;
+}
+
+std::size_t RecipeIndex::PatternHash::operator()(const Pattern& pattern) const noexcept
+{
+    // FNV-1a over the dimensions and the ingredients of the pattern
+    constexpr auto FNV_OFFSET_BASIS = std::uint64_t{14695981039346656037u};
+    constexpr auto FNV_PRIME = std::uint64_t{1099511628211u};
+
+    auto hash = FNV_OFFSET_BASIS;
+    auto combine = [&hash](std::uint64_t value)
+    {
+        hash ^= value;
+        hash *= FNV_PRIME;
+    };
+
+    combine(pattern.width);
+    combine(pattern.height);
+    combine(pattern.shapeless);
+    for (const auto item: pattern.items)
+    {
+        combine(static_cast<std::uint64_t>(item));
+    }
+    return static_cast<std::size_t>(hash);
+}
+
+RecipeIndex::Pattern RecipeIndex::shapedPattern(const Layout& layout)
+{
+    auto minColumn = GRID_SIZE;
+    auto maxColumn = -1;
+    auto minRow = GRID_SIZE;
+    auto maxRow = -1;
+    for (auto column = 0; column < GRID_SIZE; ++column)
+    {
+        for (auto row = 0; row < GRID_SIZE; ++row)
+        {
+            if (layout[column][row] != ItemId::None)
+            {
+                minColumn = std::min(minColumn, column);
+                maxColumn = std::max(maxColumn, column);
+                minRow = std::min(minRow, row);
+                maxRow = std::max(maxRow, row);
+            }
+        }
+    }
+
+    Pattern pattern;
+    if (maxColumn < 0)
+    {
+        return pattern;
+    }
+
+    pattern.width = static_cast<std::uint8_t>(maxColumn - minColumn + 1);
+    pattern.height = static_cast<std::uint8_t>(maxRow - minRow + 1);
+    for (auto row = 0; row < pattern.height; ++row)
+    {
+        for (auto column = 0; column < pattern.width; ++column)
+        {
+            pattern.items[row * pattern.width + column] =
+                layout[minColumn + column][minRow + row];
+        }
+    }
+    return pattern;
+}
+
+RecipeIndex::Pattern RecipeIndex::mirroredPattern(const Pattern& pattern)
+{
+    auto mirrored = pattern;
+    for (auto row = 0; row < pattern.height; ++row)
+    {
+        const auto rowBegin = mirrored.items.begin() + row * pattern.width;
+        std::reverse(rowBegin, rowBegin + pattern.width);
+    }
+    return mirrored;
+}
+
+RecipeIndex::Pattern RecipeIndex::shapelessPattern(const Layout& layout)
+{
+    Pattern pattern;
+    pattern.shapeless = true;
+    for (const auto& column: layout)
+    {
+        for (const auto item: column)
+        {
+            if (item != ItemId::None)
+            {
+                pattern.items[pattern.width++] = item;
+            }
+        }
+    }
+    std::sort(pattern.items.begin(), pattern.items.begin() + pattern.width);
+    pattern.height = pattern.width > 0 ? 1 : 0;
+    return pattern;
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "World/Crafting/Recipe.h"
+
+/**
+ * @brief Recipes indexed by the pattern of their ingredients, so that finding the recipe matching
+ * the crafting grid takes a hash lookup instead of comparing the grid with every recipe.
+ *
+ * The layouts of shaped recipes are trimmed to the box bounding their ingredients, so a recipe
+ * matches wherever it is placed in the grid, and they are indexed also mirrored horizontally.
+ * Shapeless recipes are indexed by their sorted ingredients. If several recipes share a pattern,
+ * the one added first is used, and a recipe placed as it is written always wins over a mirrored
+ * one.
+ */
+class RecipeIndex
+{
+public:
+    using Layout = decltype(Recipe::layout);
+
+    RecipeIndex() = default;
+
+    /**
+     * @brief Indexes the given recipes.
+     * @param recipes Recipes to index.
+     */
+    explicit RecipeIndex(std::vector<Recipe> recipes);
+
+    /**
+     * @brief Returns all indexed recipes.
+     * @return Indexed recipes in the order they were given.
+     */
+    [[nodiscard]] const std::vector<Recipe>& recipes() const;
+
+    /**
+     * @brief Finds the recipe which can be crafted from the items laid out in the crafting grid.
+     * @param layout Items in the crafting grid, in the same order as in the recipe layout.
+     * @return The matching recipe, or nullptr if there is none.
+     */
+    [[nodiscard]] const Recipe* find(const Layout& layout) const;
+
+private:
+    static constexpr auto GRID_SIZE = 3;
+
+    /**
+     * @brief Normalized ingredients of a recipe, the key of the index.
+     */
+    struct Pattern
+    {
+        /** Size of the box bounding the ingredients, or the number of ingredients if shapeless */
+        std::uint8_t width = 0;
+        std::uint8_t height = 0;
+        bool shapeless = false;
+
+        /** Ingredients row by row within the bounding box, or sorted if shapeless */
+        std::array<ItemId, GRID_SIZE * GRID_SIZE> items{};
+
+        bool operator==(const Pattern& rhs) const = default;
+    };
+
+    struct PatternHash
+    {
+        std::size_t operator()(const Pattern& pattern) const noexcept;
+    };
+
+    /**
+     * @brief Trims the layout to the box bounding its ingredients.
+     * @param layout Layout of the crafting grid or of a recipe.
+     * @return Pattern of the shaped recipe.
+     */
+    [[nodiscard]] static Pattern shapedPattern(const Layout& layout);
+
+    /**
+     * @brief Mirrors the pattern of a shaped recipe horizontally.
+     * @param pattern Pattern of the shaped recipe.
+     * @return Mirrored pattern.
+     */
+    [[nodiscard]] static Pattern mirroredPattern(const Pattern& pattern);
+
+    /**
+     * @brief Sorts the ingredients of the layout, ignoring their placement.
+     * @param layout Layout of the crafting grid or of a recipe.
+     * @return Pattern of the shapeless recipe.
+     */
+    [[nodiscard]] static Pattern shapelessPattern(const Layout& layout);
+
+private:
+    std::vector<Recipe> mRecipes;
+    std::unordered_map<Pattern, std::size_t, PatternHash> mRecipeIndices;
+};
@@ -26,25 +26,9 @@ std::vector<Recipe> RecipeSettings::getRecipes() const
 
 int RecipeSettings::resultItemId() const
 {
-    prepareToReadFromFstreamAgain();
-    std::string fileLine;
-    while (std::getline(mSettingsFile, fileLine))
+    if (isPresent("Id"))
     {
-        std::stringstream ss(fileLine);
-        std::string foundSetting;
-
-        std::string word;
-        while (ss >> word && word != "=")
-        {
-            foundSetting += word;
-        }
-
-        if (foundSetting == "Id")
-        {
-            int idOfBlock;
-            ss >> idOfBlock;
-            return idOfBlock;
-        }
+        return get<int>("Id");
     }
     message_assert(false, "Item Id in item file is not specified");
     return 0;
@@ -52,36 +36,10 @@ int RecipeSettings::resultItemId() const
 
 bool RecipeSettings::doesFileContainsDataNeedForRecipe() const
 {
-    prepareToReadFromFstreamAgain();
-    bool isCraftingFound = false;
-    bool isIdOfBlockFound = false;
-    std::string fileLine;
-    while (std::getline(mSettingsFile, fileLine))
-    {
-        std::stringstream ss(fileLine);
-        std::string foundSetting;
-
-        // Now I extract the settingName part
-        // settingName = settingValue
-        // ^^^^^^^^^^^
-        // foundSetting
-        std::string word;
-        while (ss >> word && word != "=")
-        {
-            foundSetting += word;
-        }
-
-        if (foundSetting == "Id")
-        {
-            isIdOfBlockFound = true;
-        }
-
-        if (foundSetting == "Crafting")
-        {
-            isCraftingFound = true;
-        }
-    }
-    return isIdOfBlockFound && isCraftingFound;
+    const auto isCraftingFound = std::any_of(mLines.cbegin(), mLines.cend(),
+                                             [](const std::string& fileLine)
+                                             { return splitLine(fileLine).first == "Crafting"; });
+    return isPresent("Id") && isCraftingFound;
 }
 
 std::vector<Recipe> RecipeSettings::parseRecipes(
@@ -89,6 +47,7 @@ std::vector<Recipe> RecipeSettings::parseRecipes(
     const std::vector<int>& allRecipesAmountMerged) const
 {
     auto numberOfRecipes = allRecipesAmountMerged.size();
+    const auto isShapeless = isPresent("Shapeless") && get<bool>("Shapeless");
     std::vector<Recipe> recipes;
     for (int recipeIndex = 0; recipeIndex < numberOfRecipes; ++recipeIndex)
     {
@@ -103,6 +62,7 @@ std::vector<Recipe> RecipeSettings::parseRecipes(
         }
         recipe.finalAmount = allRecipesAmountMerged[recipeIndex];
         recipe.finalItem = static_cast<ItemId>(idOfFinalBlock);
+        recipe.shapeless = isShapeless;
         recipes.emplace_back(recipe);
     }
     return recipes;
@@ -111,28 +71,24 @@ std::vector<Recipe> RecipeSettings::parseRecipes(
 void RecipeSettings::parseLines(std::vector<ItemId>& allRecipesItemsIdMerged,
                                 std::vector<int>& allRecipesAmountMerged) const
 {
-    prepareToReadFromFstreamAgain();
-    std::string fileLine;
-    while (std::getline(mSettingsFile, fileLine))
+    auto fileLine = std::find(mLines.cbegin(), mLines.cend(), "Crafting =");
+    if (fileLine != mLines.cend())
     {
-        if (fileLine == "Crafting =")
-        {
-            break;
-        }
+        ++fileLine;
     }
 
     auto lineCounter = 1;
-    while (std::getline(mSettingsFile, fileLine))
+    for (; fileLine != mLines.cend(); ++fileLine)
     {
-        if (fileLine.empty())
+        if (fileLine->empty())
         {
             continue;
         }
-        if (fileLine == "EndCrafting =")
+        if (*fileLine == "EndCrafting =")
         {
             break;
         }
-        parseRecipeLine(fileLine, lineCounter, allRecipesItemsIdMerged, allRecipesAmountMerged);
+        parseRecipeLine(*fileLine, lineCounter, allRecipesItemsIdMerged, allRecipesAmountMerged);
         ++lineCounter;
     }
 }
@@ -38,9 +38,8 @@ unsigned int Item::textureId() const
     switch (renderType())
     {
         case Item::Render::Block:
-            return static_cast<unsigned int>(BlockMap::blockMap()
-                                                 .blockType(static_cast<BlockId>(id()))
-                                                 .textureId.at(Block::Face::Front));
+            return static_cast<unsigned int>(
+                BlockMap::blockMap().textureId(static_cast<BlockId>(id()), Block::Face::Front));
         case Item::Render::Item: return static_cast<unsigned int>(id()) % 1000;
     }
 }
@@ -1,4 +1,5 @@
 #include "ItemMap.h"
+#include "Resources/ResourceBundle.h"
 #include "Utils/Settings.h"
 #include "pch.h"
 #include <filesystem>
@@ -15,9 +16,24 @@ const ItemType& ItemMap::itemType(const ItemId& itemId) const
     return mItemMap.at(itemId);
 }
 
+const std::unordered_map<ItemId, ItemType>& ItemMap::itemTypes() const
+{
+    return mItemMap;
+}
+
 ItemMap::ItemMap()
 {
-    parseDirectory("resources/items");
+    if (const auto& bundle = ResourceBundle::bundle())
+    {
+        for (const auto& itemType: bundle->itemTypes)
+        {
+            mItemMap[itemType.id] = itemType;
+        }
+    }
+    else
+    {
+        parseDirectory("resources/items");
+    }
 }
 
 void ItemMap::parseDirectory(const std::string& directoryName)
@@ -23,6 +23,12 @@ public:
      */
     [[nodiscard]] const ItemType& itemType(const ItemId& itemId) const;
 
+    /**
+     * @brief Returns the types of all items in the game
+     * @return Item information sets under their ids
+     */
+    [[nodiscard]] const std::unordered_map<ItemId, ItemType>& itemTypes() const;
+
 private:
     ItemMap();
 
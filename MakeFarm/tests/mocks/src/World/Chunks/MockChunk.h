@@ -19,7 +19,7 @@ public:
     MOCK_METHOD(void, removeLocalBlock, (const Block::Coordinate&), (override));
     MOCK_METHOD(void, tryToPlaceBlock,
                 (const BlockId&, const Block::Coordinate&, std::vector<BlockId>,
-                 const RebuildOperation&),
+                 const RebuildOperation&, const PlacementOrigin&),
                 (override));
     MOCK_METHOD(const Block&, localBlock, (const Block::Coordinate&), (const, override));
     MOCK_METHOD(Block::Coordinate, globalToLocalCoordinates, (const Block::Coordinate&),
@@ -38,7 +38,12 @@ public:
     MOCK_METHOD(const Block&, localNearbyBlock, (const Block::Coordinate&, const Direction&),
                 (const, override));
     MOCK_METHOD(const Block::Coordinate&, positionInBlocks, (), (const, override));
+    MOCK_METHOD(void, copyBlocksTo, (BlockRegion&), (const, override));
+    MOCK_METHOD(bool, isAnyBlockWithProperty,
+                (const Block::Coordinate&, const Block::Coordinate&, BlockProperty),
+                (const, override));
     MOCK_METHOD(std::optional<Block>, neighbourBlockInGivenDirection,
                 (const Block::Coordinate&, const Direction&), (override));
     MOCK_METHOD(Block::Coordinate, highestSetBlock, (const Block::Coordinate&), (override));
+    MOCK_METHOD(void, saveChunkData, (SaveBatch), (override));
 };
\ No newline at end of file
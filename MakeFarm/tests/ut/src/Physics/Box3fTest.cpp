@@ -0,0 +1,81 @@
+#include "Physics/Box3f.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace
+{
+
+Box3f unitBoxAt(float x, float y, float z)
+{
+    return Box3f{{x, y, z}, {x + 1, y + 1, z + 1}};
+}
+
+TEST(Box3fTest, BoxesSharingAFaceShouldIntersect)
+{
+    const auto box = unitBoxAt(0, 0, 0);
+    EXPECT_TRUE(box.intersects(unitBoxAt(1, 0, 0)));
+    EXPECT_TRUE(unitBoxAt(0, -1, 0).intersects(box));
+}
+
+TEST(Box3fTest, BoxesSeparatedOnSingleAxisShouldNotIntersect)
+{
+    const auto box = unitBoxAt(0, 0, 0);
+    EXPECT_FALSE(box.intersects(unitBoxAt(0, 0, 1.01f)));
+    EXPECT_FALSE(box.intersects(unitBoxAt(0, -1.01f, 0)));
+    EXPECT_FALSE(box.intersects(unitBoxAt(1.01f, 0.5f, 0.5f)));
+}
+
+TEST(Box3fTest, IntersectEachShouldMarkEveryIntersectingBox)
+{
+    const auto box = Box3f{{0, 0, 0}, {2, 2, 2}};
+    const auto boxes = std::vector<Box3f>{unitBoxAt(0.5f, 0.5f, 0.5f), unitBoxAt(5, 0, 0),
+                                          unitBoxAt(2, 2, 2), unitBoxAt(0, 0, -1.5f),
+                                          unitBoxAt(-1, 1, 1)};
+    auto intersections = std::vector<std::uint8_t>(boxes.size());
+
+    const auto numberOfIntersections = Box3f::intersectEach(box, boxes, intersections);
+
+    EXPECT_EQ(numberOfIntersections, 3);
+    EXPECT_EQ(intersections, (std::vector<std::uint8_t>{1, 0, 1, 0, 1}));
+}
+
+TEST(Box3fTest, IntersectEachShouldAgreeWithSingleTestsForManyBoxes)
+{
+    const auto box = Box3f{{-3.5f, 10.25f, 7}, {0.5f, 12.f, 9.75f}};
+    auto boxes = std::vector<Box3f>{};
+    for (auto x = -6; x <= 2; ++x)
+    {
+        for (auto y = 8; y <= 14; ++y)
+        {
+            for (auto z = 5; z <= 11; ++z)
+            {
+                boxes.push_back(unitBoxAt(x * 0.75f, y * 1.f, z * 1.25f));
+            }
+        }
+    }
+    auto intersections = std::vector<std::uint8_t>(boxes.size());
+
+    const auto numberOfIntersections = Box3f::intersectEach(box, boxes, intersections);
+
+    auto expectedNumberOfIntersections = std::size_t{0};
+    for (auto index = std::size_t{0}; index < boxes.size(); ++index)
+    {
+        const auto expected = box.intersects(boxes[index]);
+        EXPECT_EQ(intersections[index], expected) << "at index " << index;
+        expectedNumberOfIntersections += expected;
+    }
+    EXPECT_EQ(numberOfIntersections, expectedNumberOfIntersections);
+}
+
+TEST(Box3fTest, IntersectsAnyShouldFindIntersectingBox)
+{
+    const auto box = unitBoxAt(0, 0, 0);
+    const auto boxes = std::vector<Box3f>{unitBoxAt(3, 0, 0), unitBoxAt(0, 3, 0),
+                                          unitBoxAt(0.5f, 0.5f, 0.5f)};
+    EXPECT_TRUE(Box3f::intersectsAny(box, boxes));
+    EXPECT_FALSE(Box3f::intersectsAny(box, std::span(boxes).first(2)));
+    EXPECT_FALSE(Box3f::intersectsAny(box, {}));
+}
+
+}// namespace
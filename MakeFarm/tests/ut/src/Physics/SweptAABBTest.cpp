@@ -0,0 +1,98 @@
+#include "Physics/SweptAABB.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+/** Blocks at y <= 0 form a flat ground */
+bool isGround(const Block::Coordinate& blockCoordinate)
+{
+    return blockCoordinate.y <= 0;
+}
+
+TEST(SweptAABBTest, BoxMovesFreelyWhenNothingIsInItsWay)
+{
+    SweptAABB sut({0.25f, 5.f, 0.25f}, {0.75f, 6.8f, 0.75f});
+
+    const auto result = sut.move({0.5f, -1.f, 0.25f}, isGround);
+
+    EXPECT_FLOAT_EQ(result.displacement.x, 0.5f);
+    EXPECT_FLOAT_EQ(result.displacement.y, -1.f);
+    EXPECT_FLOAT_EQ(result.displacement.z, 0.25f);
+    EXPECT_EQ(result.contactNormal, sf::Vector3i(0, 0, 0));
+}
+
+TEST(SweptAABBTest, FallingBoxStopsAboveTheGroundAndReportsItsNormal)
+{
+    SweptAABB sut({0.25f, 3.f, 0.25f}, {0.75f, 4.8f, 0.75f});
+
+    const auto result = sut.move({0.f, -5.f, 0.f}, isGround);
+
+    EXPECT_NEAR(result.displacement.y, -2.f + SweptAABB::CONTACT_EPSILON, 1e-5f);
+    EXPECT_EQ(result.contactNormal, sf::Vector3i(0, 1, 0));
+}
+
+TEST(SweptAABBTest, FastBoxDoesNotTunnelThroughThinWall)
+{
+    auto isWall = [](const Block::Coordinate& blockCoordinate) { return blockCoordinate.x == 10; };
+    SweptAABB sut({0.25f, 1.f, 0.25f}, {0.75f, 2.8f, 0.75f});
+
+    const auto result = sut.move({100.f, 0.f, 0.f}, isWall);
+
+    EXPECT_NEAR(result.displacement.x, 10.f - 0.75f - SweptAABB::CONTACT_EPSILON, 1e-4f);
+    EXPECT_EQ(result.contactNormal, sf::Vector3i(-1, 0, 0));
+}
+
+TEST(SweptAABBTest, BoxSlidesAlongTheGroundWithTheRestOfItsMovement)
+{
+    SweptAABB sut({0.25f, 1.5f, 0.25f}, {0.75f, 3.3f, 0.75f});
+
+    const auto result = sut.move({2.f, -1.f, 1.f}, isGround);
+
+    EXPECT_FLOAT_EQ(result.displacement.x, 2.f);
+    EXPECT_NEAR(result.displacement.y, -0.5f + SweptAABB::CONTACT_EPSILON, 1e-5f);
+    EXPECT_FLOAT_EQ(result.displacement.z, 1.f);
+    EXPECT_EQ(result.contactNormal, sf::Vector3i(0, 1, 0));
+}
+
+TEST(SweptAABBTest, BoxRestingOnTheGroundKeepsTouchingItAndWalksOverBlockEdges)
+{
+    SweptAABB sut({0.25f, 1.f + SweptAABB::CONTACT_EPSILON, 0.25f},
+                  {0.75f, 2.8f + SweptAABB::CONTACT_EPSILON, 0.75f});
+
+    for (auto tick = 0; tick < 10; ++tick)
+    {
+        const auto result = sut.move({0.3f, -0.0001f, 0.f}, isGround);
+
+        EXPECT_FLOAT_EQ(result.displacement.x, 0.3f);
+        EXPECT_NEAR(result.displacement.y, 0.f, 1e-6f);
+        EXPECT_EQ(result.contactNormal, sf::Vector3i(0, 1, 0));
+    }
+}
+
+TEST(SweptAABBTest, BoxStuckInsideBlockCanLeaveIt)
+{
+    auto isBlock = [](const Block::Coordinate& blockCoordinate)
+    { return blockCoordinate == Block::Coordinate(0, 0, 0); };
+    SweptAABB sut({0.25f, 0.25f, 0.25f}, {0.75f, 0.75f, 0.75f});
+
+    const auto result = sut.move({0.f, 2.f, 0.f}, isBlock);
+
+    EXPECT_FLOAT_EQ(result.displacement.y, 2.f);
+    EXPECT_EQ(result.contactNormal, sf::Vector3i(0, 0, 0));
+}
+
+TEST(SweptAABBTest, BoxMovingIntoCornerStopsOnBothWalls)
+{
+    auto isCorner = [](const Block::Coordinate& blockCoordinate)
+    { return blockCoordinate.x == 2 || blockCoordinate.z == 2; };
+    SweptAABB sut({0.25f, 1.f, 0.25f}, {0.75f, 2.8f, 0.75f});
+
+    const auto result = sut.move({3.f, 0.f, 2.f}, isCorner);
+
+    EXPECT_NEAR(result.displacement.x, 1.25f - SweptAABB::CONTACT_EPSILON, 1e-5f);
+    EXPECT_NEAR(result.displacement.z, 1.25f - SweptAABB::CONTACT_EPSILON, 1e-5f);
+    EXPECT_EQ(result.contactNormal, sf::Vector3i(-1, 0, -1));
+}
+
+}// namespace
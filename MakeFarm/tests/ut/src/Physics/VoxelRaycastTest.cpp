@@ -0,0 +1,93 @@
+#include "Physics/VoxelRaycast.h"
+#include "gtest/gtest.h"
+#include <cstdlib>
+#include <set>
+
+namespace
+{
+
+TEST(VoxelRaycastTest, FirstVisitedBlockIsTheOneInWhichTheRayStarts)
+{
+    VoxelRaycast sut({0.5f, 70.2f, -3.5f}, {1, 0, 0}, 10);
+
+    const auto hit = sut.next();
+
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_EQ(hit->blockCoordinate, Block::Coordinate(0, 70, -4));
+    EXPECT_EQ(hit->face, Block::Face::Left);
+    EXPECT_FLOAT_EQ(hit->distance, 0.f);
+}
+
+TEST(VoxelRaycastTest, RayAlongTheAxisEntersTheNextBlocksThroughTheirFaces)
+{
+    VoxelRaycast sut({0.5f, 0.5f, 0.5f}, {1, 0, 0}, 10);
+    ASSERT_TRUE(sut.next().has_value());
+
+    const auto firstHit = sut.next();
+    const auto secondHit = sut.next();
+
+    ASSERT_TRUE(firstHit.has_value());
+    EXPECT_EQ(firstHit->blockCoordinate, Block::Coordinate(1, 0, 0));
+    EXPECT_EQ(firstHit->face, Block::Face::Left);
+    EXPECT_FLOAT_EQ(firstHit->point.x, 1.f);
+    EXPECT_FLOAT_EQ(firstHit->distance, 0.5f);
+    ASSERT_TRUE(secondHit.has_value());
+    EXPECT_EQ(secondHit->blockCoordinate, Block::Coordinate(2, 0, 0));
+}
+
+TEST(VoxelRaycastTest, FirstHitReturnsTheEntryFaceAndPoint)
+{
+    VoxelRaycast sut({0.5f, 5.5f, 0.5f}, {0, -1, 0}, 10);
+
+    const auto hit = sut.firstHit([](const Block::Coordinate& blockCoordinate)
+                                  { return blockCoordinate.y <= 2; });
+
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_EQ(hit->blockCoordinate, Block::Coordinate(0, 2, 0));
+    EXPECT_EQ(hit->face, Block::Face::Top);
+    EXPECT_FLOAT_EQ(hit->point.y, 3.f);
+    EXPECT_FLOAT_EQ(hit->distance, 2.5f);
+}
+
+TEST(VoxelRaycastTest, RayTowardsNegativeCoordinatesEntersThroughOppositeFaces)
+{
+    VoxelRaycast sut({-0.5f, 0.5f, -0.5f}, {0, 0, -1}, 10);
+    ASSERT_TRUE(sut.next().has_value());
+
+    const auto hit = sut.next();
+
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_EQ(hit->blockCoordinate, Block::Coordinate(-1, 0, -2));
+    EXPECT_EQ(hit->face, Block::Face::Front);
+}
+
+TEST(VoxelRaycastTest, DiagonalRayVisitsEveryBlockOnceMovingToNeighbours)
+{
+    VoxelRaycast sut({0.3f, 60.7f, -0.2f}, {0.6f, -0.3f, -0.74f}, 20);
+    std::set<std::tuple<int, int, int>> visitedBlocks;
+
+    auto previousHit = sut.next();
+    while (const auto hit = sut.next())
+    {
+        const auto& previous = previousHit->blockCoordinate;
+        const auto& current = hit->blockCoordinate;
+        EXPECT_EQ(std::abs(current.x - previous.x) + std::abs(current.y - previous.y) +
+                      std::abs(current.z - previous.z),
+                  1);
+        EXPECT_TRUE(visitedBlocks.emplace(current.x, current.y, current.z).second);
+        EXPECT_LE(hit->distance, 20.f);
+        previousHit = hit;
+    }
+    EXPECT_FALSE(visitedBlocks.empty());
+}
+
+TEST(VoxelRaycastTest, RayEndsAtItsMaximumDistance)
+{
+    VoxelRaycast sut({0.5f, 0.5f, 0.5f}, {0, 0, 1}, 2);
+
+    const auto hit = sut.firstHit([](const Block::Coordinate&) { return false; });
+
+    EXPECT_FALSE(hit.has_value());
+}
+
+}// namespace
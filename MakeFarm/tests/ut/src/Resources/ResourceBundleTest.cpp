@@ -0,0 +1,194 @@
+#include "Resources/ResourceBundle.h"
+#include "TestUtils/TemporaryDirectoryTest.h"
+#include "gtest/gtest.h"
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+
+ResourceBundle::Contents exampleContents()
+{
+    ResourceBundle::Contents contents;
+
+    // The bundle holds every block, so the ones not filled in below are left at their defaults
+    for (auto i = 0; i < static_cast<int>(BlockId::Counter); ++i)
+    {
+        BlockType blockType;
+        blockType.id = static_cast<BlockId>(i);
+        blockType.fileName = "Block" + std::to_string(i);
+        blockType.name = blockType.fileName;
+        contents.blockTypes.push_back(blockType);
+    }
+
+    BlockType grass;
+    grass.id = BlockId::Grass;
+    grass.fileName = "Grass";
+    grass.name = "Grass";
+    grass.dropItemId = ItemId::Dirt_Block;
+    grass.textureId = {0, 1, 1, 2, 1, 1};
+    BlockType leaves;
+    leaves.id = BlockId::Leaves;
+    leaves.fileName = "Leaves";
+    leaves.name = "Leaves";
+    leaves.transparent = true;
+    leaves.floral = true;
+    leaves.textureId.fill(7);
+    contents.blockTypes[static_cast<int>(BlockId::Grass)] = grass;
+    contents.blockTypes[static_cast<int>(BlockId::Leaves)] = leaves;
+
+    ItemType planks;
+    planks.id = ItemId::Planks_Block;
+    planks.fileName = "PlanksBlock";
+    planks.name = "Planks";
+    planks.render = Item::Render::Block;
+    planks.maxAmountInSlot = ItemType::DEFAULT_MAXIMUM_AMOUNT_IN_SLOT;
+    contents.itemTypes = {planks};
+
+    Recipe recipe;
+    for (auto& column: recipe.layout)
+    {
+        column.fill(ItemId::None);
+    }
+    recipe.layout[0][0] = ItemId::Log_Block;
+    recipe.finalItem = ItemId::Planks_Block;
+    recipe.finalAmount = 4;
+    auto shapelessRecipe = recipe;
+    shapelessRecipe.shapeless = true;
+    contents.recipes = {recipe, shapelessRecipe};
+
+    return contents;
+}
+
+void expectSameContents(const ResourceBundle::Contents& lhs, const ResourceBundle::Contents& rhs)
+{
+    ASSERT_EQ(lhs.blockTypes.size(), rhs.blockTypes.size());
+    for (auto i = 0u; i < lhs.blockTypes.size(); ++i)
+    {
+        EXPECT_EQ(lhs.blockTypes[i].id, rhs.blockTypes[i].id);
+        EXPECT_EQ(lhs.blockTypes[i].fileName, rhs.blockTypes[i].fileName);
+        EXPECT_EQ(lhs.blockTypes[i].name, rhs.blockTypes[i].name);
+        EXPECT_EQ(lhs.blockTypes[i].transparent, rhs.blockTypes[i].transparent);
+        EXPECT_EQ(lhs.blockTypes[i].collidable, rhs.blockTypes[i].collidable);
+        EXPECT_EQ(lhs.blockTypes[i].floral, rhs.blockTypes[i].floral);
+        EXPECT_EQ(lhs.blockTypes[i].dropItemId, rhs.blockTypes[i].dropItemId);
+        EXPECT_EQ(lhs.blockTypes[i].textureId, rhs.blockTypes[i].textureId);
+    }
+
+    ASSERT_EQ(lhs.itemTypes.size(), rhs.itemTypes.size());
+    for (auto i = 0u; i < lhs.itemTypes.size(); ++i)
+    {
+        EXPECT_EQ(lhs.itemTypes[i].id, rhs.itemTypes[i].id);
+        EXPECT_EQ(lhs.itemTypes[i].name, rhs.itemTypes[i].name);
+        EXPECT_EQ(lhs.itemTypes[i].render, rhs.itemTypes[i].render);
+        EXPECT_EQ(lhs.itemTypes[i].textureId, rhs.itemTypes[i].textureId);
+        EXPECT_EQ(lhs.itemTypes[i].maxAmountInSlot, rhs.itemTypes[i].maxAmountInSlot);
+    }
+
+    ASSERT_EQ(lhs.recipes.size(), rhs.recipes.size());
+    for (auto i = 0u; i < lhs.recipes.size(); ++i)
+    {
+        EXPECT_EQ(lhs.recipes[i].layout, rhs.recipes[i].layout);
+        EXPECT_EQ(lhs.recipes[i].finalItem, rhs.recipes[i].finalItem);
+        EXPECT_EQ(lhs.recipes[i].finalAmount, rhs.recipes[i].finalAmount);
+        EXPECT_EQ(lhs.recipes[i].shapeless, rhs.recipes[i].shapeless);
+    }
+}
+
+class ResourceBundleTest : public TemporaryDirectoryTest
+{
+protected:
+    void SetUp() override
+    {
+        TemporaryDirectoryTest::SetUp();
+        mSourceDirectory = (testDirectory / "blocks").string();
+        mBundlePath = (testDirectory / "resources.bundle").string();
+
+        std::filesystem::create_directories(mSourceDirectory);
+        std::ofstream(mSourceDirectory + "/Grass.cfg") << "Id = 1\n";
+    }
+
+    std::string mSourceDirectory;
+    std::string mBundlePath;
+};
+
+TEST_F(ResourceBundleTest, DecodesEncodedContents)
+{
+    const auto contents = exampleContents();
+
+    const auto bytes = ResourceBundle::encode(contents);
+    const auto decodedContents = ResourceBundle::decode(bytes.data(), bytes.size());
+
+    ASSERT_TRUE(decodedContents);
+    expectSameContents(*decodedContents, contents);
+}
+
+TEST_F(ResourceBundleTest, RejectsDamagedOrOtherVersionBytes)
+{
+    auto bytes = ResourceBundle::encode(exampleContents());
+
+    EXPECT_FALSE(ResourceBundle::decode(bytes.data(), bytes.size() - 1));
+    EXPECT_FALSE(ResourceBundle::decode(bytes.data(), 2));
+
+    ++bytes[4];
+    EXPECT_FALSE(ResourceBundle::decode(bytes.data(), bytes.size()));
+}
+
+TEST_F(ResourceBundleTest, RejectsIncompleteBlockTable)
+{
+    auto contents = exampleContents();
+    contents.blockTypes.pop_back();
+    const auto bytesWithoutBlock = ResourceBundle::encode(contents);
+    std::swap(contents.blockTypes[0], contents.blockTypes[1]);
+    const auto bytesWithBlocksOutOfOrder = ResourceBundle::encode(contents);
+
+    EXPECT_FALSE(ResourceBundle::decode(bytesWithoutBlock.data(), bytesWithoutBlock.size()));
+    EXPECT_FALSE(
+        ResourceBundle::decode(bytesWithBlocksOutOfOrder.data(), bytesWithBlocksOutOfOrder.size()));
+}
+
+TEST_F(ResourceBundleTest, RejectsUnknownIdsAndRenders)
+{
+    auto contentsWithUnknownItem = exampleContents();
+    contentsWithUnknownItem.recipes[0].finalItem = ItemId::AllItems;
+    auto contentsWithUnknownRender = exampleContents();
+    contentsWithUnknownRender.itemTypes[0].render = static_cast<Item::Render>(2);
+    auto contentsWithUnknownBlock = exampleContents();
+    contentsWithUnknownBlock.blockTypes.back().id = BlockId::AllBlocks;
+
+    for (const auto& contents:
+         {contentsWithUnknownItem, contentsWithUnknownRender, contentsWithUnknownBlock})
+    {
+        const auto bytes = ResourceBundle::encode(contents);
+        EXPECT_FALSE(ResourceBundle::decode(bytes.data(), bytes.size()));
+    }
+}
+
+TEST_F(ResourceBundleTest, ReadsBundleNewerThanItsSources)
+{
+    const auto contents = exampleContents();
+    ResourceBundle::write(mBundlePath, contents);
+    const auto sourceWriteTime = std::filesystem::last_write_time(mSourceDirectory);
+    std::filesystem::last_write_time(mBundlePath, sourceWriteTime + std::chrono::seconds(10));
+
+    const auto readContents = ResourceBundle::read(mBundlePath, {mSourceDirectory});
+
+    ASSERT_TRUE(readContents);
+    expectSameContents(*readContents, contents);
+}
+
+TEST_F(ResourceBundleTest, IgnoresBundleOlderThanItsSources)
+{
+    ResourceBundle::write(mBundlePath, exampleContents());
+    const auto sourceWriteTime = std::filesystem::last_write_time(mSourceDirectory);
+    std::filesystem::last_write_time(mBundlePath, sourceWriteTime - std::chrono::seconds(10));
+
+    EXPECT_FALSE(ResourceBundle::read(mBundlePath, {mSourceDirectory}));
+}
+
+TEST_F(ResourceBundleTest, IgnoresMissingBundle)
+{
+    EXPECT_FALSE(ResourceBundle::read(mBundlePath, {mSourceDirectory}));
+}
+
+}// namespace
@@ -0,0 +1,75 @@
+#include "Utils/PositionalRandom.h"
+#include "gtest/gtest.h"
+#include <set>
+
+namespace
+{
+
+TEST(PositionalRandomTest, ReturnsSameValueForSamePosition)
+{
+    PositionalRandom sut1(15, 1);
+    PositionalRandom sut2(15, 1);
+
+    EXPECT_EQ(sut1.valueAt(-37, 1024), sut2.valueAt(-37, 1024));
+    EXPECT_EQ(sut1.valueAt(-37, 1024), sut1.valueAt(-37, 1024));
+}
+
+TEST(PositionalRandomTest, ReturnsDifferentValueForDifferentPositions)
+{
+    PositionalRandom sut(15, 1);
+
+    EXPECT_NE(sut.valueAt(0, 1), sut.valueAt(1, 0));
+    EXPECT_NE(sut.valueAt(5, 6), sut.valueAt(5, 7));
+}
+
+TEST(PositionalRandomTest, ReturnsDifferentValueForDifferentSeedsAndSalts)
+{
+    PositionalRandom sut(15, 1);
+    PositionalRandom otherSeed(16, 1);
+    PositionalRandom otherSalt(15, 2);
+
+    EXPECT_NE(sut.valueAt(5, 6), otherSeed.valueAt(5, 6));
+    EXPECT_NE(sut.valueAt(5, 6), otherSalt.valueAt(5, 6));
+}
+
+TEST(PositionalRandomTest, RealNumberIsInRangeFromZeroToOne)
+{
+    PositionalRandom sut(15, 1);
+
+    for (auto x = -50; x < 50; ++x)
+    {
+        auto value = sut.realNumberAt(x, x * 3);
+        EXPECT_GE(value, 0.0);
+        EXPECT_LT(value, 1.0);
+    }
+}
+
+TEST(PositionalRandomTest, IntegerIsInGivenRangeAndCoversIt)
+{
+    PositionalRandom sut(15, 1);
+    std::set<int> drawnValues;
+
+    for (auto x = 0; x < 200; ++x)
+    {
+        auto value = sut.integerInRangeAt(5, 9, x, -x);
+        EXPECT_GE(value, 5);
+        EXPECT_LE(value, 9);
+        drawnValues.insert(value);
+    }
+    EXPECT_EQ(drawnValues, (std::set<int>{5, 6, 7, 8, 9}));
+}
+
+TEST(PositionalRandomTest, BernoulliDistributionRespectsItsBoundaries)
+{
+    PositionalRandom random(15, 1);
+    PositionalBernoulliDistribution never(0);
+    PositionalBernoulliDistribution always(1);
+
+    for (auto x = 0; x < 100; ++x)
+    {
+        EXPECT_FALSE(never(random, x, 7));
+        EXPECT_TRUE(always(random, x, 7));
+    }
+}
+
+}// namespace
@@ -0,0 +1,82 @@
+#include "TestUtils/TemporaryDirectoryTest.h"
+#include "Utils/Settings.h"
+#include "gtest/gtest.h"
+#include <filesystem>
+
+namespace
+{
+
+class SettingsTest : public TemporaryDirectoryTest
+{
+protected:
+    void SetUp() override
+    {
+        TemporaryDirectoryTest::SetUp();
+        mFileName = (testDirectory / "Settings.cfg").string();
+
+        std::ofstream file(mFileName);
+        file << "Id = 14\n"
+                "Name = Spruce Planks\n"
+                "Transparent = true\n"
+                "Broken = 12abc\n"
+                "\n"
+                "Crafting =\n"
+                "5 0 0\n"
+                "Amount = 4\n"
+                "EndCrafting =\n"
+                "Render = Block\n";
+    }
+
+    std::string mFileName;
+};
+
+TEST_F(SettingsTest, ReadsSettingsOfEveryType)
+{
+    Settings sut(mFileName);
+
+    EXPECT_EQ(sut.get<int>("Id"), 14);
+    EXPECT_EQ(sut.get<unsigned>("Id"), 14u);
+    EXPECT_FLOAT_EQ(sut.get<float>("Id"), 14.f);
+    EXPECT_EQ(sut.get<std::string>("Name"), "Spruce Planks");
+    EXPECT_TRUE(sut.get<bool>("Transparent"));
+    EXPECT_EQ(sut.get<std::string>("Render"), "Block");
+}
+
+TEST_F(SettingsTest, IgnoresLinesOfCraftingRecipes)
+{
+    Settings sut(mFileName);
+
+    EXPECT_FALSE(sut.isPresent("Amount"));
+    EXPECT_THROW(sut.get<int>("Amount"), std::runtime_error);
+    EXPECT_TRUE(sut.isPresent("Render"));
+}
+
+TEST_F(SettingsTest, ThrowsWhenValueIsNotOfGivenType)
+{
+    Settings sut(mFileName);
+
+    EXPECT_THROW(sut.get<int>("Broken"), std::runtime_error);
+    EXPECT_THROW(sut.get<int>("Name"), std::runtime_error);
+    EXPECT_THROW(sut.get<bool>("Name"), std::logic_error);
+}
+
+TEST_F(SettingsTest, SetReplacesSettingInFileAndKeepsOtherLines)
+{
+    {
+        Settings sut(mFileName);
+        sut.set("Id", 20);
+        sut.set("Floral", 1);
+
+        EXPECT_EQ(sut.get<int>("Id"), 20);
+        EXPECT_TRUE(sut.get<bool>("Floral"));
+    }
+
+    Settings sut(mFileName);
+    EXPECT_EQ(sut.get<int>("Id"), 20);
+    EXPECT_TRUE(sut.get<bool>("Floral"));
+    EXPECT_EQ(sut.get<std::string>("Name"), "Spruce Planks");
+    EXPECT_FALSE(sut.isPresent("Amount"));
+    EXPECT_FALSE(std::filesystem::exists(mFileName + ".tmp"));
+}
+
+}// namespace
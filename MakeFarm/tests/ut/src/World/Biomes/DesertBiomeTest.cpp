@@ -12,7 +12,7 @@ public:
 
     void chanceToGetCactus(int chance)
     {
-        mCactusDecider = std::bernoulli_distribution(chance);
+        mCactusDecider = PositionalBernoulliDistribution(chance);
     }
 };
 
@@ -57,10 +57,12 @@ TEST(DesertBiomeTest, GeneratedTerrainContainsCorrectTypeOfBlocksAboveSeaLevel)
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = DesertBiome::SEA_LEVEL + 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableDesertBiome sut(15);
     sut.chanceToGetCactus(0);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     auto expectedSetOfBlocks = std::set<BlockId>{BlockId::Air, BlockId::Sand, BlockId::Stone};
     EXPECT_EQ(setOfBlocks, expectedSetOfBlocks);
@@ -71,10 +73,12 @@ TEST(DesertBiomeTest, GeneratedTerrainContainsCorrectTypeOfBlocksBelowSeaLevel)
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = DesertBiome::SEA_LEVEL - 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableDesertBiome sut(15);
     sut.chanceToGetCactus(0);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     auto expectedSetOfBlocks =
         std::set<BlockId>{BlockId::Air, BlockId::Sand, BlockId::Stone, BlockId::Water};
@@ -88,12 +92,16 @@ TEST(DesertBiomeTest, CactusShouldBePlacedAboveSea)
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = DesertBiome::SEA_LEVEL + 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableDesertBiome sut(15);
     sut.chanceToGetCactus(1);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     EXPECT_TRUE(setOfBlocks.contains(BlockId::Cactus));
+    ASSERT_EQ(decorations.size(), 1);
+    EXPECT_EQ(decorations.front().position, Block::Coordinate(5, surfaceLevel + 1, 6));
 }
 
 TEST(DesertBiomeTest, CactusShouldNotBePlacedBelowSea)
@@ -101,12 +109,15 @@ TEST(DesertBiomeTest, CactusShouldNotBePlacedBelowSea)
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = DesertBiome::SEA_LEVEL - 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableDesertBiome sut(15);
     sut.chanceToGetCactus(1);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     EXPECT_FALSE(setOfBlocks.contains(BlockId::Cactus));
+    EXPECT_TRUE(decorations.empty());
 }
 
 
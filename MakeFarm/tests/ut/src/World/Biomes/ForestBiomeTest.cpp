@@ -1,5 +1,6 @@
 #include "World/Biomes/ForestBiome.h"
 #include "TestUtils/BiomeTestUtils.h"
+#include "World/Chunks/MockChunk.h"
 #include "gtest/gtest.h"
 
 namespace
@@ -12,7 +13,7 @@ public:
 
     void chanceToGetTree(int chance)
     {
-        mTreeDecider = std::bernoulli_distribution(chance);
+        mTreeDecider = PositionalBernoulliDistribution(chance);
     }
 };
 
@@ -57,10 +58,12 @@ TEST(ForestBiomeTest, GeneratedTerrainContainsCorrectTypeOfBlocksAboveSeaLevel)
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = ForestBiome::SEA_LEVEL + 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableForestBiome sut(15);
     sut.chanceToGetTree(0);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     auto expectedSetOfBlocks =
         std::set<BlockId>{BlockId::Air, BlockId::Dirt, BlockId::Grass, BlockId::Stone};
@@ -72,10 +75,12 @@ TEST(ForestBiomeTest, GeneratedTerrainContainsCorrectTypeOfBlocksOneBelowSeaLeve
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = ForestBiome::SEA_LEVEL - 1;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableForestBiome sut(15);
     sut.chanceToGetTree(0);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     auto expectedSetOfBlocks =
         std::set<BlockId>{BlockId::Air, BlockId::Dirt, BlockId::Sand, BlockId::Stone};
@@ -87,10 +92,12 @@ TEST(ForestBiomeTest, GeneratedTerrainContainsCorrectTypeOfBlocksBelowSeaLevel)
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = ForestBiome::SEA_LEVEL - 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableForestBiome sut(15);
     sut.chanceToGetTree(0);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     auto expectedSetOfBlocks = std::set<BlockId>{BlockId::Air, BlockId::Dirt, BlockId::Sand,
                                                  BlockId::Stone, BlockId::Water};
@@ -104,12 +111,16 @@ TEST(ForestBiomeTest, LogOfTreeShouldBePlacedAboveSea)
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = ForestBiome::SEA_LEVEL + 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableForestBiome sut(15);
     sut.chanceToGetTree(1);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     EXPECT_TRUE(setOfBlocks.contains(BlockId::Log));
+    ASSERT_EQ(decorations.size(), 1);
+    EXPECT_EQ(decorations.front().position, Block::Coordinate(5, surfaceLevel + 1, 6));
 }
 
 TEST(ForestBiomeTest, LogOfTreeShouldNotBePlacedBelowSea)
@@ -117,13 +128,91 @@ TEST(ForestBiomeTest, LogOfTreeShouldNotBePlacedBelowSea)
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = ForestBiome::SEA_LEVEL - 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableForestBiome sut(15);
     sut.chanceToGetTree(1);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     EXPECT_FALSE(setOfBlocks.contains(BlockId::Log));
+    EXPECT_TRUE(decorations.empty());
 }
 
+TEST(ForestBiomeTest, TreesArePlacedOnTheSameColumnsOnSameSeeds)
+{
+    auto surfaceLevel = ForestBiome::SEA_LEVEL + 10;
+    Chunk::ChunkBlocks chunkBlocks1;
+    Chunk::ChunkBlocks chunkBlocks2;
+    Biome::Decorations decorations1;
+    Biome::Decorations decorations2;
+    ForestBiome sut1(15);
+    ForestBiome sut2(15);
+
+    for (auto x = 0; x < ChunkInterface::BLOCKS_PER_X_DIMENSION; ++x)
+    {
+        for (auto z = 0; z < ChunkInterface::BLOCKS_PER_Z_DIMENSION; ++z)
+        {
+            auto globalCoordinate = Block::Coordinate(x + 1024, 0, z - 2048);
+            sut1.generateColumnOfBlocks(chunkBlocks1, surfaceLevel, x, z, globalCoordinate,
+                                        decorations1);
+            sut2.generateColumnOfBlocks(chunkBlocks2, surfaceLevel, x, z, globalCoordinate,
+                                        decorations2);
+            EXPECT_EQ(allBlocksInGivenColumnOfChunk(chunkBlocks1, x, z),
+                      allBlocksInGivenColumnOfChunk(chunkBlocks2, x, z));
+        }
+    }
+}
+
+TEST(ForestBiomeTest, DecorationsOfDifferentChunksAreKeptApartWhenSharingTheBiome)
+{
+    auto surfaceLevel = ForestBiome::SEA_LEVEL + 10;
+    Chunk::ChunkBlocks firstChunkBlocks;
+    Chunk::ChunkBlocks secondChunkBlocks;
+    Biome::Decorations firstChunkDecorations;
+    Biome::Decorations secondChunkDecorations;
+    UglyTestableForestBiome sut(15);
+    sut.chanceToGetTree(1);
+
+    sut.generateColumnOfBlocks(firstChunkBlocks, surfaceLevel, 1, 2, Block::Coordinate(1, 0, 2),
+                               firstChunkDecorations);
+    sut.generateColumnOfBlocks(secondChunkBlocks, surfaceLevel, 3, 4,
+                               Block::Coordinate(19, 0, 4), secondChunkDecorations);
+
+    ASSERT_EQ(firstChunkDecorations.size(), 1);
+    ASSERT_EQ(secondChunkDecorations.size(), 1);
+    EXPECT_EQ(firstChunkDecorations.front().position, Block::Coordinate(1, surfaceLevel + 1, 2));
+    EXPECT_EQ(secondChunkDecorations.front().position, Block::Coordinate(3, surfaceLevel + 1, 4));
+}
+TEST(ForestBiomeTest, TreeSpillingIntoNeighbourChunkIsPlacedAsPartOfGeneration)
+{
+    MockChunk chunk;
+    ForestBiome sut(15);
+    auto treeAtTheEdgeOfChunk =
+        Biome::Decoration{Block::Coordinate(ChunkInterface::BLOCKS_PER_X_DIMENSION - 1,
+                                            ForestBiome::SEA_LEVEL + 10, 8),
+                          6};
+    auto numberOfBlocksPlacedInNeighbourChunk = 0;
+
+    EXPECT_CALL(chunk, tryToPlaceBlock(testing::_, testing::_, testing::_, testing::_,
+                                       testing::Ne(PlacementOrigin::Generation)))
+        .Times(0);
+    EXPECT_CALL(chunk, tryToPlaceBlock(testing::_, testing::_, testing::_, RebuildOperation::None,
+                                       PlacementOrigin::Generation))
+        .WillRepeatedly(
+            [&numberOfBlocksPlacedInNeighbourChunk](
+                const BlockId&, const Block::Coordinate& localCoordinates, std::vector<BlockId>,
+                const RebuildOperation&, const PlacementOrigin&)
+            {
+                if (localCoordinates.x >= ChunkInterface::BLOCKS_PER_X_DIMENSION)
+                {
+                    ++numberOfBlocksPlacedInNeighbourChunk;
+                }
+            });
+
+    sut.postGenerationPlacements(chunk, {treeAtTheEdgeOfChunk});
+
+    EXPECT_GT(numberOfBlocksPlacedInNeighbourChunk, 0);
+}
 
 }// namespace
\ No newline at end of file
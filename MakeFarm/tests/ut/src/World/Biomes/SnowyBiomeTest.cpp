@@ -12,7 +12,7 @@ public:
 
     void chanceToGetTree(int chance)
     {
-        mTreeDecider = std::bernoulli_distribution(chance);
+        mTreeDecider = PositionalBernoulliDistribution(chance);
     }
 };
 
@@ -57,10 +57,12 @@ TEST(SnowyBiomeTest, GeneratedTerrainContainsCorrectTypeOfBlocksAboveSeaLevel)
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = SnowyBiome::SEA_LEVEL + 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableSnowyBiome sut(15);
     sut.chanceToGetTree(0);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     auto expectedSetOfBlocks =
         std::set<BlockId>{BlockId::Air, BlockId::Dirt, BlockId::SnowyGrass, BlockId::Stone};
@@ -72,10 +74,12 @@ TEST(SnowyBiomeTest, GeneratedTerrainContainsCorrectTypeOfBlocksOneBelowSeaLevel
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = SnowyBiome::SEA_LEVEL - 1;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableSnowyBiome sut(15);
     sut.chanceToGetTree(0);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     auto expectedSetOfBlocks =
         std::set<BlockId>{BlockId::Air, BlockId::Dirt, BlockId::SnowyGrass, BlockId::Stone};
@@ -87,10 +91,12 @@ TEST(SnowyBiomeTest, GeneratedTerrainContainsCorrectTypeOfBlocksBelowSeaLevel)
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = SnowyBiome::SEA_LEVEL - 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableSnowyBiome sut(15);
     sut.chanceToGetTree(0);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     auto expectedSetOfBlocks = std::set<BlockId>{BlockId::Air,   BlockId::Dirt,  BlockId::Sand,
                                                  BlockId::Stone, BlockId::Water, BlockId::Ice};
@@ -104,12 +110,16 @@ TEST(SnowyBiomeTest, LogOfTreeShouldBePlacedAboveSea)
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = SnowyBiome::SEA_LEVEL + 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableSnowyBiome sut(15);
     sut.chanceToGetTree(1);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     EXPECT_TRUE(setOfBlocks.contains(BlockId::SpruceLog));
+    ASSERT_EQ(decorations.size(), 1);
+    EXPECT_EQ(decorations.front().position, Block::Coordinate(5, surfaceLevel + 1, 6));
 }
 
 TEST(SnowyBiomeTest, LogOfTreeShouldNotBePlacedBelowSea)
@@ -117,12 +127,15 @@ TEST(SnowyBiomeTest, LogOfTreeShouldNotBePlacedBelowSea)
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = SnowyBiome::SEA_LEVEL - 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableSnowyBiome sut(15);
     sut.chanceToGetTree(1);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     EXPECT_FALSE(setOfBlocks.contains(BlockId::SpruceLog));
+    EXPECT_TRUE(decorations.empty());
 }
 
 
@@ -12,7 +12,7 @@ public:
 
     void chanceToGetTree(int chance)
     {
-        mDryTreeDecider = std::bernoulli_distribution(chance);
+        mDryTreeDecider = PositionalBernoulliDistribution(chance);
     }
 };
 
@@ -57,10 +57,12 @@ TEST(VeryDryForestBiomeTest, GeneratedTerrainContainsCorrectTypeOfBlocksAboveSea
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = VeryDryForestBiome::SEA_LEVEL + 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableVeryDryForestBiome sut(15);
     sut.chanceToGetTree(0);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     auto expectedSetOfBlocks =
         std::set<BlockId>{BlockId::Air, BlockId::Dirt, BlockId::DryGrass, BlockId::Stone};
@@ -72,10 +74,12 @@ TEST(VeryDryForestBiomeTest, GeneratedTerrainContainsCorrectTypeOfBlocksOneBelow
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = VeryDryForestBiome::SEA_LEVEL - 1;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableVeryDryForestBiome sut(15);
     sut.chanceToGetTree(0);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     auto expectedSetOfBlocks =
         std::set<BlockId>{BlockId::Air, BlockId::Dirt, BlockId::Sand, BlockId::Stone};
@@ -87,10 +91,12 @@ TEST(VeryDryForestBiomeTest, GeneratedTerrainContainsCorrectTypeOfBlocksBelowSea
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = VeryDryForestBiome::SEA_LEVEL - 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableVeryDryForestBiome sut(15);
     sut.chanceToGetTree(0);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     auto expectedSetOfBlocks = std::set<BlockId>{BlockId::Air, BlockId::Dirt, BlockId::Sand,
                                                  BlockId::Stone, BlockId::Water};
@@ -104,12 +110,16 @@ TEST(VeryDryForestBiomeTest, LogOfTreeShouldBePlacedAboveSea)
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = VeryDryForestBiome::SEA_LEVEL + 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableVeryDryForestBiome sut(15);
     sut.chanceToGetTree(1);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     EXPECT_TRUE(setOfBlocks.contains(BlockId::Log));
+    ASSERT_EQ(decorations.size(), 1);
+    EXPECT_EQ(decorations.front().position, Block::Coordinate(5, surfaceLevel + 1, 6));
 }
 
 TEST(VeryDryForestBiomeTest, LogOfTreeShouldNotBePlacedBelowSea)
@@ -117,12 +127,15 @@ TEST(VeryDryForestBiomeTest, LogOfTreeShouldNotBePlacedBelowSea)
     auto coordinate = sf::Vector3f(5, 0, 6);
     auto surfaceLevel = VeryDryForestBiome::SEA_LEVEL - 10;
     Chunk::ChunkBlocks chunkBlocks;
+    Biome::Decorations decorations;
     UglyTestableVeryDryForestBiome sut(15);
     sut.chanceToGetTree(1);
 
-    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z);
+    sut.generateColumnOfBlocks(chunkBlocks, surfaceLevel, coordinate.x, coordinate.z,
+                               Block::Coordinate(sf::Vector3i(coordinate)), decorations);
     auto setOfBlocks = allBlocksInGivenColumnOfChunk(chunkBlocks, coordinate.x, coordinate.z);
     EXPECT_FALSE(setOfBlocks.contains(BlockId::Log));
+    EXPECT_TRUE(decorations.empty());
 }
 
 
@@ -0,0 +1,141 @@
+#include "TestUtils/TemporaryDirectoryTest.h"
+#include "World/Chunks/BlockEditJournal.h"
+#include "gtest/gtest.h"
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+
+class BlockEditJournalTest : public TemporaryDirectoryTest
+{
+};
+
+TEST_F(BlockEditJournalTest, EditsAreRecoveredAfterTheWorldIsOpenedAgain)
+{
+    {
+        BlockEditJournal journal(testDirectory.string());
+        journal.append({1, 70, 2}, BlockId::Grass, BlockId::Air);
+        journal.append({-1, 60, -20}, BlockId::Air, BlockId::Planks);
+        journal.append({3, 70, 2}, BlockId::Dirt, BlockId::Stone);
+        journal.flush();
+    }
+
+    BlockEditJournal sut(testDirectory.string());
+
+    const auto recoveredEdits = sut.takeRecoveredEdits({0, 0, 0});
+    ASSERT_EQ(recoveredEdits.size(), 2);
+    EXPECT_EQ(recoveredEdits[0].worldCoordinate, Block::Coordinate(1, 70, 2));
+    EXPECT_EQ(recoveredEdits[0].oldBlockId, BlockId::Grass);
+    EXPECT_EQ(recoveredEdits[0].newBlockId, BlockId::Air);
+    EXPECT_EQ(recoveredEdits[1].worldCoordinate, Block::Coordinate(3, 70, 2));
+    EXPECT_LT(recoveredEdits[0].tick, recoveredEdits[1].tick);
+
+    const auto otherChunkEdits = sut.takeRecoveredEdits({-1, 0, -2});
+    ASSERT_EQ(otherChunkEdits.size(), 1);
+    EXPECT_EQ(otherChunkEdits[0].newBlockId, BlockId::Planks);
+
+    EXPECT_TRUE(sut.takeRecoveredEdits({0, 0, 0}).empty());
+}
+
+TEST_F(BlockEditJournalTest, EntryNotWrittenCompletelyIsIgnored)
+{
+    {
+        BlockEditJournal journal(testDirectory.string());
+        journal.append({1, 70, 2}, BlockId::Grass, BlockId::Air);
+        journal.append({2, 70, 2}, BlockId::Grass, BlockId::Air);
+    }
+    const auto journalPath = testDirectory / "journal.bin";
+    std::filesystem::resize_file(journalPath, std::filesystem::file_size(journalPath) - 1);
+
+    BlockEditJournal sut(testDirectory.string());
+
+    EXPECT_EQ(sut.takeRecoveredEdits({0, 0, 0}).size(), 1);
+}
+
+TEST_F(BlockEditJournalTest, CompactedEditsAreNotRecovered)
+{
+    {
+        BlockEditJournal journal(testDirectory.string());
+        journal.append({1, 70, 2}, BlockId::Grass, BlockId::Air);
+        ASSERT_TRUE(journal.beginCompaction());
+        journal.append({2, 70, 2}, BlockId::Grass, BlockId::Air);
+        journal.finishCompaction();
+    }
+
+    BlockEditJournal sut(testDirectory.string());
+
+    const auto recoveredEdits = sut.takeRecoveredEdits({0, 0, 0});
+    ASSERT_EQ(recoveredEdits.size(), 1);
+    EXPECT_EQ(recoveredEdits[0].worldCoordinate, Block::Coordinate(2, 70, 2));
+}
+
+TEST_F(BlockEditJournalTest, UnfinishedCompactionKeepsTheEdits)
+{
+    {
+        BlockEditJournal journal(testDirectory.string());
+        journal.append({1, 70, 2}, BlockId::Grass, BlockId::Air);
+        ASSERT_TRUE(journal.beginCompaction());
+        journal.append({2, 70, 2}, BlockId::Grass, BlockId::Air);
+    }
+
+    BlockEditJournal sut(testDirectory.string());
+
+    EXPECT_EQ(sut.takeRecoveredEdits({0, 0, 0}).size(), 2);
+}
+
+TEST_F(BlockEditJournalTest, RecoveredEditsNotTakenSurviveTheCompaction)
+{
+    {
+        BlockEditJournal journal(testDirectory.string());
+        journal.append({1, 70, 2}, BlockId::Grass, BlockId::Air);
+        journal.append({40, 70, 2}, BlockId::Grass, BlockId::Air);
+    }
+    {
+        BlockEditJournal journal(testDirectory.string());
+        EXPECT_EQ(journal.takeRecoveredEdits({0, 0, 0}).size(), 1);
+        ASSERT_TRUE(journal.beginCompaction());
+        journal.finishCompaction();
+    }
+
+    BlockEditJournal sut(testDirectory.string());
+
+    EXPECT_TRUE(sut.takeRecoveredEdits({0, 0, 0}).empty());
+    EXPECT_EQ(sut.takeRecoveredEdits({2, 0, 0}).size(), 1);
+}
+
+TEST_F(BlockEditJournalTest, JournalOfUnsupportedFormatIsMovedAside)
+{
+    const auto journalPath = testDirectory / "journal.bin";
+    {
+        std::ofstream file(journalPath, std::ios::binary);
+        file << "NOT A JOURNAL";
+    }
+
+    BlockEditJournal sut(testDirectory.string());
+    sut.append({1, 70, 2}, BlockId::Grass, BlockId::Air);
+
+    EXPECT_TRUE(sut.takeRecoveredEdits({0, 0, 0}).empty());
+    EXPECT_TRUE(std::filesystem::exists(testDirectory / "journal.bin.damaged"));
+}
+
+TEST_F(BlockEditJournalTest, JournalIsContinuedWhenCompactionCannotBegin)
+{
+    const auto compactedJournalPath = testDirectory / "journal_compacted.bin";
+    {
+        BlockEditJournal journal(testDirectory.string());
+        journal.append({1, 70, 2}, BlockId::Grass, BlockId::Air);
+
+        // A directory in place of the compacted journal cannot be replaced by a file
+        std::filesystem::create_directories(compactedJournalPath / "occupied");
+        EXPECT_FALSE(journal.beginCompaction());
+        journal.append({2, 70, 2}, BlockId::Grass, BlockId::Air);
+    }
+    std::filesystem::remove_all(compactedJournalPath);
+
+    BlockEditJournal sut(testDirectory.string());
+
+    EXPECT_EQ(sut.takeRecoveredEdits({0, 0, 0}).size(), 2);
+}
+
+}// namespace
@@ -0,0 +1,89 @@
+#include "World/Chunks/BlockRegion.h"
+#include "World/Block/BlockType.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+class BlockRegionTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        BlockType stoneType;
+        stoneType.id = BlockId::Stone;
+        stone = ChunkOccupancy::properties(stoneType);
+
+        BlockType waterType;
+        waterType.id = BlockId::Water;
+        waterType.transparent = true;
+        waterType.collidable = false;
+        water = ChunkOccupancy::properties(waterType);
+    }
+
+    ChunkOccupancy::Properties stone = 0;
+    ChunkOccupancy::Properties water = 0;
+    BlockRegion sut{Block::Coordinate(-1, 10, -1), Block::Coordinate(1, 12, 1)};
+};
+
+TEST_F(BlockRegionTest, ShouldContainOnlyBlocksBetweenItsCorners)
+{
+    EXPECT_TRUE(sut.contains(Block::Coordinate(-1, 10, -1)));
+    EXPECT_TRUE(sut.contains(Block::Coordinate(1, 12, 1)));
+    EXPECT_FALSE(sut.contains(Block::Coordinate(2, 12, 1)));
+    EXPECT_FALSE(sut.contains(Block::Coordinate(0, 9, 0)));
+}
+
+TEST_F(BlockRegionTest, ShouldReturnPropertiesOfGatheredBlock)
+{
+    sut.setProperties(Block::Coordinate(0, 11, 1), stone);
+
+    EXPECT_EQ(sut.properties(Block::Coordinate(0, 11, 1)), stone);
+    EXPECT_EQ(sut.properties(Block::Coordinate(1, 11, 0)), 0);
+}
+
+TEST_F(BlockRegionTest, ShouldNotReturnPropertiesOfBlockOutsideTheRegion)
+{
+    EXPECT_EQ(sut.properties(Block::Coordinate(5, 11, 0)), 0);
+    EXPECT_FALSE(sut.isCollidable(Block::Coordinate(5, 11, 0)));
+}
+
+TEST_F(BlockRegionTest, ShouldTreatOnlyCollidableBlocksAsCollidable)
+{
+    sut.setProperties(Block::Coordinate(-1, 10, -1), stone);
+    sut.setProperties(Block::Coordinate(1, 12, 1), water);
+
+    EXPECT_TRUE(sut.isCollidable(Block::Coordinate(-1, 10, -1)));
+    EXPECT_FALSE(sut.isCollidable(Block::Coordinate(1, 12, 1)));
+    EXPECT_FALSE(sut.isCollidable(Block::Coordinate(0, 11, 0)));
+}
+
+TEST_F(BlockRegionTest, ShouldFindBlockTouchingTheBox)
+{
+    sut.setProperties(Block::Coordinate(1, 12, 0), water);
+    const auto blockSize = static_cast<float>(Block::BLOCK_SIZE);
+
+    EXPECT_TRUE(sut.isAnyBlockTouching({0.5f * blockSize, 11.5f * blockSize, 0.5f * blockSize},
+                                       {1.5f * blockSize, 12.5f * blockSize, 0.5f * blockSize},
+                                       BlockProperty::Fluid));
+    EXPECT_FALSE(sut.isAnyBlockTouching({0.5f * blockSize, 11.5f * blockSize, 0.5f * blockSize},
+                                        {0.9f * blockSize, 12.5f * blockSize, 0.5f * blockSize},
+                                        BlockProperty::Fluid));
+    EXPECT_FALSE(sut.isAnyBlockTouching({0.5f * blockSize, 11.5f * blockSize, 0.5f * blockSize},
+                                        {1.5f * blockSize, 12.5f * blockSize, 0.5f * blockSize},
+                                        BlockProperty::Collidable));
+}
+
+TEST_F(BlockRegionTest, ShouldThrowWhenRegionIsTooLarge)
+{
+    EXPECT_THROW(BlockRegion(Block::Coordinate(0, 0, 0), Block::Coordinate(7, 7, 8)),
+                 std::runtime_error);
+}
+
+TEST_F(BlockRegionTest, ShouldThrowWhenRegionIsEmpty)
+{
+    EXPECT_THROW(BlockRegion(Block::Coordinate(0, 0, 0), Block::Coordinate(0, -1, 0)),
+                 std::runtime_error);
+}
+
+}// namespace
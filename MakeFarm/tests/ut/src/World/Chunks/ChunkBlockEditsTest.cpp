@@ -0,0 +1,88 @@
+#include "World/Chunks/ChunkBlockEdits.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+int indexOf(int x, int y, int z)
+{
+    return x + ChunkInterface::BLOCKS_PER_X_DIMENSION *
+                   (y + ChunkInterface::BLOCKS_PER_Y_DIMENSION * z);
+}
+
+TEST(ChunkBlockEditsTest, EditsOfAllSectionsAreMerged)
+{
+    const ChunkCodec::BlockEdits blockEdits = {{indexOf(0, 0, 0), BlockId::Stone},
+                                               {indexOf(15, 126, 15), BlockId::Air},
+                                               {indexOf(3, 60, 7), BlockId::Planks}};
+
+    const ChunkBlockEdits sut(blockEdits);
+
+    EXPECT_EQ(sut.size(), 3);
+    EXPECT_TRUE(sut.contains(indexOf(3, 60, 7)));
+    EXPECT_FALSE(sut.contains(indexOf(3, 61, 7)));
+    EXPECT_EQ(sut.merged(), blockEdits);
+}
+
+TEST(ChunkBlockEditsTest, ChangingTheSameBlockAgainDoesNotIncreaseTheSize)
+{
+    ChunkBlockEdits sut;
+
+    sut.set(indexOf(1, 1, 1), BlockId::Air);
+    sut.set(indexOf(1, 1, 1), BlockId::Planks);
+
+    EXPECT_EQ(sut.size(), 1);
+    EXPECT_EQ(sut.merged().at(indexOf(1, 1, 1)), BlockId::Planks);
+}
+
+TEST(ChunkBlockEditsTest, SnapshotDoesNotSeeLaterChanges)
+{
+    ChunkBlockEdits sut;
+    sut.set(indexOf(1, 10, 1), BlockId::Air);
+    sut.set(indexOf(1, 100, 1), BlockId::Air);
+
+    const auto snapshot = sut.snapshot();
+    sut.set(indexOf(1, 10, 1), BlockId::Planks);
+    sut.set(indexOf(2, 20, 2), BlockId::Stone);
+
+    const ChunkCodec::BlockEdits snapshotBlockEdits = {{indexOf(1, 10, 1), BlockId::Air},
+                                                       {indexOf(1, 100, 1), BlockId::Air}};
+    EXPECT_EQ(snapshot.merged(), snapshotBlockEdits);
+    EXPECT_EQ(snapshot.size(), 2);
+    EXPECT_EQ(sut.size(), 3);
+    EXPECT_EQ(sut.merged().at(indexOf(1, 10, 1)), BlockId::Planks);
+}
+
+TEST(ChunkBlockEditsTest, EditsDoNotSeeChangesOfTheirSnapshotCopies)
+{
+    ChunkBlockEdits sut;
+    sut.set(indexOf(1, 10, 1), BlockId::Air);
+    auto snapshot = sut.snapshot();
+
+    // The snapshot may be released before the next change, the section is still not reused
+    auto copyOfSnapshot = std::move(snapshot);
+    copyOfSnapshot.set(indexOf(1, 10, 1), BlockId::Stone);
+    sut.set(indexOf(2, 10, 2), BlockId::Planks);
+
+    const ChunkCodec::BlockEdits copyOfSnapshotBlockEdits = {{indexOf(1, 10, 1), BlockId::Stone}};
+    const ChunkCodec::BlockEdits blockEdits = {{indexOf(1, 10, 1), BlockId::Air},
+                                               {indexOf(2, 10, 2), BlockId::Planks}};
+    EXPECT_EQ(copyOfSnapshot.merged(), copyOfSnapshotBlockEdits);
+    EXPECT_EQ(sut.merged(), blockEdits);
+}
+
+TEST(ChunkBlockEditsTest, CopyDoesNotShareSectionsStillChangedByTheCopiedEdits)
+{
+    ChunkBlockEdits sut;
+    sut.set(indexOf(1, 10, 1), BlockId::Air);
+
+    const auto copy = sut;
+    sut.set(indexOf(2, 10, 2), BlockId::Planks);
+
+    const ChunkCodec::BlockEdits copyBlockEdits = {{indexOf(1, 10, 1), BlockId::Air}};
+    EXPECT_EQ(copy.merged(), copyBlockEdits);
+    EXPECT_EQ(copy.size(), 1);
+    EXPECT_EQ(sut.size(), 2);
+}
+
+}// namespace
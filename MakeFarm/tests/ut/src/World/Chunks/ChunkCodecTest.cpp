@@ -0,0 +1,96 @@
+#include "World/Chunks/ChunkCodec.h"
+#include "World/Chunks/ChunkInterface.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+int indexOf(int x, int y, int z)
+{
+    return x + ChunkInterface::BLOCKS_PER_X_DIMENSION *
+                   (y + ChunkInterface::BLOCKS_PER_Y_DIMENSION * z);
+}
+
+ChunkCodec::BlockEdits roundTrip(const ChunkCodec::BlockEdits& blockEdits)
+{
+    const auto encoded = ChunkCodec::encode(blockEdits);
+    return ChunkCodec::decode(encoded.data(), encoded.size());
+}
+
+TEST(ChunkCodecTest, EmptyEditsAreDecodedAsEmpty)
+{
+    EXPECT_TRUE(roundTrip({}).empty());
+}
+
+TEST(ChunkCodecTest, ScatteredEditsAreDecodedUnchanged)
+{
+    const ChunkCodec::BlockEdits blockEdits = {{indexOf(0, 0, 0), BlockId::Stone},
+                                               {indexOf(15, 126, 15), BlockId::Air},
+                                               {indexOf(3, 60, 7), BlockId::Planks},
+                                               {indexOf(3, 61, 7), BlockId::Planks},
+                                               {indexOf(4, 61, 7), BlockId::Water}};
+
+    EXPECT_EQ(roundTrip(blockEdits), blockEdits);
+}
+
+TEST(ChunkCodecTest, WholeChunkIsDecodedUnchanged)
+{
+    ChunkCodec::BlockEdits blockEdits;
+    for (auto x = 0; x < ChunkInterface::BLOCKS_PER_X_DIMENSION; ++x)
+    {
+        for (auto y = 0; y < ChunkInterface::BLOCKS_PER_Y_DIMENSION; ++y)
+        {
+            for (auto z = 0; z < ChunkInterface::BLOCKS_PER_Z_DIMENSION; ++z)
+            {
+                blockEdits[indexOf(x, y, z)] = (y < 40 + x) ? BlockId::Stone : BlockId::Air;
+            }
+        }
+    }
+
+    EXPECT_EQ(roundTrip(blockEdits), blockEdits);
+}
+
+TEST(ChunkCodecTest, VerticalRunsAreEncodedCompactly)
+{
+    ChunkCodec::BlockEdits blockEdits;
+    for (auto y = 0; y < ChunkInterface::BLOCKS_PER_Y_DIMENSION; ++y)
+    {
+        blockEdits[indexOf(5, y, 5)] = BlockId::Air;
+    }
+
+    EXPECT_LT(ChunkCodec::encode(blockEdits).size(), 16u);
+}
+
+TEST(ChunkCodecTest, UnsupportedVersionThrows)
+{
+    auto encoded = ChunkCodec::encode({{indexOf(1, 2, 3), BlockId::Dirt}});
+    encoded.front() = ChunkCodec::FORMAT_VERSION + 1;
+
+    EXPECT_THROW(ChunkCodec::decode(encoded.data(), encoded.size()), std::runtime_error);
+}
+
+TEST(ChunkCodecTest, TruncatedDataThrows)
+{
+    const auto encoded = ChunkCodec::encode({{indexOf(1, 2, 3), BlockId::Dirt}});
+
+    EXPECT_THROW(ChunkCodec::decode(encoded.data(), encoded.size() - 1), std::runtime_error);
+}
+
+TEST(ChunkCodecTest, RunOutsideOfChunkThrows)
+{
+    auto encoded = ChunkCodec::encode({{indexOf(15, 126, 15), BlockId::Dirt}});
+    // The last two bytes are the length and the palette index of the only run
+    encoded[encoded.size() - 2] = 2;
+
+    EXPECT_THROW(ChunkCodec::decode(encoded.data(), encoded.size()), std::runtime_error);
+}
+TEST(ChunkCodecTest, UnknownBlockInPaletteThrows)
+{
+    auto encoded = ChunkCodec::encode({{indexOf(1, 2, 3), BlockId::Dirt}});
+    // The version and the size of the palette are followed by its only entry
+    encoded[2] = static_cast<unsigned char>(BlockId::Counter);
+
+    EXPECT_THROW(ChunkCodec::decode(encoded.data(), encoded.size()), std::runtime_error);
+}
+
+}// namespace
@@ -188,13 +188,15 @@ TEST_F(ChunkContainerTest, ShouldPlaceBlockToExistingChunk)
     auto blockCoordinate = Block::Coordinate(1, 5, 2);
     auto blockOverplaced = std::vector<BlockId>{BlockId::AllBlocks};
     auto rebuildOperation = RebuildOperation::None;
+    auto placementOrigin = PlacementOrigin::NeighbourGeneration;
 
     EXPECT_CALL(*mockChunk1, globalToLocalCoordinates(blockCoordinate))
         .WillOnce(testing::Return(blockCoordinate));
-    EXPECT_CALL(*mockChunk1,
-                tryToPlaceBlock(blockId, blockCoordinate, blockOverplaced, rebuildOperation));
+    EXPECT_CALL(*mockChunk1, tryToPlaceBlock(blockId, blockCoordinate, blockOverplaced,
+                                             rebuildOperation, placementOrigin));
 
-    sut.tryToPlaceBlock(blockId, blockCoordinate, blockOverplaced, rebuildOperation);
+    sut.tryToPlaceBlock(blockId, blockCoordinate, blockOverplaced, rebuildOperation,
+                        placementOrigin);
 }
 
 TEST_F(ChunkContainerTest, ShouldNotPlaceBlockToNonExistingChunk)
@@ -203,12 +205,52 @@ TEST_F(ChunkContainerTest, ShouldNotPlaceBlockToNonExistingChunk)
     auto blockCoordinate = Block::Coordinate(-1, 5, 2);
     auto blockOverplaced = std::vector<BlockId>{BlockId::AllBlocks};
     auto rebuildOperation = RebuildOperation::None;
+    auto placementOrigin = PlacementOrigin::NeighbourGeneration;
 
-    EXPECT_CALL(*mockChunk1,
-                tryToPlaceBlock(blockId, blockCoordinate, blockOverplaced, rebuildOperation))
+    EXPECT_CALL(*mockChunk1, tryToPlaceBlock(blockId, blockCoordinate, blockOverplaced,
+                                             rebuildOperation, placementOrigin))
         .Times(0);
 
-    sut.tryToPlaceBlock(blockId, blockCoordinate, blockOverplaced, rebuildOperation);
+    sut.tryToPlaceBlock(blockId, blockCoordinate, blockOverplaced, rebuildOperation,
+                        placementOrigin);
+}
+
+TEST_F(ChunkContainerTest, ShouldGatherBlockRegionFromEveryChunkItSpansOnce)
+{
+    EXPECT_CALL(*mockChunk1, copyBlocksTo(testing::_)).Times(1);
+    EXPECT_CALL(*mockChunk2, copyBlocksTo(testing::_)).Times(1);
+    [[maybe_unused]] auto region =
+        sut.blockRegion(Block::Coordinate(14, 5, 14), Block::Coordinate(15, 6, 17));
+}
+
+TEST_F(ChunkContainerTest, ShouldGatherBlockRegionOnlyFromChunksItSpans)
+{
+    EXPECT_CALL(*mockChunk1, copyBlocksTo(testing::_)).Times(1);
+    EXPECT_CALL(*mockChunk2, copyBlocksTo(testing::_)).Times(0);
+    [[maybe_unused]] auto region =
+        sut.blockRegion(Block::Coordinate(1, 5, 1), Block::Coordinate(3, 6, 3));
+}
+
+TEST_F(ChunkContainerTest, ShouldCollideWhenChunkHasCollidableBlockInsideTheBox)
+{
+    auto aabb = AABB({0.5f, 1.5f, 0.5f});
+    aabb.updatePosition(sf::Vector3f(2.25f, 5.25f, 2.25f), AABB::RelativeTo::LeftBottomBack);
+    EXPECT_CALL(*mockChunk1, isAnyBlockWithProperty(Block::Coordinate(2, 5, 2),
+                                                    Block::Coordinate(2, 6, 2),
+                                                    BlockProperty::Collidable))
+        .WillOnce(testing::Return(true));
+    EXPECT_TRUE(sut.doesItCollide(aabb));
+}
+
+TEST_F(ChunkContainerTest, ShouldNotCollideWhenNoChunkHasCollidableBlockInsideTheBox)
+{
+    auto aabb = AABB({0.5f, 1.5f, 0.5f});
+    aabb.updatePosition(sf::Vector3f(2.25f, 5.25f, 15.75f), AABB::RelativeTo::LeftBottomBack);
+    EXPECT_CALL(*mockChunk1, isAnyBlockWithProperty(testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(false));
+    EXPECT_CALL(*mockChunk2, isAnyBlockWithProperty(testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(false));
+    EXPECT_FALSE(sut.doesItCollide(aabb));
 }
 
 TEST_F(ChunkContainerTest, ShouldReturnProperSize)
@@ -0,0 +1,139 @@
+#include "World/Chunks/ChunkOccupancy.h"
+#include "World/Block/BlockType.h"
+#include "World/Chunks/BlockRegion.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+class ChunkOccupancyTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        air.id = BlockId::Air;
+        air.transparent = true;
+        air.collidable = false;
+
+        stone.id = BlockId::Stone;
+
+        water.id = BlockId::Water;
+        water.transparent = true;
+        water.collidable = false;
+    }
+
+    BlockType air;
+    BlockType stone;
+    BlockType water;
+    ChunkOccupancy sut;
+};
+
+TEST_F(ChunkOccupancyTest, ShouldDeriveBlockPropertiesFromItsType)
+{
+    const auto stoneProperties = ChunkOccupancy::properties(stone);
+    EXPECT_TRUE(ChunkOccupancy::hasProperty(stoneProperties, BlockProperty::Collidable));
+    EXPECT_TRUE(ChunkOccupancy::hasProperty(stoneProperties, BlockProperty::Opaque));
+    EXPECT_FALSE(ChunkOccupancy::hasProperty(stoneProperties, BlockProperty::Fluid));
+    EXPECT_TRUE(ChunkOccupancy::hasProperty(stoneProperties, BlockProperty::NonAir));
+
+    const auto waterProperties = ChunkOccupancy::properties(water);
+    EXPECT_FALSE(ChunkOccupancy::hasProperty(waterProperties, BlockProperty::Collidable));
+    EXPECT_FALSE(ChunkOccupancy::hasProperty(waterProperties, BlockProperty::Opaque));
+    EXPECT_TRUE(ChunkOccupancy::hasProperty(waterProperties, BlockProperty::Fluid));
+    EXPECT_TRUE(ChunkOccupancy::hasProperty(waterProperties, BlockProperty::NonAir));
+
+    EXPECT_EQ(ChunkOccupancy::properties(air), 0);
+}
+
+TEST_F(ChunkOccupancyTest, ShouldHaveNoPropertiesAtTheBeginning)
+{
+    EXPECT_EQ(sut.properties({3, 40, 7}), 0);
+    for (auto section = 0; section < ChunkOccupancy::NUMBER_OF_SECTIONS; ++section)
+    {
+        EXPECT_TRUE(sut.isSectionOnlyAir(section));
+    }
+}
+
+TEST_F(ChunkOccupancyTest, ShouldRememberPropertiesOfUpdatedBlock)
+{
+    sut.update({3, 40, 7}, stone);
+
+    EXPECT_EQ(sut.properties({3, 40, 7}), ChunkOccupancy::properties(stone));
+    EXPECT_TRUE(sut.hasProperty({3, 40, 7}, BlockProperty::Collidable));
+    EXPECT_FALSE(sut.hasProperty({4, 40, 7}, BlockProperty::Collidable));
+    EXPECT_FALSE(sut.hasProperty({3, 41, 7}, BlockProperty::Collidable));
+    EXPECT_FALSE(sut.hasProperty({3, 40, 8}, BlockProperty::Collidable));
+}
+
+TEST_F(ChunkOccupancyTest, ShouldClearPropertiesWhenBlockIsReplaced)
+{
+    sut.update({15, 126, 15}, stone);
+    sut.update({15, 126, 15}, water);
+
+    EXPECT_FALSE(sut.hasProperty({15, 126, 15}, BlockProperty::Collidable));
+    EXPECT_TRUE(sut.hasProperty({15, 126, 15}, BlockProperty::Fluid));
+
+    sut.update({15, 126, 15}, air);
+    EXPECT_EQ(sut.properties({15, 126, 15}), 0);
+    EXPECT_TRUE(sut.isSectionOnlyAir(126 / ChunkOccupancy::BLOCKS_PER_SECTION_Y_DIMENSION));
+}
+
+TEST_F(ChunkOccupancyTest, ShouldTellWhichSectionsAreOnlyAir)
+{
+    sut.update({0, 17, 0}, water);
+
+    EXPECT_TRUE(sut.isSectionOnlyAir(0));
+    EXPECT_FALSE(sut.isSectionOnlyAir(1));
+    EXPECT_TRUE(sut.isSectionOnlyAir(2));
+}
+
+TEST_F(ChunkOccupancyTest, ShouldFindBlockWithPropertyInsideBox)
+{
+    sut.update({5, 31, 9}, stone);
+
+    EXPECT_TRUE(sut.isAnyBlockWithProperty({5, 31, 9}, {5, 31, 9}, BlockProperty::Collidable));
+    EXPECT_TRUE(sut.isAnyBlockWithProperty({0, 20, 0}, {15, 40, 15}, BlockProperty::Collidable));
+    EXPECT_TRUE(sut.isAnyBlockWithProperty({4, 30, 8}, {6, 32, 10}, BlockProperty::NonAir));
+    EXPECT_FALSE(sut.isAnyBlockWithProperty({4, 30, 8}, {6, 32, 10}, BlockProperty::Fluid));
+}
+
+TEST_F(ChunkOccupancyTest, ShouldNotFindBlockWithPropertyNextToBox)
+{
+    sut.update({5, 31, 9}, stone);
+
+    EXPECT_FALSE(sut.isAnyBlockWithProperty({6, 31, 9}, {15, 31, 9}, BlockProperty::Collidable));
+    EXPECT_FALSE(sut.isAnyBlockWithProperty({0, 31, 9}, {4, 31, 9}, BlockProperty::Collidable));
+    EXPECT_FALSE(sut.isAnyBlockWithProperty({5, 32, 9}, {5, 60, 9}, BlockProperty::Collidable));
+    EXPECT_FALSE(sut.isAnyBlockWithProperty({0, 0, 10}, {15, 126, 15}, BlockProperty::Collidable));
+}
+
+TEST_F(ChunkOccupancyTest, ShouldFindPartOfBoxInsideChunk)
+{
+    const auto chunkPosition = Block::Coordinate(16, 0, 16);
+
+    const auto [localMin, localMax] =
+        ChunkOccupancy::localPartOfBox({14, 4, 14}, {17, 6, 17}, chunkPosition);
+    EXPECT_EQ(localMin, Block::Coordinate(0, 4, 0));
+    EXPECT_EQ(localMax, Block::Coordinate(1, 6, 1));
+
+    const auto [outsideMin, outsideMax] =
+        ChunkOccupancy::localPartOfBox({0, 0, 0}, {3, 3, 3}, chunkPosition);
+    EXPECT_GT(outsideMin.x, outsideMax.x);
+}
+
+TEST_F(ChunkOccupancyTest, ShouldCopyOnlyBlocksOfChunkToRegion)
+{
+    const auto chunkPosition = Block::Coordinate(16, 0, 16);
+    sut.update({0, 5, 0}, stone);
+    sut.update({1, 5, 0}, water);
+    BlockRegion region({14, 4, 14}, {17, 6, 17});
+
+    sut.copyTo(region, chunkPosition);
+
+    EXPECT_EQ(region.properties({16, 5, 16}), ChunkOccupancy::properties(stone));
+    EXPECT_EQ(region.properties({17, 5, 16}), ChunkOccupancy::properties(water));
+    EXPECT_EQ(region.properties({17, 6, 17}), 0);
+    EXPECT_EQ(region.properties({15, 5, 15}), 0);
+}
+
+}// namespace
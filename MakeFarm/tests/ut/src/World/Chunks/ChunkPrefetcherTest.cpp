@@ -0,0 +1,75 @@
+#include "TestUtils/TemporaryDirectoryTest.h"
+#include "World/Chunks/ChunkPrefetcher.h"
+#include "World/Chunks/ChunkSaveQueue.h"
+#include "World/Chunks/ChunkStorage.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+namespace
+{
+
+class ChunkPrefetcherTest : public TemporaryDirectoryTest
+{
+};
+
+TEST_F(ChunkPrefetcherTest, PrefetchedChunksAreReadBack)
+{
+    ChunkStorage storage(testDirectory.string());
+    const std::vector<unsigned char> firstData(300, 1);
+    const std::vector<unsigned char> secondData(20, 2);
+    storage.writeChunk({0, 0, 0}, firstData);
+    storage.writeChunk({-40, 0, 3}, secondData);
+    ChunkSaveQueue saveQueue(storage);
+    ChunkPrefetcher sut(storage, saveQueue);
+
+    sut.prefetch({{0, 0, 0}, {-40, 0, 3}, {5, 0, 5}});
+
+    std::vector<unsigned char> buffer;
+    EXPECT_TRUE(sut.readChunk({0, 0, 0}, buffer));
+    EXPECT_EQ(buffer, firstData);
+    EXPECT_TRUE(sut.readChunk({-40, 0, 3}, buffer));
+    EXPECT_EQ(buffer, secondData);
+    EXPECT_FALSE(sut.readChunk({5, 0, 5}, buffer));
+}
+
+TEST_F(ChunkPrefetcherTest, ChunksThatWereNotPrefetchedAreReadFromTheStorage)
+{
+    ChunkStorage storage(testDirectory.string());
+    const std::vector<unsigned char> data(100, 7);
+    storage.writeChunk({2, 0, 2}, data);
+    ChunkSaveQueue saveQueue(storage);
+    ChunkPrefetcher sut(storage, saveQueue);
+
+    sut.prefetch({{9, 0, 9}});
+
+    std::vector<unsigned char> buffer;
+    EXPECT_TRUE(sut.readChunk({2, 0, 2}, buffer));
+    EXPECT_EQ(buffer, data);
+    EXPECT_FALSE(sut.readChunk({3, 0, 3}, buffer));
+}
+
+TEST_F(ChunkPrefetcherTest, ChunkSavedWhilePrefetchedIsReadWithItsNewestData)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue saveQueue(storage);
+    ChunkPrefetcher sut(storage, saveQueue);
+    const ChunkContainer::Coordinate chunkCoordinate(1, 0, -1);
+
+    // The save lands before, during or after the read ahead, depending on the round
+    std::vector<unsigned char> buffer;
+    for (auto round = 0; round < 50; ++round)
+    {
+        storage.writeChunk(chunkCoordinate, std::vector<unsigned char>(50, round));
+        sut.prefetch({chunkCoordinate});
+        std::this_thread::sleep_for(std::chrono::microseconds(round * 100));
+        const std::vector<unsigned char> newestData(60, round + 1);
+        storage.writeChunk(chunkCoordinate, newestData);
+
+        ASSERT_TRUE(sut.readChunk(chunkCoordinate, buffer));
+        ASSERT_EQ(buffer, newestData);
+    }
+}
+
+}// namespace
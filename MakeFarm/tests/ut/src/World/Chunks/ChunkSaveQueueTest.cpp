@@ -0,0 +1,312 @@
+#include "TestUtils/TemporaryDirectoryTest.h"
+#include "World/Chunks/ChunkSaveQueue.h"
+#include "World/Chunks/ChunkStorage.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace
+{
+
+class ChunkSaveQueueTest : public TemporaryDirectoryTest
+{
+protected:
+    static ChunkSaveQueue::Snapshot snapshotOf(const ChunkCodec::BlockEdits& blockEdits)
+    {
+        return std::make_shared<const ChunkBlockEdits>(ChunkBlockEdits(blockEdits).snapshot());
+    }
+
+    static ChunkCodec::BlockEdits savedBlockEdits(ChunkStorage& storage,
+                                                  const ChunkContainer::Coordinate& coordinate)
+    {
+        const auto savedData = storage.readChunk(coordinate);
+        EXPECT_TRUE(savedData.has_value());
+        EXPECT_EQ(savedData->front(),
+                  static_cast<unsigned char>(SavedChunkFormat::EncodedBlockEdits));
+        return ChunkCodec::decode(savedData->data() + 1, savedData->size() - 1);
+    }
+
+    const ChunkContainer::Coordinate coordinate = {1, 0, -2};
+};
+
+TEST_F(ChunkSaveQueueTest, FlushWritesEverySnapshotToTheStorage)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+    const ChunkCodec::BlockEdits blockEdits = {{0, BlockId::Stone}, {500, BlockId::Air}};
+
+    sut.push(coordinate, snapshotOf(blockEdits));
+    sut.flush();
+
+    EXPECT_EQ(savedBlockEdits(storage, coordinate), blockEdits);
+    EXPECT_EQ(sut.pendingSnapshot(coordinate), nullptr);
+}
+
+TEST_F(ChunkSaveQueueTest, NewestSnapshotOfTheChunkIsSaved)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+    const ChunkCodec::BlockEdits newestBlockEdits = {{7, BlockId::Planks}};
+
+    sut.push(coordinate, snapshotOf({{7, BlockId::Stone}, {8, BlockId::Stone}}));
+    sut.push(coordinate, snapshotOf(newestBlockEdits));
+    sut.flush();
+
+    EXPECT_EQ(savedBlockEdits(storage, coordinate), newestBlockEdits);
+}
+
+TEST_F(ChunkSaveQueueTest, FlushWritesSnapshotsOfManyChunks)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+
+    for (auto x = 0; x < 64; ++x)
+    {
+        sut.push({x, 0, 0}, snapshotOf({{x, BlockId::Stone}}));
+        sut.push({x, 0, 0}, snapshotOf({{x, BlockId::Planks}}));
+    }
+    sut.flush();
+
+    for (auto x = 0; x < 64; ++x)
+    {
+        const ChunkCodec::BlockEdits blockEdits = {{x, BlockId::Planks}};
+        EXPECT_EQ(savedBlockEdits(storage, {x, 0, 0}), blockEdits);
+    }
+}
+
+TEST_F(ChunkSaveQueueTest, EmptySnapshotRemovesTheChunkFromTheStorage)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+
+    sut.push(coordinate, snapshotOf({{7, BlockId::Planks}}));
+    sut.flush();
+    sut.push(coordinate, snapshotOf({}));
+    sut.flush();
+
+    EXPECT_FALSE(storage.doesChunkExist(coordinate));
+}
+
+TEST_F(ChunkSaveQueueTest, DestroyedQueueSavesEverythingThatWasWaiting)
+{
+    ChunkStorage storage(testDirectory.string());
+    const ChunkCodec::BlockEdits blockEdits = {{12, BlockId::Sand}};
+    {
+        ChunkSaveQueue sut(storage);
+        sut.push(coordinate, snapshotOf(blockEdits));
+    }
+
+    EXPECT_EQ(savedBlockEdits(storage, coordinate), blockEdits);
+}
+
+TEST_F(ChunkSaveQueueTest, StatisticsCountPerformedAndSkippedSaves)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+
+    sut.push(coordinate, snapshotOf({{7, BlockId::Planks}}));
+    sut.flush();
+    sut.countSkippedSave();
+    sut.countSkippedSave();
+
+    const auto statistics = sut.statistics();
+    EXPECT_EQ(statistics.performedSaves, 1);
+    EXPECT_EQ(statistics.skippedSaves, 2);
+}
+
+TEST_F(ChunkSaveQueueTest, FileIsWrittenWithTheNewestData)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+    const auto pathToFile = (testDirectory / "player" / "player.bin").string();
+
+    sut.pushFile(pathToFile, {1, 2, 3});
+    sut.pushFile(pathToFile, {4, 5});
+    sut.flush();
+
+    std::ifstream file(pathToFile, std::ios::binary);
+    const std::vector<unsigned char> savedData((std::istreambuf_iterator<char>(file)),
+                                               std::istreambuf_iterator<char>());
+    EXPECT_EQ(savedData, std::vector<unsigned char>({4, 5}));
+    EXPECT_FALSE(std::filesystem::exists(pathToFile + ".tmp"));
+}
+
+TEST_F(ChunkSaveQueueTest, StatisticsCountWrittenBytes)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+
+    sut.pushFile((testDirectory / "inventory.bin").string(), std::vector<unsigned char>(100));
+    sut.flush();
+
+    EXPECT_EQ(sut.statistics().writtenBytes, 100);
+}
+
+TEST_F(ChunkSaveQueueTest, WritesDoNotExceedTheBandwidthLimit)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+    sut.limitBandwidth(10000);
+    const auto batch = sut.beginBatch(true);
+
+    const auto start = std::chrono::steady_clock::now();
+    sut.pushFile((testDirectory / "first.bin").string(), std::vector<unsigned char>(1000), batch);
+    sut.pushFile((testDirectory / "second.bin").string(), std::vector<unsigned char>(1000), batch);
+    sut.pushFile((testDirectory / "third.bin").string(), std::vector<unsigned char>(1000), batch);
+    sut.waitForBatch(batch);
+
+    // The first write starts right away, and each of the next ones 100ms after the previous one
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(200));
+}
+
+TEST_F(ChunkSaveQueueTest, SavesOutsideOfLimitedBatchesIgnoreTheBandwidthLimit)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+    sut.limitBandwidth(1000);
+
+    const auto start = std::chrono::steady_clock::now();
+    sut.pushFile((testDirectory / "first.bin").string(), std::vector<unsigned char>(1000));
+    sut.pushFile((testDirectory / "second.bin").string(), std::vector<unsigned char>(1000));
+    sut.push(coordinate, snapshotOf({{7, BlockId::Planks}}));
+    sut.flush();
+
+    // Within the limit the writes would take two seconds
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+}
+
+TEST_F(ChunkSaveQueueTest, BatchCountsOnlyItsOwnWrites)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+    const auto batch = sut.beginBatch(false);
+
+    sut.pushFile((testDirectory / "player.bin").string(), std::vector<unsigned char>(100), batch);
+    sut.pushFile((testDirectory / "other.bin").string(), std::vector<unsigned char>(1000));
+
+    EXPECT_EQ(sut.waitForBatch(batch), 100);
+    sut.flush();
+    EXPECT_EQ(sut.statistics().writtenBytes, 1100);
+}
+
+TEST_F(ChunkSaveQueueTest, ErrorOfTheBatchIsThrownOnlyByWaitingForIt)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+    const auto batch = sut.beginBatch(false);
+    std::ofstream(testDirectory / "not_a_directory") << "file";
+
+    sut.pushFile((testDirectory / "not_a_directory" / "player.bin").string(), {1, 2, 3}, batch);
+    sut.pushFile((testDirectory / "inventory.bin").string(), {4, 5});
+
+    EXPECT_THROW(sut.waitForBatch(batch), std::exception);
+    std::filesystem::remove(testDirectory / "not_a_directory");
+    EXPECT_NO_THROW(sut.flush());
+    EXPECT_TRUE(std::filesystem::exists(testDirectory / "not_a_directory" / "player.bin"));
+}
+
+TEST_F(ChunkSaveQueueTest, SnapshotWhichCouldNotBeWrittenStaysUntilItIsWritten)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+    // A directory in place of the region file makes every write of its chunks fail
+    const ChunkContainer::Coordinate chunkCoordinate = {0, 0, 0};
+    const auto regionFilePath = testDirectory / "region_0_0_0.bin";
+    std::filesystem::create_directory(regionFilePath);
+    const ChunkCodec::BlockEdits blockEdits = {{7, BlockId::Planks}};
+    sut.push(chunkCoordinate, snapshotOf(blockEdits));
+
+    EXPECT_THROW(sut.flush(), std::runtime_error);
+    ASSERT_NE(sut.pendingSnapshot(chunkCoordinate), nullptr);
+    EXPECT_EQ(sut.pendingSnapshot(chunkCoordinate)->merged(), blockEdits);
+
+    std::filesystem::remove(regionFilePath);
+    EXPECT_NO_THROW(sut.flush());
+    EXPECT_EQ(savedBlockEdits(storage, chunkCoordinate), blockEdits);
+    EXPECT_EQ(sut.pendingSnapshot(chunkCoordinate), nullptr);
+}
+
+TEST_F(ChunkSaveQueueTest, SnapshotWhichCouldNotBeWrittenIsWrittenAgainLater)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+    const ChunkContainer::Coordinate chunkCoordinate = {0, 0, 0};
+    const auto regionFilePath = testDirectory / "region_0_0_0.bin";
+    std::filesystem::create_directory(regionFilePath);
+    const ChunkCodec::BlockEdits blockEdits = {{7, BlockId::Planks}};
+    sut.push(chunkCoordinate, snapshotOf(blockEdits));
+    EXPECT_THROW(sut.flush(), std::runtime_error);
+
+    // Nothing flushes the queue anymore, so only the saving threads can write it
+    std::filesystem::remove(regionFilePath);
+    const auto deadline = std::chrono::steady_clock::now() + 5 * ChunkSaveQueue::FIRST_RETRY_DELAY;
+    while (sut.pendingSnapshot(chunkCoordinate) && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_EQ(sut.pendingSnapshot(chunkCoordinate), nullptr);
+    EXPECT_EQ(savedBlockEdits(storage, chunkCoordinate), blockEdits);
+}
+
+TEST_F(ChunkSaveQueueTest, EmptyQueueIsNotFull)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+
+    EXPECT_FALSE(sut.isFull());
+}
+
+TEST_F(ChunkSaveQueueTest, FlushReportsTheProgressOfTheWrites)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+    sut.limitBandwidth(10000);
+    // The first write is not delayed, so it reserves the bandwidth for the ones which are counted
+    const auto previousBatch = sut.beginBatch(true);
+    sut.pushFile((testDirectory / "previous.bin").string(), std::vector<unsigned char>(1000),
+                 previousBatch);
+    sut.waitForBatch(previousBatch);
+
+    const auto batch = sut.beginBatch(true);
+    sut.pushFile((testDirectory / "first.bin").string(), std::vector<unsigned char>(1000), batch);
+    sut.pushFile((testDirectory / "second.bin").string(), std::vector<unsigned char>(1000), batch);
+    sut.pushFile((testDirectory / "third.bin").string(), std::vector<unsigned char>(1000), batch);
+
+    // The writes take at least 300ms, so the progress is reported a few times meanwhile
+    std::vector<std::size_t> reportedWrites;
+    sut.flush(
+        [&reportedWrites](std::size_t writtenSaves, std::size_t allSaves)
+        {
+            EXPECT_EQ(allSaves, 3);
+            reportedWrites.push_back(writtenSaves);
+        });
+
+    ASSERT_FALSE(reportedWrites.empty());
+    EXPECT_TRUE(std::is_sorted(reportedWrites.begin(), reportedWrites.end()));
+    EXPECT_LE(reportedWrites.back(), 3);
+}
+
+TEST_F(ChunkSaveQueueTest, ClosedQueueAcceptsNoMoreSaves)
+{
+    ChunkStorage storage(testDirectory.string());
+    ChunkSaveQueue sut(storage);
+    const ChunkCodec::BlockEdits blockEdits = {{7, BlockId::Planks}};
+    sut.push(coordinate, snapshotOf(blockEdits));
+
+    sut.close();
+    sut.push(coordinate, snapshotOf({{7, BlockId::Stone}}));
+    sut.push({5, 0, 5}, snapshotOf({{7, BlockId::Stone}}));
+    sut.pushFile((testDirectory / "player.bin").string(), {1, 2, 3});
+    sut.flush();
+
+    EXPECT_EQ(savedBlockEdits(storage, coordinate), blockEdits);
+    EXPECT_EQ(sut.pendingSnapshot(coordinate), nullptr);
+    EXPECT_FALSE(storage.doesChunkExist({5, 0, 5}));
+    EXPECT_FALSE(std::filesystem::exists(testDirectory / "player.bin"));
+}
+
+}// namespace
@@ -0,0 +1,136 @@
+#include "TestUtils/TemporaryDirectoryTest.h"
+#include "World/Chunks/ChunkStorage.h"
+#include "gtest/gtest.h"
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace
+{
+
+class ChunkStorageTest : public TemporaryDirectoryTest
+{
+protected:
+    void writeFile(const std::string& fileName, const std::vector<unsigned char>& data) const
+    {
+        std::ofstream file(testDirectory / fileName, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()),
+                   static_cast<std::streamsize>(data.size()));
+    }
+
+    static std::vector<unsigned char> savedChunk(SavedChunkFormat format,
+                                                 const std::vector<unsigned char>& data)
+    {
+        std::vector<unsigned char> savedChunk = {static_cast<unsigned char>(format)};
+        savedChunk.insert(savedChunk.end(), data.begin(), data.end());
+        return savedChunk;
+    }
+};
+
+TEST_F(ChunkStorageTest, EmptyWorldDoesNotContainAnyChunk)
+{
+    ChunkStorage sut(testDirectory.string());
+
+    EXPECT_FALSE(sut.doesChunkExist({0, 0, 0}));
+    EXPECT_FALSE(sut.readChunk({0, 0, 0}).has_value());
+}
+
+TEST_F(ChunkStorageTest, SavedChunksAreKnownAfterTheWorldIsOpenedAgain)
+{
+    const std::vector<unsigned char> data(50, 4);
+    {
+        ChunkStorage storage(testDirectory.string());
+        storage.writeChunk({1, 0, 1}, data);
+        storage.writeChunk({-33, 0, 70}, data);
+    }
+
+    ChunkStorage sut(testDirectory.string());
+
+    EXPECT_TRUE(sut.doesChunkExist({1, 0, 1}));
+    EXPECT_TRUE(sut.doesChunkExist({-33, 0, 70}));
+    EXPECT_FALSE(sut.doesChunkExist({1, 0, 2}));
+    EXPECT_EQ(sut.readChunk({-33, 0, 70}), data);
+}
+
+TEST_F(ChunkStorageTest, RemovedChunkIsNoLongerSaved)
+{
+    ChunkStorage sut(testDirectory.string());
+    sut.writeChunk({5, 0, -5}, std::vector<unsigned char>(10, 1));
+
+    sut.writeChunk({5, 0, -5}, {});
+
+    EXPECT_FALSE(sut.doesChunkExist({5, 0, -5}));
+    std::vector<unsigned char> buffer;
+    EXPECT_FALSE(sut.readChunk({5, 0, -5}, buffer));
+}
+TEST_F(ChunkStorageTest, ChunksAreReadAndWrittenFromManyThreadsAtOnce)
+{
+    constexpr auto NUMBER_OF_THREADS = 4;
+    constexpr auto CHUNKS_PER_THREAD = 40;
+    ChunkStorage sut(testDirectory.string());
+
+    std::vector<std::thread> threads;
+    for (auto thread = 0; thread < NUMBER_OF_THREADS; ++thread)
+    {
+        // Every other thread shares the region with another one
+        threads.emplace_back(
+            [&sut, thread]
+            {
+                const auto data = std::vector<unsigned char>(300, thread);
+                std::vector<unsigned char> buffer;
+                for (auto i = 0; i < CHUNKS_PER_THREAD; ++i)
+                {
+                    const ChunkContainer::Coordinate chunkCoordinate(thread / 2 * 32 + i % 32, 0,
+                                                                     thread % 2 + i / 32 * 2);
+                    sut.writeChunk(chunkCoordinate, data);
+                    EXPECT_TRUE(sut.readChunk(chunkCoordinate, buffer));
+                    EXPECT_EQ(buffer, data);
+                }
+            });
+    }
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_TRUE(sut.doesChunkExist({0, 0, 0}));
+    EXPECT_TRUE(sut.doesChunkExist({39, 0, 3}));
+}
+
+TEST_F(ChunkStorageTest, DamagedRegionFileIsMovedAsideAndItsChunksCanBeSavedAgain)
+{
+    writeFile("region_0_0_0.bin", std::vector<unsigned char>(100, 0xFF));
+
+    ChunkStorage sut(testDirectory.string());
+    sut.writeChunk({1, 0, 1}, std::vector<unsigned char>(10, 3));
+
+    EXPECT_TRUE(std::filesystem::exists(testDirectory / "region_0_0_0.bin.damaged"));
+    EXPECT_EQ(sut.readChunk({1, 0, 1}), std::vector<unsigned char>(10, 3));
+}
+
+TEST_F(ChunkStorageTest, ChunkFilesOfOlderVersionsAreMovedIntoRegions)
+{
+    const std::vector<unsigned char> allBlocks(40, 1);
+    writeFile("chunk_1_0_2.bin", allBlocks);
+    writeFile("chunk_-40_0_7.bin", allBlocks);
+
+    ChunkStorage sut(testDirectory.string());
+
+    EXPECT_EQ(sut.readChunk({1, 0, 2}), savedChunk(SavedChunkFormat::AllBlocks, allBlocks));
+    EXPECT_EQ(sut.readChunk({-40, 0, 7}), savedChunk(SavedChunkFormat::AllBlocks, allBlocks));
+    EXPECT_FALSE(std::filesystem::exists(testDirectory / "chunk_1_0_2.bin"));
+    EXPECT_FALSE(std::filesystem::exists(testDirectory / "chunk_-40_0_7.bin"));
+}
+
+TEST_F(ChunkStorageTest, FilesWithCoordinatesOutOfRangeAreIgnored)
+{
+    writeFile("chunk_99999999999_0_0.bin", std::vector<unsigned char>(40, 1));
+    writeFile("region_0_0_-99999999999.bin", std::vector<unsigned char>(40, 1));
+
+    ChunkStorage sut(testDirectory.string());
+
+    EXPECT_FALSE(sut.doesChunkExist({0, 0, 0}));
+    EXPECT_TRUE(std::filesystem::exists(testDirectory / "chunk_99999999999_0_0.bin"));
+}
+
+}// namespace
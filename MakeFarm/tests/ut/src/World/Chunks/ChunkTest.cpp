@@ -0,0 +1,101 @@
+#include "World/Chunks/Chunk.h"
+#include "Resources/TexturePack.h"
+#include "TestUtils/TemporaryDirectoryTest.h"
+#include "World/Chunks/BlockEditJournal.h"
+#include "World/Chunks/ChunkContainer.h"
+#include "World/Chunks/ChunkManager.h"
+#include "World/Chunks/ChunkPrefetcher.h"
+#include "World/Chunks/ChunkSaveQueue.h"
+#include "World/Chunks/ChunkStorage.h"
+#include "gtest/gtest.h"
+#include <filesystem>
+
+namespace
+{
+
+class ChunkTest : public TemporaryDirectoryTest
+{
+protected:
+    static constexpr int WORLD_SEED = 15;
+
+    void SetUp() override
+    {
+        TemporaryDirectoryTest::SetUp();
+
+        // The chunks only ask the manager to rebuild them, so it works on a world of its own
+        const auto managerDirectory = testDirectory / "manager";
+        std::filesystem::create_directories(managerDirectory);
+        manager = std::make_unique<ChunkManager>(texturePack, managerDirectory.string(),
+                                                 WORLD_SEED);
+
+        storage = std::make_unique<ChunkStorage>(testDirectory.string());
+        journal = std::make_unique<BlockEditJournal>(testDirectory.string());
+        saveQueue = std::make_unique<ChunkSaveQueue>(*storage);
+        prefetcher = std::make_unique<ChunkPrefetcher>(*storage, *saveQueue);
+        container = std::make_unique<ChunkContainer>();
+    }
+
+    void TearDown() override
+    {
+        // Removed chunks hand their edits over to the save queue, so they go first
+        container.reset();
+        prefetcher.reset();
+        saveQueue.reset();
+        journal.reset();
+        storage.reset();
+        manager.reset();
+
+        TemporaryDirectoryTest::TearDown();
+    }
+
+    std::shared_ptr<Chunk> loadChunk(const ChunkContainer::Coordinate& chunkCoordinate)
+    {
+        auto chunk = std::make_shared<Chunk>(sf::Vector3i(chunkCoordinate.nonChunkMetric()),
+                                             texturePack, *container, *manager, *prefetcher,
+                                             *saveQueue, *journal, WORLD_SEED);
+        container->emplace(chunkCoordinate, chunk);
+        return chunk;
+    }
+
+    TexturePack texturePack;
+    std::unique_ptr<ChunkManager> manager;
+    std::unique_ptr<ChunkStorage> storage;
+    std::unique_ptr<BlockEditJournal> journal;
+    std::unique_ptr<ChunkSaveQueue> saveQueue;
+    std::unique_ptr<ChunkPrefetcher> prefetcher;
+    std::unique_ptr<ChunkContainer> container;
+};
+
+TEST_F(ChunkTest, BlockGeneratedByNeighbourIsKeptWhenOnlyTheChunkItLandsInIsReloaded)
+{
+    const auto generatingChunk = loadChunk({0, 0, 0});
+    loadChunk({1, 0, 0});
+
+    // No generated terrain reaches the highest layer, so only the placed block can be there
+    const auto highestLayer = ChunkInterface::BLOCKS_PER_Y_DIMENSION - 1;
+    generatingChunk->tryToPlaceBlock(
+        BlockId::Leaves, {ChunkInterface::BLOCKS_PER_X_DIMENSION, highestLayer, 3}, {BlockId::Air},
+        RebuildOperation::None, PlacementOrigin::Generation);
+
+    container->erase({1, 0, 0});
+    saveQueue->flush();
+    const auto reloadedChunk = loadChunk({1, 0, 0});
+
+    EXPECT_EQ(reloadedChunk->localBlock({0, highestLayer, 3}).id(), BlockId::Leaves);
+}
+
+TEST_F(ChunkTest, BlockGeneratedByTheChunkItselfIsNotSaved)
+{
+    const auto chunk = loadChunk({0, 0, 0});
+
+    const auto highestLayer = ChunkInterface::BLOCKS_PER_Y_DIMENSION - 1;
+    chunk->tryToPlaceBlock(BlockId::Leaves, {2, highestLayer, 3}, {BlockId::Air},
+                           RebuildOperation::None, PlacementOrigin::Generation);
+
+    container->erase({0, 0, 0});
+    saveQueue->flush();
+
+    EXPECT_FALSE(storage->doesChunkExist({0, 0, 0}));
+}
+
+}// namespace
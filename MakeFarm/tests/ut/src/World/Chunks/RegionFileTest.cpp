@@ -0,0 +1,162 @@
+#include "TestUtils/TemporaryDirectoryTest.h"
+#include "World/Chunks/RegionFile.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+
+class RegionFileTest : public TemporaryDirectoryTest
+{
+protected:
+    void SetUp() override
+    {
+        TemporaryDirectoryTest::SetUp();
+        pathToFile = (testDirectory / "region" / "region_0_0_0.bin").string();
+    }
+
+    static std::vector<unsigned char> dataOfSize(std::size_t size, unsigned char value)
+    {
+        return std::vector<unsigned char>(size, value);
+    }
+
+    std::string pathToFile;
+};
+
+TEST_F(RegionFileTest, EmptyRegionDoesNotContainAnyChunk)
+{
+    RegionFile sut(pathToFile);
+
+    EXPECT_FALSE(sut.doesChunkExist(0, 0));
+    EXPECT_FALSE(sut.readChunk(31, 31).has_value());
+    EXPECT_TRUE(std::filesystem::exists(pathToFile));
+}
+
+TEST_F(RegionFileTest, WrittenChunkIsReadBack)
+{
+    RegionFile sut(pathToFile);
+    const auto data = dataOfSize(1000, 7);
+
+    sut.writeChunk(3, 5, data);
+
+    EXPECT_TRUE(sut.doesChunkExist(3, 5));
+    EXPECT_FALSE(sut.doesChunkExist(5, 3));
+    EXPECT_EQ(sut.readChunk(3, 5), data);
+}
+
+TEST_F(RegionFileTest, ChunksAreReadBackAfterReopeningTheFile)
+{
+    {
+        RegionFile sut(pathToFile);
+        sut.writeChunk(0, 0, dataOfSize(10, 1));
+        sut.writeChunk(31, 0, dataOfSize(700, 2));
+    }
+
+    RegionFile sut(pathToFile);
+
+    EXPECT_EQ(sut.readChunk(0, 0), dataOfSize(10, 1));
+    EXPECT_EQ(sut.readChunk(31, 0), dataOfSize(700, 2));
+    EXPECT_FALSE(sut.doesChunkExist(0, 31));
+}
+
+TEST_F(RegionFileTest, RewrittenChunkReusesFreedSectors)
+{
+    RegionFile sut(pathToFile);
+    sut.writeChunk(0, 0, dataOfSize(RegionFile::SECTOR_SIZE, 1));
+    sut.writeChunk(1, 0, dataOfSize(RegionFile::SECTOR_SIZE, 2));
+    const auto sectorsBeforeRewrites = sut.numberOfSectors();
+
+    for (auto rewrite = 0; rewrite < 10; ++rewrite)
+    {
+        sut.writeChunk(0, 0, dataOfSize(RegionFile::SECTOR_SIZE, rewrite));
+    }
+
+    EXPECT_EQ(sut.readChunk(0, 0), dataOfSize(RegionFile::SECTOR_SIZE, 9));
+    EXPECT_EQ(sut.readChunk(1, 0), dataOfSize(RegionFile::SECTOR_SIZE, 2));
+    EXPECT_LE(sut.numberOfSectors(), sectorsBeforeRewrites + 1);
+}
+
+TEST_F(RegionFileTest, GrowingChunkIsRelocatedWithoutDamagingNeighbours)
+{
+    RegionFile sut(pathToFile);
+    sut.writeChunk(0, 0, dataOfSize(100, 1));
+    sut.writeChunk(1, 0, dataOfSize(100, 2));
+
+    sut.writeChunk(0, 0, dataOfSize(5 * RegionFile::SECTOR_SIZE, 3));
+
+    EXPECT_EQ(sut.readChunk(0, 0), dataOfSize(5 * RegionFile::SECTOR_SIZE, 3));
+    EXPECT_EQ(sut.readChunk(1, 0), dataOfSize(100, 2));
+}
+
+TEST_F(RegionFileTest, WritingEmptyDataRemovesChunk)
+{
+    RegionFile sut(pathToFile);
+    sut.writeChunk(4, 4, dataOfSize(100, 1));
+
+    sut.writeChunk(4, 4, {});
+
+    EXPECT_FALSE(sut.doesChunkExist(4, 4));
+    EXPECT_FALSE(sut.readChunk(4, 4).has_value());
+}
+
+TEST_F(RegionFileTest, ChunkCutOffByTruncatedFileIsDropped)
+{
+    std::uintmax_t sizeOfEmptyFile;
+    {
+        RegionFile region(pathToFile);
+        sizeOfEmptyFile = std::filesystem::file_size(pathToFile);
+        region.writeChunk(2, 3, dataOfSize(600, 5));
+    }
+    std::filesystem::resize_file(pathToFile, sizeOfEmptyFile);
+
+    RegionFile sut(pathToFile);
+
+    EXPECT_FALSE(sut.doesChunkExist(2, 3));
+    EXPECT_FALSE(sut.readChunk(2, 3).has_value());
+    sut.writeChunk(2, 3, dataOfSize(10, 1));
+    EXPECT_EQ(sut.readChunk(2, 3), dataOfSize(10, 1));
+}
+
+TEST_F(RegionFileTest, ChunkWhoseEntryOverlapsAnotherChunkIsDropped)
+{
+    // The sizes are unique, so their header entries can be found in the file
+    constexpr auto FIRST_CHUNK_SIZE = 0x1234;
+    constexpr auto SECOND_CHUNK_SIZE = 0x0321;
+    {
+        RegionFile region(pathToFile);
+        region.writeChunk(0, 0, dataOfSize(FIRST_CHUNK_SIZE, 1));
+        region.writeChunk(1, 0, dataOfSize(SECOND_CHUNK_SIZE, 2));
+    }
+    std::vector<char> bytes(std::filesystem::file_size(pathToFile));
+    std::ifstream(pathToFile, std::ios::binary).read(bytes.data(), bytes.size());
+    auto entryOfSize = [&bytes](std::uint32_t size)
+    {
+        const char sizeBytes[] = {static_cast<char>(size & 0xFF), static_cast<char>(size >> 8), 0,
+                                  0};
+        return std::search(bytes.begin(), bytes.end(), sizeBytes, sizeBytes + 4) -
+               sizeof(std::uint32_t);
+    };
+    std::copy_n(entryOfSize(FIRST_CHUNK_SIZE), 2 * sizeof(std::uint32_t),
+                entryOfSize(SECOND_CHUNK_SIZE));
+    std::ofstream(pathToFile, std::ios::binary).write(bytes.data(), bytes.size());
+
+    RegionFile sut(pathToFile);
+    sut.writeChunk(1, 0, dataOfSize(10, 3));
+    sut.writeChunk(2, 0, dataOfSize(FIRST_CHUNK_SIZE, 4));
+
+    EXPECT_EQ(sut.readChunk(0, 0), dataOfSize(FIRST_CHUNK_SIZE, 1));
+    EXPECT_EQ(sut.readChunk(1, 0), dataOfSize(10, 3));
+    EXPECT_EQ(sut.readChunk(2, 0), dataOfSize(FIRST_CHUNK_SIZE, 4));
+}
+
+TEST_F(RegionFileTest, ChunkOutsideOfRegionThrows)
+{
+    RegionFile sut(pathToFile);
+
+    EXPECT_THROW(sut.writeChunk(32, 0, dataOfSize(1, 1)), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(sut.doesChunkExist(0, -1)), std::out_of_range);
+}
+
+}// namespace
@@ -40,7 +40,8 @@ TEST(TerrainGeneratorTest, ShouldGenerateTerrainForChunkWithOnlyOneBiome)
         }
     }
 
-    EXPECT_CALL(mockChunk, tryToPlaceBlock(testing::_, testing::_, testing::_, testing::_))
+    EXPECT_CALL(mockChunk,
+                tryToPlaceBlock(testing::_, testing::_, testing::_, testing::_, testing::_))
         .Times(testing::AtLeast(0));
 
     sut.generateTerrain(mockChunk, chunkBlocks);
@@ -78,10 +79,13 @@ TEST(TerrainGeneratorTest, ShouldGenerateTerrainForChunkWithDifferentBiomes)
     }
 
     EXPECT_CALL(mockChunk, localToGlobalCoordinates(testing::_))
-        .Times(4 * 4)// 4 blocks at 4 corners
+        .Times(4 * 4 + // 4 blocks at 4 corners
+               ChunkInterface::BLOCKS_PER_X_DIMENSION *
+                   ChunkInterface::BLOCKS_PER_Z_DIMENSION)// every column of the chunk
         .WillRepeatedly(testing::Return(Block::Coordinate{0, 0, 0}));
 
-    EXPECT_CALL(mockChunk, tryToPlaceBlock(testing::_, testing::_, testing::_, testing::_))
+    EXPECT_CALL(mockChunk,
+                tryToPlaceBlock(testing::_, testing::_, testing::_, testing::_, testing::_))
         .Times(testing::AtLeast(0));
 
     sut.generateTerrain(mockChunk, chunkBlocks);
@@ -0,0 +1,147 @@
+#include "World/Crafting/RecipeIndex.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+/**
+ * @brief Rows of the crafting grid, as written in the item files.
+ */
+using Rows = std::array<std::array<ItemId, 3>, 3>;
+
+constexpr auto NONE = ItemId::None;
+constexpr auto LOG = ItemId::Log_Block;
+constexpr auto PLANKS = ItemId::Planks_Block;
+constexpr auto DIRT = ItemId::Dirt_Block;
+constexpr auto SAND = ItemId::Sand_Block;
+
+RecipeIndex::Layout layoutFromRows(const Rows& rows)
+{
+    RecipeIndex::Layout layout;
+    for (auto row = 0; row < 3; ++row)
+    {
+        for (auto column = 0; column < 3; ++column)
+        {
+            layout[column][row] = rows[row][column];
+        }
+    }
+    return layout;
+}
+
+Recipe recipe(const Rows& rows, ItemId finalItem, bool shapeless = false)
+{
+    Recipe recipe;
+    recipe.layout = layoutFromRows(rows);
+    recipe.finalItem = finalItem;
+    recipe.shapeless = shapeless;
+    return recipe;
+}
+
+const Rows STICK_ROWS = {{{PLANKS, NONE, NONE}, //
+                          {PLANKS, NONE, NONE}, //
+                          {NONE, NONE, NONE}}};
+
+TEST(RecipeIndexTest, FindsShapedRecipeWhereverItIsPlacedInTheGrid)
+{
+    RecipeIndex sut({recipe(STICK_ROWS, ItemId::Stick)});
+
+    const auto* topLeft = sut.find(layoutFromRows(STICK_ROWS));
+    const auto* bottomRight = sut.find(layoutFromRows({{{NONE, NONE, NONE}, //
+                                                        {NONE, NONE, PLANKS},
+                                                        {NONE, NONE, PLANKS}}}));
+
+    ASSERT_NE(topLeft, nullptr);
+    ASSERT_NE(bottomRight, nullptr);
+    EXPECT_EQ(topLeft->finalItem, ItemId::Stick);
+    EXPECT_EQ(bottomRight->finalItem, ItemId::Stick);
+}
+
+TEST(RecipeIndexTest, FindsMirroredShapedRecipe)
+{
+    RecipeIndex sut({recipe({{{LOG, PLANKS, NONE}, //
+                              {LOG, NONE, NONE},
+                              {NONE, NONE, NONE}}},
+                            ItemId::Stick)});
+
+    const auto* mirrored = sut.find(layoutFromRows({{{NONE, PLANKS, LOG}, //
+                                                     {NONE, NONE, LOG},
+                                                     {NONE, NONE, NONE}}}));
+
+    ASSERT_NE(mirrored, nullptr);
+    EXPECT_EQ(mirrored->finalItem, ItemId::Stick);
+}
+
+TEST(RecipeIndexTest, DoesNotFindShapedRecipeWithDifferentShape)
+{
+    RecipeIndex sut({recipe(STICK_ROWS, ItemId::Stick)});
+
+    EXPECT_EQ(sut.find(layoutFromRows({{{PLANKS, PLANKS, NONE}, //
+                                        {NONE, NONE, NONE},
+                                        {NONE, NONE, NONE}}})),
+              nullptr);
+    EXPECT_EQ(sut.find(layoutFromRows({{{PLANKS, NONE, NONE}, //
+                                        {NONE, NONE, NONE},
+                                        {PLANKS, NONE, NONE}}})),
+              nullptr);
+    EXPECT_EQ(sut.find(RecipeIndex::Layout{}), nullptr);
+}
+
+TEST(RecipeIndexTest, FindsShapelessRecipeForAnyPlacementOfItsIngredients)
+{
+    RecipeIndex sut({recipe({{{DIRT, SAND, NONE}, //
+                              {NONE, NONE, NONE},
+                              {NONE, NONE, NONE}}},
+                            ItemId::Gravel_Block, true)});
+
+    const auto* found = sut.find(layoutFromRows({{{NONE, NONE, SAND}, //
+                                                  {NONE, NONE, NONE},
+                                                  {DIRT, NONE, NONE}}}));
+    const auto* notFound = sut.find(layoutFromRows({{{SAND, SAND, NONE}, //
+                                                     {DIRT, NONE, NONE},
+                                                     {NONE, NONE, NONE}}}));
+
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(found->finalItem, ItemId::Gravel_Block);
+    EXPECT_EQ(notFound, nullptr);
+}
+
+TEST(RecipeIndexTest, FirstRecipeWinsWhenRecipesShareThePattern)
+{
+    RecipeIndex sut({recipe({{{LOG, NONE, NONE}, //
+                              {NONE, NONE, NONE},
+                              {NONE, NONE, NONE}}},
+                            ItemId::Planks_Block),
+                     recipe({{{NONE, NONE, NONE}, //
+                              {NONE, LOG, NONE},
+                              {NONE, NONE, NONE}}},
+                            ItemId::Stick)});
+
+    const auto* found = sut.find(layoutFromRows({{{NONE, NONE, NONE}, //
+                                                  {NONE, NONE, NONE},
+                                                  {NONE, NONE, LOG}}}));
+
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(found->finalItem, ItemId::Planks_Block);
+    EXPECT_EQ(sut.recipes().size(), 2u);
+}
+
+TEST(RecipeIndexTest, ExactRecipeWinsOverMirroredEarlierRecipe)
+{
+    RecipeIndex sut({recipe({{{LOG, PLANKS, NONE}, //
+                              {NONE, NONE, NONE},
+                              {NONE, NONE, NONE}}},
+                            ItemId::Planks_Block),
+                     recipe({{{PLANKS, LOG, NONE}, //
+                              {NONE, NONE, NONE},
+                              {NONE, NONE, NONE}}},
+                            ItemId::Stick)});
+
+    const auto* found = sut.find(layoutFromRows({{{PLANKS, LOG, NONE}, //
+                                                  {NONE, NONE, NONE},
+                                                  {NONE, NONE, NONE}}}));
+
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(found->finalItem, ItemId::Stick);
+}
+
+}// namespace
@@ -0,0 +1,26 @@
+#include "TemporaryDirectoryTest.h"
+
+#include <random>
+#include <sstream>
+
+void TemporaryDirectoryTest::SetUp()
+{
+    const auto* testInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+    std::random_device randomDevice;
+    std::uniform_int_distribution<std::uint64_t> distribution;
+
+    // The random part keeps the directories of test processes run at the same time apart
+    do
+    {
+        std::ostringstream directoryName;
+        directoryName << "MakeFarm_" << testInfo->test_suite_name() << "_" << testInfo->name()
+                      << "_" << std::hex << distribution(randomDevice);
+        testDirectory = std::filesystem::temp_directory_path() / directoryName.str();
+    } while (!std::filesystem::create_directories(testDirectory));
+}
+
+void TemporaryDirectoryTest::TearDown()
+{
+    std::error_code error;
+    std::filesystem::remove_all(testDirectory, error);
+}
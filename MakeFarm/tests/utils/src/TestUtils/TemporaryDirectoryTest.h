@@ -0,0 +1,19 @@
+#pragma once
+#include "gtest/gtest.h"
+#include <filesystem>
+
+/**
+ * @brief Fixture of the tests working on files. Every test gets its own empty directory with a
+ * unique name, which is removed after the test, so tests running in parallel never share files.
+ */
+class TemporaryDirectoryTest : public ::testing::Test
+{
+protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    /**
+     * @brief Directory created for the current test.
+     */
+    std::filesystem::path testDirectory;
+};